@@ -71,6 +71,9 @@ include $(call all-makefiles-under,$(ROOT_PATH))
 # #testecho-arq-pfm
 # include $(ROOT_PATH)/testecho-arq-pfm/Android.mk
 
+##testecho-bench
+#include $(ROOT_PATH)/testecho-bench/Android.mk
+
 ##testecho-http
 #include $(ROOT_PATH)/testecho-http/Android.mk
 
@@ -6,7 +6,7 @@ using namespace std;
 
 app_arg g_app_arg;
 
-char app_arg::OPTIONS[] = ":a:p:b:d:j:t:e:i:c:l:s:m:o:z:x:y:n:r:u:k:w:q:hv";
+char app_arg::OPTIONS[] = ":a:p:b:d:j:t:e:i:c:l:s:m:o:z:x:y:n:r:u:k:w:q:g:hv";
 
 app_arg::app_arg()
 {
@@ -38,6 +38,8 @@ app_arg::app_arg()
 	max_conn		= 10000;
 	// -q
 	keep_alive		= true;
+	// -g
+	busy_poll		= 0;
 
 	// -o
 	cast_mode		= CM_MULTICAST;
@@ -92,6 +94,7 @@ void app_arg::ParseArgs(int argc, char* const argv[])
 		case 's': send_policy		= (EnSendPolicy)atoi(strOptArg);		break;
 		case 'm': max_conn			= (DWORD)atoi(strOptArg);				break;
 		case 'q': keep_alive		= (bool)atoi(strOptArg);				break;
+		case 'g': busy_poll			= (DWORD)atoi(strOptArg);				break;
 		case 'o': cast_mode			= (EnCastMode)atoi(strOptArg);			break;
 		case 'r': reuse_addr		= (EnReuseAddressPolicy)atoi(strOptArg);break;
 		case 'u': ip_loop			= (bool)atoi(strOptArg);				break;
@@ -113,7 +116,8 @@ void app_arg::PrintUsage()
 {
 	PRINTLN("--------------------------- Command Line Args ---------------------------");
 	PRINTLN(" -%s: %-20s-%s: %-20s-%s: %-20s", "a", "remote_addr", "b", "bind_addr", "c", "conn_count");
-	PRINTLN(" -%s: %-20s-%s: %-20s-%s: %-20s", "d", "local_port", "e", "test_times", "h", "(PRINT THIS USAGE)");
+	PRINTLN(" -%s: %-20s-%s: %-20s-%s: %-20s", "d", "local_port", "e", "test_times", "g", "busy_poll");
+	PRINTLN(" -%s: %-20s", "h", "(PRINT THIS USAGE)");
 	PRINTLN(" -%s: %-20s-%s: %-20s-%s: %-20s", "i", "test_interval", "j", "reject_addr", "k", "ttl");
 	PRINTLN(" -%s: %-20s-%s: %-20s-%s: %-20s", "l", "data_length", "m", "max_conn", "n", "async");
 	PRINTLN(" -%s: %-20s-%s: %-20s-%s: %-20s", "o", "cast_mode", "p", "port", "q", "keep_alive");
@@ -146,7 +150,8 @@ void app_arg::ShowPFMTestArgs(BOOL bAgent)
 	PRINTLN("%18s : %u", "data_length",		data_length);
 	if(bAgent) {
 	PRINTLN("%18s : %u", "thread_count",	thread_count);
-	PRINTLN("%18s : %u", "max_conn",		max_conn); }
+	PRINTLN("%18s : %u", "max_conn",		max_conn);
+	PRINTLN("%18s : %u", "busy_poll",		busy_poll); }
 	PRINTLN("-------------------+-------------------");
 }
 
@@ -1127,6 +1132,11 @@ void client_statistics_info::Reset()
 	m_llTotalReceived	= 0;
 	m_llTotalSent		= 0;
 	m_llExpectReceived	= (LONGLONG)g_app_arg.test_times * (LONGLONG)g_app_arg.conn_count * (LONGLONG)g_app_arg.data_length;
+
+	m_vtSendTimes.assign(g_app_arg.test_times, 0);
+	m_vtRoundTrips.clear();
+	m_vtRoundTrips.reserve((size_t)g_app_arg.test_times * g_app_arg.conn_count);
+	m_mpConnRecv.clear();
 }
 
 void client_statistics_info::StartTest()
@@ -1155,6 +1165,30 @@ void client_statistics_info::AddTotalSend(int iLength)
 	::InterlockedExchangeAdd(&m_llTotalSent, iLength);
 }
 
+void client_statistics_info::MarkSendTime(DWORD dwTimes)
+{
+	if(dwTimes < m_vtSendTimes.size())
+		m_vtSendTimes[dwTimes] = ::TimeGetMicroTime64();
+}
+
+void client_statistics_info::AddRoundTrip(CONNID dwConnID, int iLength)
+{
+	if(g_app_arg.data_length == 0)
+		return;
+
+	ULLONG ullNow = ::TimeGetMicroTime64();
+
+	CCriSecLock locallock(m_csRoundTrip);
+
+	LONGLONG& llRecv = m_mpConnRecv[dwConnID];
+	LONGLONG llBegin = llRecv / g_app_arg.data_length;
+
+	llRecv += iLength;
+
+	for(LONGLONG i = llBegin; i < llRecv / g_app_arg.data_length && i < (LONGLONG)m_vtSendTimes.size(); i++)
+		m_vtRoundTrips.push_back((DWORD)(ullNow - m_vtSendTimes[i]));
+}
+
 void client_statistics_info::TermConnected()
 {
 	if(m_iConnected >= 0)
@@ -1187,6 +1221,20 @@ void client_statistics_info::CheckStatistics(BOOL bCheckSend)
 		strMsg.Format(_T("*** Fail: manual terminated ? (or data lost) ***"));
 
 	::LogMsg(strMsg);
+
+	CCriSecLock locallock(m_csRoundTrip);
+
+	if(!m_vtRoundTrips.empty())
+	{
+		size_t size = m_vtRoundTrips.size();
+
+		sort(m_vtRoundTrips.begin(), m_vtRoundTrips.end());
+
+		strMsg.Format(	_T("*** Round Trip: count - %zu, p50 - %u us, p99 - %u us, max - %u us ***"),
+						size, m_vtRoundTrips[size * 50 / 100], m_vtRoundTrips[size * 99 / 100], m_vtRoundTrips[size - 1]);
+
+		::LogMsg(strMsg);
+	}
 }
 
 info_msg* info_msg::Construct(CONNID dwConnID, LPCTSTR lpszEvent, int iContentLength, LPCTSTR lpszContent, LPCTSTR lpszName)
@@ -96,6 +96,8 @@ struct app_arg
 	DWORD max_conn;
 	// -q
 	bool keep_alive;
+	// -g
+	DWORD busy_poll;
 
 	// -o
 	EnCastMode cast_mode;
@@ -299,11 +301,18 @@ struct client_statistics_info
 
 	volatile int m_iConnected;
 
+	CCriSec m_csRoundTrip;
+	vector<ULLONG> m_vtSendTimes;
+	vector<DWORD> m_vtRoundTrips;
+	unordered_map<CONNID, LONGLONG> m_mpConnRecv;
+
 	void Reset();
 	void StartTest();
 	void CheckStatistics(BOOL bCheckSend = TRUE);
 	void AddTotalRecv(int iLength);
 	void AddTotalSend(int iLength);
+	void MarkSendTime(DWORD dwTimes);
+	void AddRoundTrip(CONNID dwConnID, int iLength);
 
 	void TermConnected();
 	void AddConnected();
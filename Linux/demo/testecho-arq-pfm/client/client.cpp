@@ -40,6 +40,7 @@ public:
 		::PostOnReceive(dwConnID, pData, iLength);
 #endif
 		s_stat.AddTotalRecv(iLength);
+		s_stat.AddRoundTrip(dwConnID, iLength);
 
 		return HR_OK;
 	}
@@ -155,6 +156,8 @@ void OnCmdStart(CCommandParser* pParser)
 	BOOL bTerminated = FALSE;
 	for(DWORD i = 0; i < g_app_arg.test_times; i++)
 	{
+		s_stat.MarkSendTime(i);
+
 		for(DWORD j = 0; j < g_app_arg.conn_count; j++)
 		{
 			IUdpArqClient* pSocket = s_vtClients[j];
@@ -0,0 +1,37 @@
+LOCAL_PATH := $(call my-dir)
+
+# target lib :  hp-testecho-bench-loopback
+include $(CLEAR_VARS)
+LOCAL_MODULE     := hp-testecho-bench-loopback
+LOCAL_SRC_FILES  := loopback/loopback.cpp \
+					../global/helper.cpp
+LOCAL_WHOLE_STATIC_LIBRARIES := $(MY_WHOLE_STATIC_LIBRARIES) hpsocket
+LOCAL_C_INCLUDES := $(MY_C_INCLUDES)
+LOCAL_CFLAGS     := $(MY_CFLAGS) -D_NEED_SSL -D_NEED_HTTP
+LOCAL_CPPFLAGS   := $(MY_CPPFLAGS)
+LOCAL_LDLIBS     := $(MY_LDLIBS)
+include $(BUILD_EXECUTABLE)
+
+# target lib :  hp-testecho-bench-contention
+include $(CLEAR_VARS)
+LOCAL_MODULE     := hp-testecho-bench-contention
+LOCAL_SRC_FILES  := contention/contention.cpp \
+					../global/helper.cpp
+LOCAL_WHOLE_STATIC_LIBRARIES := $(MY_WHOLE_STATIC_LIBRARIES) hpsocket
+LOCAL_C_INCLUDES := $(MY_C_INCLUDES)
+LOCAL_CFLAGS     := $(MY_CFLAGS) -D_NEED_SSL -D_NEED_HTTP
+LOCAL_CPPFLAGS   := $(MY_CPPFLAGS)
+LOCAL_LDLIBS     := $(MY_LDLIBS)
+include $(BUILD_EXECUTABLE)
+
+# target lib :  hp-testecho-bench-parsepack
+include $(CLEAR_VARS)
+LOCAL_MODULE     := hp-testecho-bench-parsepack
+LOCAL_SRC_FILES  := parsepack/parsepack.cpp \
+					../global/helper.cpp
+LOCAL_WHOLE_STATIC_LIBRARIES := $(MY_WHOLE_STATIC_LIBRARIES) hpsocket
+LOCAL_C_INCLUDES := $(MY_C_INCLUDES)
+LOCAL_CFLAGS     := $(MY_CFLAGS) -D_NEED_SSL -D_NEED_HTTP
+LOCAL_CPPFLAGS   := $(MY_CPPFLAGS)
+LOCAL_LDLIBS     := $(MY_LDLIBS)
+include $(BUILD_EXECUTABLE)
@@ -0,0 +1,267 @@
+#include "../../global/helper.h"
+#include "../../../src/TcpServer.h"
+#include "../../../src/TcpAgent.h"
+#include "../../../src/common/Event.h"
+#include "../../../src/common/Thread.h"
+
+/*
+* 多线程发送竞争测试：多个生产者线程同时向少量热点连接发送消息
+*
+* Server 的每个生产者线程向全部 conn_count 个连接轮流发送 test_times 轮 data_length 字节的消息（消息头为生产者序号和消息序号），
+* Agent 按连接拆分消息并检查每个生产者的消息序号是否连续；
+* 依次以 1、2、4 ... 个生产者线程（不少于 CPU 核数的 2 倍为止）进行测试，用于比较多个生产者向同一连接压入发送数据的竞争开销
+*
+* 例如：contention -c 2 -e 100000 -l 16 [-s 2]
+*/
+
+struct TMsgHead
+{
+	DWORD producer;
+	DWORD seq;
+};
+
+/* Agent 连接的接收状态（仅由连接所属的工作线程访问） */
+struct TConnState
+{
+	CBufferPtr	partial;
+	vector<DWORD> seqs;
+
+	void Reset(DWORD dwProducers)
+	{
+		partial.Free();
+		seqs.assign(dwProducers, 0);
+	}
+};
+
+static volatile LONGLONG s_llRecv;
+static LONGLONG s_llExpect;
+static volatile LONG s_lOrderErrors;
+static volatile LONG s_lSendErrors;
+static CCounterEvent<> s_evRound;
+
+class CServerListenerImpl : public CTcpServerListener
+{
+public:
+	virtual EnHandleResult OnReceive(ITcpServer* pSender, CONNID dwConnID, const BYTE* pData, int iLength) override
+	{
+		return HR_OK;
+	}
+
+	virtual EnHandleResult OnClose(ITcpServer* pSender, CONNID dwConnID, EnSocketOperation enOperation, int iErrorCode) override
+	{
+		if(iErrorCode != SE_OK)
+			::PostOnError(dwConnID, enOperation, iErrorCode, _T("server"));
+
+		return HR_OK;
+	}
+};
+
+class CAgentListenerImpl : public CTcpAgentListener
+{
+public:
+	virtual EnHandleResult OnReceive(ITcpAgent* pSender, CONNID dwConnID, const BYTE* pData, int iLength) override
+	{
+		TConnState* pState = nullptr;
+		VERIFY(pSender->GetConnectionExtra(dwConnID, (PVOID*)&pState));
+
+		LONGLONG llRecv	= ::InterlockedAdd(&s_llRecv, (LONGLONG)iLength);
+		int iMsgLen		= (int)g_app_arg.data_length;
+
+		/* 先补齐上次未收完的消息，再逐条检查完整的消息 */
+		if(pState->partial.Size() > 0)
+		{
+			int iCopy = min(iMsgLen - (int)pState->partial.Size(), iLength);
+			pState->partial.Cat(pData, iCopy);
+
+			pData	+= iCopy;
+			iLength	-= iCopy;
+
+			if((int)pState->partial.Size() == iMsgLen)
+			{
+				CheckMessage(pState, pState->partial.Ptr());
+				pState->partial.Free();
+			}
+		}
+
+		for(; iLength >= iMsgLen; pData += iMsgLen, iLength -= iMsgLen)
+			CheckMessage(pState, pData);
+
+		if(iLength > 0)
+			pState->partial.Copy(pData, iLength);
+
+		if(llRecv == s_llExpect)
+			s_evRound.Set();
+
+		return HR_OK;
+	}
+
+	virtual EnHandleResult OnClose(ITcpAgent* pSender, CONNID dwConnID, EnSocketOperation enOperation, int iErrorCode) override
+	{
+		if(iErrorCode != SE_OK)
+			::PostOnError(dwConnID, enOperation, iErrorCode, _T("agent"));
+
+		return HR_OK;
+	}
+
+private:
+	static void CheckMessage(TConnState* pState, const BYTE* pData)
+	{
+		TMsgHead head;
+		memcpy(&head, pData, sizeof(TMsgHead));
+
+		if(head.producer >= pState->seqs.size() || head.seq != pState->seqs[head.producer]++)
+			::InterlockedIncrement(&s_lOrderErrors);
+	}
+};
+
+CServerListenerImpl s_server_listener;
+CAgentListenerImpl s_agent_listener;
+CTcpServer s_server(&s_server_listener);
+CTcpAgent s_agent(&s_agent_listener);
+
+static unique_ptr<CONNID[]> s_connIDs;
+static DWORD s_dwConnCount;
+
+class CProducer
+{
+public:
+	BOOL Start(DWORD dwProducer)
+	{
+		m_dwProducer = dwProducer;
+		return m_thWorker.Start(this, &CProducer::WorkerProc);
+	}
+
+	BOOL Join() {return m_thWorker.Join();}
+
+private:
+	UINT WorkerProc(PVOID pv)
+	{
+		CBufferPtr buffer(g_app_arg.data_length, true);
+		TMsgHead head = {m_dwProducer, 0};
+
+		for(; head.seq < g_app_arg.test_times; head.seq++)
+		{
+			memcpy(buffer.Ptr(), &head, sizeof(TMsgHead));
+
+			for(DWORD j = 0; j < s_dwConnCount; j++)
+			{
+				if(!s_server.Send(s_connIDs[j], buffer, (int)buffer.Size()))
+					::InterlockedIncrement(&s_lSendErrors);
+			}
+		}
+
+		return 0;
+	}
+
+private:
+	DWORD m_dwProducer;
+	CThread<CProducer, VOID, UINT> m_thWorker;
+};
+
+static BOOL TestRound(DWORD dwProducers, unique_ptr<TConnState[]>& states)
+{
+	for(DWORD j = 0; j < s_dwConnCount; j++)
+		states[j].Reset(dwProducers);
+
+	s_llRecv		= 0;
+	s_llExpect		= (LONGLONG)dwProducers * g_app_arg.test_times * s_dwConnCount * g_app_arg.data_length;
+	s_lOrderErrors	= 0;
+	s_lSendErrors	= 0;
+
+	unique_ptr<CProducer[]> producers(new CProducer[dwProducers]);
+
+	ULLONG ullBegin = ::TimeGetMicroTime64();
+
+	for(DWORD i = 0; i < dwProducers; i++)
+		VERIFY(producers[i].Start(i));
+
+	for(DWORD i = 0; i < dwProducers; i++)
+		producers[i].Join();
+
+	ULLONG ullSend = ::TimeGetMicroTime64() - ullBegin;
+
+	if(s_lSendErrors == 0 && s_evRound.Wait(60 * 1000) <= 0)
+	{
+		::LogMsg(_T("*** receive timeout ***"));
+		return FALSE;
+	}
+
+	ULLONG ullTotal	= ::TimeGetMicroTime64() - ullBegin;
+	ULLONG ullMsgs	= (ULLONG)dwProducers * g_app_arg.test_times * s_dwConnCount;
+
+	PRINTLN("%9u | %12.0f | %12.0f | %8ld | %8ld", dwProducers,
+		ullMsgs * 1000000.0 / MAX(ullSend, 1ULL), ullMsgs * 1000000.0 / MAX(ullTotal, 1ULL), s_lOrderErrors, s_lSendErrors);
+
+	return (s_lOrderErrors == 0 && s_lSendErrors == 0);
+}
+
+int main(int argc, char* const argv[])
+{
+	g_app_arg.ParseArgs(argc, argv);
+	g_app_arg.ShowPFMTestArgs(TRUE);
+
+	if(g_app_arg.data_length < sizeof(TMsgHead))
+	{
+		PRINTLN("*** data_length must be at least %d ***", (int)sizeof(TMsgHead));
+		return EXIT_CODE_CONFIG;
+	}
+
+	s_server.SetWorkerThreadCount(g_app_arg.thread_count);
+	s_server.SetSendPolicy(g_app_arg.send_policy);
+	s_server.SetBusyPollTime(g_app_arg.busy_poll);
+	s_agent.SetWorkerThreadCount(g_app_arg.thread_count);
+	s_agent.SetBusyPollTime(g_app_arg.busy_poll);
+
+	if(!s_server.Start(GetLoopbackAddress(g_app_arg.remote_addr), g_app_arg.port))
+	{
+		::LogServerStartFail(s_server.GetLastError(), s_server.GetLastErrorDesc());
+		return EXIT_CODE_CONFIG;
+	}
+
+	if(!s_agent.Start(nullptr, FALSE))
+	{
+		::LogAgentStartFail(s_agent.GetLastError(), s_agent.GetLastErrorDesc());
+		return EXIT_CODE_CONFIG;
+	}
+
+	s_dwConnCount = g_app_arg.conn_count;
+	unique_ptr<TConnState[]> states(new TConnState[s_dwConnCount]);
+
+	for(DWORD i = 0; i < s_dwConnCount; i++)
+	{
+		CONNID dwConnID;
+
+		if(!s_agent.Connect(GetLoopbackAddress(g_app_arg.remote_addr), g_app_arg.port, &dwConnID))
+		{
+			::LogAgentStartFail(::GetLastError(), ::GetSocketErrorDesc(SE_CONNECT_SERVER));
+			return EXIT_CODE_CONFIG;
+		}
+
+		s_agent.SetConnectionExtra(dwConnID, &states[i]);
+	}
+
+	while(s_agent.GetConnectionCount() < s_dwConnCount || s_server.GetConnectionCount() < s_dwConnCount)
+		::WaitFor(10);
+
+	DWORD dwCount = s_dwConnCount;
+	s_connIDs.reset(new CONNID[dwCount]);
+	VERIFY(s_server.GetAllConnectionIDs(s_connIDs.get(), dwCount));
+
+	DWORD dwMaxProducers = 2 * (DWORD)PROCESSOR_COUNT;
+	BOOL isOK = TRUE;
+
+	PRINTLN("Send Contention Result:");
+	PRINTLN("----------+--------------+--------------+----------+---------");
+	PRINTLN("%9s | %12s | %12s | %8s | %8s", "producers", "sends / sec", "msgs / sec", "order", "failed");
+	PRINTLN("----------+--------------+--------------+----------+---------");
+
+	for(DWORD dwProducers = 1; isOK && dwProducers < 2 * dwMaxProducers; dwProducers *= 2)
+		isOK = TestRound(MIN(dwProducers, dwMaxProducers), states);
+
+	PRINTLN("----------+--------------+--------------+----------+---------");
+
+	s_agent.Stop();
+	s_server.Stop();
+
+	return isOK ? EXIT_CODE_OK : EXIT_CODE_CONFIG;
+}
@@ -0,0 +1,173 @@
+#include "../../global/helper.h"
+#include "../../../src/TcpServer.h"
+#include "../../../src/TcpAgent.h"
+#include "../../../src/common/Event.h"
+
+#include <dlfcn.h>
+#include <sys/epoll.h>
+
+/*
+* 本地回环 echo 测试：统计每条消息引起的 epoll_ctl() 调用次数
+*
+* Agent 的每个连接每轮发送一条 data_length 字节的消息，Server 原样返回，全部连接收齐后开始下一轮；
+* 通过替换 epoll_ctl() 统计测试期间各操作的调用次数，用于比较套接字事件重新注册（EPOLL_CTL_MOD）的开销
+*/
+
+static volatile LONG s_lCtlAdd;
+static volatile LONG s_lCtlMod;
+static volatile LONG s_lCtlDel;
+
+extern "C" int epoll_ctl(int epfd, int op, int fd, struct epoll_event* event)
+{
+	using Fn_EpollCtl = int (*)(int, int, int, struct epoll_event*);
+	static Fn_EpollCtl fnEpollCtl = (Fn_EpollCtl)::dlsym(RTLD_NEXT, "epoll_ctl");
+
+	if(op == EPOLL_CTL_ADD)
+		::InterlockedIncrement(&s_lCtlAdd);
+	else if(op == EPOLL_CTL_MOD)
+		::InterlockedIncrement(&s_lCtlMod);
+	else if(op == EPOLL_CTL_DEL)
+		::InterlockedIncrement(&s_lCtlDel);
+
+	return fnEpollCtl(epfd, op, fd, event);
+}
+
+static volatile LONGLONG s_llRecv;
+static LONGLONG s_llExpect;
+static CCounterEvent<> s_evRound;
+
+class CServerListenerImpl : public CTcpServerListener
+{
+public:
+	virtual EnHandleResult OnReceive(ITcpServer* pSender, CONNID dwConnID, const BYTE* pData, int iLength) override
+	{
+		if(!pSender->Send(dwConnID, pData, iLength))
+			return HR_ERROR;
+
+		return HR_OK;
+	}
+
+	virtual EnHandleResult OnClose(ITcpServer* pSender, CONNID dwConnID, EnSocketOperation enOperation, int iErrorCode) override
+	{
+		if(iErrorCode != SE_OK)
+			::PostOnError(dwConnID, enOperation, iErrorCode, _T("server"));
+
+		return HR_OK;
+	}
+};
+
+class CAgentListenerImpl : public CTcpAgentListener
+{
+public:
+	virtual EnHandleResult OnReceive(ITcpAgent* pSender, CONNID dwConnID, const BYTE* pData, int iLength) override
+	{
+		if(::InterlockedAdd(&s_llRecv, (LONGLONG)iLength) == s_llExpect)
+			s_evRound.Set();
+
+		return HR_OK;
+	}
+
+	virtual EnHandleResult OnClose(ITcpAgent* pSender, CONNID dwConnID, EnSocketOperation enOperation, int iErrorCode) override
+	{
+		if(iErrorCode != SE_OK)
+			::PostOnError(dwConnID, enOperation, iErrorCode, _T("agent"));
+
+		return HR_OK;
+	}
+};
+
+CServerListenerImpl s_server_listener;
+CAgentListenerImpl s_agent_listener;
+CTcpServer s_server(&s_server_listener);
+CTcpAgent s_agent(&s_agent_listener);
+
+int main(int argc, char* const argv[])
+{
+	g_app_arg.ParseArgs(argc, argv);
+	g_app_arg.ShowPFMTestArgs(TRUE);
+
+	s_server.SetWorkerThreadCount(g_app_arg.thread_count);
+	s_server.SetSendPolicy(g_app_arg.send_policy);
+	s_server.SetBusyPollTime(g_app_arg.busy_poll);
+	s_agent.SetWorkerThreadCount(g_app_arg.thread_count);
+	s_agent.SetSendPolicy(g_app_arg.send_policy);
+	s_agent.SetBusyPollTime(g_app_arg.busy_poll);
+
+	if(!s_server.Start(GetLoopbackAddress(g_app_arg.remote_addr), g_app_arg.port))
+	{
+		::LogServerStartFail(s_server.GetLastError(), s_server.GetLastErrorDesc());
+		return EXIT_CODE_CONFIG;
+	}
+
+	if(!s_agent.Start(nullptr, FALSE))
+	{
+		::LogAgentStartFail(s_agent.GetLastError(), s_agent.GetLastErrorDesc());
+		return EXIT_CODE_CONFIG;
+	}
+
+	for(DWORD i = 0; i < g_app_arg.conn_count; i++)
+	{
+		if(!s_agent.Connect(GetLoopbackAddress(g_app_arg.remote_addr), g_app_arg.port))
+		{
+			::LogAgentStartFail(::GetLastError(), ::GetSocketErrorDesc(SE_CONNECT_SERVER));
+			return EXIT_CODE_CONFIG;
+		}
+	}
+
+	while(s_agent.GetConnectionCount() < g_app_arg.conn_count || s_server.GetConnectionCount() < g_app_arg.conn_count)
+		::WaitFor(10);
+
+	DWORD dwCount = g_app_arg.conn_count;
+	unique_ptr<CONNID[]> connIDs(new CONNID[dwCount]);
+	VERIFY(s_agent.GetAllConnectionIDs(connIDs.get(), dwCount));
+
+	CBufferPtr buffer(g_app_arg.data_length, true);
+	LONGLONG llRound = (LONGLONG)dwCount * g_app_arg.data_length;
+
+	s_lCtlAdd = s_lCtlMod = s_lCtlDel = 0;
+	ULLONG ullBegin = ::TimeGetMicroTime64();
+
+	for(DWORD i = 0; i < g_app_arg.test_times; i++)
+	{
+		s_llExpect = llRound * (i + 1);
+
+		for(DWORD j = 0; j < dwCount; j++)
+		{
+			if(!s_agent.Send(connIDs[j], buffer, (int)buffer.Size()))
+			{
+				::LogClientSendFail(i + 1, j + 1, ::GetLastError(), ::GetSocketErrorDesc(SE_DATA_SEND));
+				return EXIT_CODE_CONFIG;
+			}
+		}
+
+		if(s_evRound.Wait(10 * 1000) <= 0)
+		{
+			::LogMsg(_T("*** echo timeout ***"));
+			return EXIT_CODE_CONFIG;
+		}
+	}
+
+	ULLONG ullTime	= ::TimeGetMicroTime64() - ullBegin;
+	LONG lAdd		= s_lCtlAdd;
+	LONG lMod		= s_lCtlMod;
+	LONG lDel		= s_lCtlDel;
+
+	/* 每条消息由 Agent 发送、Server 接收并返回、Agent 接收，共计 2 次发送和 2 次接收 */
+	ULLONG ullMsgs = (ULLONG)dwCount * g_app_arg.test_times;
+
+	PRINTLN("Loopback Echo Result:");
+	PRINTLN("-------------------+-------------------");
+	PRINTLN("%18s : %llu", "messages",			ullMsgs);
+	PRINTLN("%18s : %llu", "time (us)",			ullTime);
+	PRINTLN("%18s : %.0f", "messages / sec",	ullMsgs * 1000000.0 / MAX(ullTime, 1ULL));
+	PRINTLN("%18s : %d", "EPOLL_CTL_ADD",		lAdd);
+	PRINTLN("%18s : %d", "EPOLL_CTL_MOD",		lMod);
+	PRINTLN("%18s : %d", "EPOLL_CTL_DEL",		lDel);
+	PRINTLN("%18s : %.3f", "epoll_ctl / msg",	(lAdd + lMod + lDel) / (double)ullMsgs);
+	PRINTLN("-------------------+-------------------");
+
+	s_agent.Stop();
+	s_server.Stop();
+
+	return EXIT_CODE_OK;
+}
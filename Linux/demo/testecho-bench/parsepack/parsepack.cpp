@@ -0,0 +1,186 @@
+#include "../../global/helper.h"
+#include "../../../src/MiscHelper.h"
+
+/*
+* Pack 组件解析性能测试：比较原地解析与复制解析的开销
+*
+* 把 64 B - 64 KB 的包组成约 4 MB 的数据流，按接收缓冲区大小（4 KB 与 64 KB）分块交给解析函数，重复 test_times 遍；
+* 复制解析（copy）为原解析方式：每块数据先追加到连接缓冲区，再为每个包头和包体分配临时缓冲区并复制；
+* 原地解析（in-place）为 ParsePack() 当前的实现：完整的包直接在接收数据中分发，只有不完整的包才放入连接缓冲区
+*
+* 例如：parsepack -e 20
+*/
+
+#define STREAM_SIZE		(4 * 1024 * 1024)
+
+class CMockSocket
+{
+public:
+	BOOL IsPaused() {return FALSE;}
+};
+
+class CMockReceiver
+{
+public:
+	BOOL IsReceiveBatch() {return FALSE;}
+
+	EnHandleResult DoFireSuperReceive(CMockSocket* pSocket, const BYTE* pData, int iLength)
+	{
+		m_ullPacks++;
+		m_ullSum += pData[iLength - 1];
+
+		return HR_OK;
+	}
+
+	EnHandleResult DoFireSuperReceiveBatch(CMockSocket* pSocket, const WSABUF pFrames[], int iCount)
+	{
+		for(int i = 0; i < iCount; i++)
+			DoFireSuperReceive(pSocket, pFrames[i].buf, (int)pFrames[i].len);
+
+		return HR_OK;
+	}
+
+public:
+	ULLONG m_ullPacks	= 0;
+	ULLONG m_ullSum		= 0;
+};
+
+/* 原解析方式：接收数据追加到连接缓冲区，每个包头和包体都复制到新分配的临时缓冲区 */
+template<class T, class B, class S> EnHandleResult CopyParsePack(T* pThis, TPackInfo<B>* pInfo, B* pBuffer, S* pSocket, DWORD dwMaxPackSize, USHORT usPackHeaderFlag, const BYTE* pData, int iLength)
+{
+	EnHandleResult rs = HR_OK;
+
+	pBuffer->Cat(pData, iLength);
+
+	int required = pInfo->length;
+	int remain	 = pBuffer->Length();
+
+	while(remain >= required)
+	{
+		if(pSocket->IsPaused())
+			break;
+
+		remain -= required;
+		CBufferPtr buffer(required);
+
+		pBuffer->Fetch(buffer, (int)buffer.Size());
+
+		if(pInfo->header)
+		{
+			DWORD len = ::ParsePackHeader(::HToLE32(*((DWORD*)(BYTE*)buffer)), dwMaxPackSize, usPackHeaderFlag);
+
+			if(len == 0)
+				return HR_ERROR;
+
+			required = len;
+		}
+		else
+		{
+			rs = pThis->DoFireSuperReceive(pSocket, (const BYTE*)buffer, (int)buffer.Size());
+
+			if(rs == HR_ERROR)
+				return rs;
+
+			required = sizeof(DWORD);
+		}
+
+		pInfo->header = !pInfo->header;
+		pInfo->length = required;
+	}
+
+	return rs;
+}
+
+template<bool in_place> static ULLONG TestParse(CBufferPool& bfPool, const CBufferPtr& stream, int iReadSize, CMockReceiver& receiver)
+{
+	CMockSocket socket;
+	TBuffer* pBuffer = bfPool.PickFreeBuffer(1);
+	TBufferPackInfo info(pBuffer);
+
+	ULLONG ullBegin = ::TimeGetMicroTime64();
+
+	for(DWORD i = 0; i < g_app_arg.test_times; i++)
+	{
+		for(size_t off = 0; off < stream.Size(); off += iReadSize)
+		{
+			const BYTE* pData	= stream.Ptr() + off;
+			int iLength			= (int)MIN((size_t)iReadSize, stream.Size() - off);
+			EnHandleResult rs;
+
+			if(in_place)
+				rs = ::ParsePack(&receiver, &info, pBuffer, &socket, TCP_PACK_MAX_SIZE_LIMIT, 0, pData, iLength);
+			else
+				rs = ::CopyParsePack(&receiver, &info, pBuffer, &socket, TCP_PACK_MAX_SIZE_LIMIT, 0, pData, iLength);
+
+			VERIFY(rs == HR_OK);
+		}
+	}
+
+	ULLONG ullTime = ::TimeGetMicroTime64() - ullBegin;
+
+	bfPool.PutFreeBuffer(pBuffer);
+
+	return MAX(ullTime, 1ULL);
+}
+
+static BOOL TestCase(CBufferPool& bfPool, int iReadSize, int iPackSize)
+{
+	int iPacks = MAX(STREAM_SIZE / (iPackSize + (int)sizeof(DWORD)), 1);
+	CBufferPtr stream((size_t)iPacks * (iPackSize + sizeof(DWORD)));
+
+	for(int i = 0; i < iPacks; i++)
+	{
+		BYTE* p		 = stream.Ptr() + (size_t)i * (iPackSize + sizeof(DWORD));
+		DWORD header = ::HToLE32((DWORD)iPackSize);
+
+		memcpy(p, &header, sizeof(DWORD));
+		memset(p + sizeof(DWORD), (BYTE)i, iPackSize);
+	}
+
+	CMockReceiver rcCopy, rcInPlace;
+	ULLONG ullCopy		= TestParse<false>(bfPool, stream, iReadSize, rcCopy);
+	ULLONG ullInPlace	= TestParse<true>(bfPool, stream, iReadSize, rcInPlace);
+
+	ULLONG ullPacks	= (ULLONG)iPacks * g_app_arg.test_times;
+	double dBytes	= (double)stream.Size() * g_app_arg.test_times;
+
+	PRINTLN("%9d | %9d | %11.1f %13.0f | %11.1f %13.0f | %6.2f", iReadSize, iPackSize,
+		ullCopy * 1000.0 / ullPacks, dBytes / ullCopy, ullInPlace * 1000.0 / ullPacks, dBytes / ullInPlace, (double)ullCopy / ullInPlace);
+
+	return (rcCopy.m_ullPacks == ullPacks && rcInPlace.m_ullPacks == ullPacks && rcCopy.m_ullSum == rcInPlace.m_ullSum);
+}
+
+int main(int argc, char* const argv[])
+{
+	g_app_arg.ParseArgs(argc, argv);
+
+	CBufferPool bfPool;
+	bfPool.SetMaxCacheSize(1);
+	bfPool.SetItemCapacity(DEFAULT_TCP_SOCKET_BUFFER_SIZE);
+	bfPool.Prepare();
+
+	int iReadSizes[] = {DEFAULT_TCP_SOCKET_BUFFER_SIZE, 64 * 1024};
+	int iPackSizes[] = {64, 256, 1024, 4 * 1024, 16 * 1024, 64 * 1024};
+	BOOL isOK		 = TRUE;
+
+	PRINTLN("ParsePack Result (test_times: %u):", g_app_arg.test_times);
+	PRINTLN("----------+-----------+---------------------------+---------------------------+-------");
+	PRINTLN("%9s | %9s | %11s %13s | %11s %13s | %6s", "read size", "pack size", "copy ns/pk", "copy MB/s", "in-place ns", "in-place MB/s", "ratio");
+	PRINTLN("----------+-----------+---------------------------+---------------------------+-------");
+
+	for(int iReadSize : iReadSizes)
+	{
+		for(int iPackSize : iPackSizes)
+		{
+			if(!TestCase(bfPool, iReadSize, iPackSize))
+			{
+				PRINTLN("*** pack count or content mismatch (read size: %d, pack size: %d) ***", iReadSize, iPackSize);
+				isOK = FALSE;
+			}
+		}
+	}
+
+	PRINTLN("----------+-----------+---------------------------+---------------------------+-------");
+
+	return isOK ? EXIT_CODE_OK : EXIT_CODE_CONFIG;
+}
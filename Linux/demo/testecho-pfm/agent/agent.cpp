@@ -31,6 +31,7 @@ public:
 		::PostOnReceive(dwConnID, pData, iLength);
 #endif
 		s_stat.AddTotalRecv(iLength);
+		s_stat.AddRoundTrip(dwConnID, iLength);
 
 		return HR_OK;
 	}
@@ -133,6 +134,8 @@ void OnCmdStart(CCommandParser* pParser)
 	BOOL bTerminated = FALSE;
 	for(DWORD i = 0; i < g_app_arg.test_times; i++)
 	{
+		s_stat.MarkSendTime(i);
+
 		for(DWORD j = 0; j < g_app_arg.conn_count; j++)
 		{
 			if(!s_agent.Send(connIDs[j], s_sendBuffer, (int)s_sendBuffer.Size()))
@@ -188,6 +191,7 @@ int main(int argc, char* const argv[])
 	s_agent.SetMaxConnectionCount(g_app_arg.max_conn);
 	s_agent.SetSendPolicy(g_app_arg.send_policy);
 	s_agent.SetKeepAliveTime(g_app_arg.keep_alive ? TCP_KEEPALIVE_TIME : 0);
+	s_agent.SetBusyPollTime(g_app_arg.busy_poll);
 
 	CCommandParser::CMD_FUNC fnCmds[CCommandParser::CT_MAX] = {0};
 
@@ -167,6 +167,7 @@ int main(int argc, char* const argv[])
 	s_server.SetMaxConnectionCount(g_app_arg.max_conn);
 	s_server.SetSendPolicy(g_app_arg.send_policy);
 	s_server.SetKeepAliveTime(g_app_arg.keep_alive ? TCP_KEEPALIVE_TIME : 0);
+	s_server.SetBusyPollTime(g_app_arg.busy_poll);
 
 	CCommandParser::CMD_FUNC fnCmds[CCommandParser::CT_MAX] = {0};
 
@@ -37,6 +37,7 @@ public:
 		::PostOnReceive(dwConnID, pData, iLength);
 #endif
 		s_stat.AddTotalRecv(iLength);
+		s_stat.AddRoundTrip(dwConnID, iLength);
 
 		return HR_OK;
 	}
@@ -161,6 +162,8 @@ void OnCmdStart(CCommandParser* pParser)
 	BOOL bTerminated = FALSE;
 	for(DWORD i = 0; i < g_app_arg.test_times; i++)
 	{
+		s_stat.MarkSendTime(i);
+
 		for(DWORD j = 0; j < g_app_arg.conn_count; j++)
 		{
 			if(!s_pagent->Send(connIDs[j], s_sendBuffer, (int)s_sendBuffer.Size()))
@@ -224,6 +227,7 @@ int main(int argc, char* const argv[])
 	s_pagent->SetMaxConnectionCount(g_app_arg.max_conn);
 	s_pagent->SetSendPolicy(g_app_arg.send_policy);
 	s_pagent->SetKeepAliveTime(g_app_arg.keep_alive ? TCP_KEEPALIVE_TIME : 0);
+	s_pagent->SetBusyPollTime(g_app_arg.busy_poll);
 
 	CCommandParser::CMD_FUNC fnCmds[CCommandParser::CT_MAX] = {0};
 
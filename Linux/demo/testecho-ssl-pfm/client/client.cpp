@@ -39,6 +39,7 @@ public:
 		::PostOnReceive(dwConnID, pData, iLength);
 #endif
 		s_stat.AddTotalRecv(iLength);
+		s_stat.AddRoundTrip(dwConnID, iLength);
 
 		return HR_OK;
 	}
@@ -165,6 +166,8 @@ void OnCmdStart(CCommandParser* pParser)
 	BOOL bTerminated = FALSE;
 	for(DWORD i = 0; i < g_app_arg.test_times; i++)
 	{
+		s_stat.MarkSendTime(i);
+
 		for(DWORD j = 0; j < g_app_arg.conn_count; j++)
 		{
 			ITcpClient* pSocket = s_vtClients[j];
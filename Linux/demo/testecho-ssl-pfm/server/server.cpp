@@ -177,6 +177,7 @@ int main(int argc, char* const argv[])
 	s_pserver->SetMaxConnectionCount(g_app_arg.max_conn);
 	s_pserver->SetSendPolicy(g_app_arg.send_policy);
 	s_pserver->SetKeepAliveTime(g_app_arg.keep_alive ? TCP_KEEPALIVE_TIME : 0);
+	s_pserver->SetBusyPollTime(g_app_arg.busy_poll);
 
 	CCommandParser::CMD_FUNC fnCmds[CCommandParser::CT_MAX] = {0};
 
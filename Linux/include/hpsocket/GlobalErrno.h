@@ -78,6 +78,8 @@
 #define ERROR_BUFFER_OVERFLOW			E2BIG
 #define ERROR_OUT_OF_RANGE  			ERANGE
 #define ERROR_DESTINATION_ELEMENT_FULL	EXFULL
+#define ERROR_NOT_ENOUGH_QUOTA			ENOBUFS
+#define ERROR_NOT_ENOUGH_MEMORY			ENOMEM
 #define ERROR_ALREADY_INITIALIZED		EALREADY
 #define ERROR_CANT_WAIT                 EIO
 
@@ -156,7 +156,10 @@ typedef En_HP_HandleResult (__HP_CALL *HP_FN_Server_OnHandShake)		(HP_Server pSe
 typedef En_HP_HandleResult (__HP_CALL *HP_FN_Server_OnSend)				(HP_Server pSender, HP_CONNID dwConnID, const BYTE* pData, int iLength);
 typedef En_HP_HandleResult (__HP_CALL *HP_FN_Server_OnReceive)			(HP_Server pSender, HP_CONNID dwConnID, const BYTE* pData, int iLength);
 typedef En_HP_HandleResult (__HP_CALL *HP_FN_Server_OnPullReceive)		(HP_Server pSender, HP_CONNID dwConnID, int iLength);
+typedef En_HP_HandleResult (__HP_CALL *HP_FN_Server_OnReceiveBatch)		(HP_Server pSender, HP_CONNID dwConnID, const WSABUF pFrames[], int iCount);
 typedef En_HP_HandleResult (__HP_CALL *HP_FN_Server_OnClose)			(HP_Server pSender, HP_CONNID dwConnID, En_HP_SocketOperation enOperation, int iErrorCode);
+typedef En_HP_HandleResult (__HP_CALL *HP_FN_Server_OnSendBufferHigh)	(HP_Server pSender, HP_CONNID dwConnID, int iPending);
+typedef En_HP_HandleResult (__HP_CALL *HP_FN_Server_OnSendBufferDrained)	(HP_Server pSender, HP_CONNID dwConnID, int iPending);
 typedef En_HP_HandleResult (__HP_CALL *HP_FN_Server_OnShutdown)			(HP_Server pSender);
 
 /* Agent 回调函数 */
@@ -166,7 +169,10 @@ typedef En_HP_HandleResult (__HP_CALL *HP_FN_Agent_OnHandShake)			(HP_Agent pSen
 typedef En_HP_HandleResult (__HP_CALL *HP_FN_Agent_OnSend)				(HP_Agent pSender, HP_CONNID dwConnID, const BYTE* pData, int iLength);
 typedef En_HP_HandleResult (__HP_CALL *HP_FN_Agent_OnReceive)			(HP_Agent pSender, HP_CONNID dwConnID, const BYTE* pData, int iLength);
 typedef En_HP_HandleResult (__HP_CALL *HP_FN_Agent_OnPullReceive)		(HP_Agent pSender, HP_CONNID dwConnID, int iLength);
+typedef En_HP_HandleResult (__HP_CALL *HP_FN_Agent_OnReceiveBatch)		(HP_Agent pSender, HP_CONNID dwConnID, const WSABUF pFrames[], int iCount);
 typedef En_HP_HandleResult (__HP_CALL *HP_FN_Agent_OnClose)				(HP_Agent pSender, HP_CONNID dwConnID, En_HP_SocketOperation enOperation, int iErrorCode);
+typedef En_HP_HandleResult (__HP_CALL *HP_FN_Agent_OnSendBufferHigh)	(HP_Agent pSender, HP_CONNID dwConnID, int iPending);
+typedef En_HP_HandleResult (__HP_CALL *HP_FN_Agent_OnSendBufferDrained)	(HP_Agent pSender, HP_CONNID dwConnID, int iPending);
 typedef En_HP_HandleResult (__HP_CALL *HP_FN_Agent_OnShutdown)			(HP_Agent pSender);
 
 /* Client 回调函数 */
@@ -176,6 +182,7 @@ typedef En_HP_HandleResult (__HP_CALL *HP_FN_Client_OnHandShake)		(HP_Client pSe
 typedef En_HP_HandleResult (__HP_CALL *HP_FN_Client_OnSend)				(HP_Client pSender, HP_CONNID dwConnID, const BYTE* pData, int iLength);
 typedef En_HP_HandleResult (__HP_CALL *HP_FN_Client_OnReceive)			(HP_Client pSender, HP_CONNID dwConnID, const BYTE* pData, int iLength);
 typedef En_HP_HandleResult (__HP_CALL *HP_FN_Client_OnPullReceive)		(HP_Client pSender, HP_CONNID dwConnID, int iLength);
+typedef En_HP_HandleResult (__HP_CALL *HP_FN_Client_OnReceiveBatch)		(HP_Client pSender, HP_CONNID dwConnID, const WSABUF pFrames[], int iCount);
 typedef En_HP_HandleResult (__HP_CALL *HP_FN_Client_OnClose)			(HP_Client pSender, HP_CONNID dwConnID, En_HP_SocketOperation enOperation, int iErrorCode);
 
 #ifdef _UDP_SUPPORT
@@ -333,8 +340,11 @@ HPSOCKET_API void __HP_CALL HP_Set_FN_Server_OnHandShake(HP_ServerListener pList
 HPSOCKET_API void __HP_CALL HP_Set_FN_Server_OnSend(HP_ServerListener pListener				, HP_FN_Server_OnSend fn);
 HPSOCKET_API void __HP_CALL HP_Set_FN_Server_OnReceive(HP_ServerListener pListener			, HP_FN_Server_OnReceive fn);
 HPSOCKET_API void __HP_CALL HP_Set_FN_Server_OnPullReceive(HP_ServerListener pListener		, HP_FN_Server_OnPullReceive fn);
+HPSOCKET_API void __HP_CALL HP_Set_FN_Server_OnReceiveBatch(HP_ServerListener pListener		, HP_FN_Server_OnReceiveBatch fn);
 HPSOCKET_API void __HP_CALL HP_Set_FN_Server_OnClose(HP_ServerListener pListener			, HP_FN_Server_OnClose fn);
 HPSOCKET_API void __HP_CALL HP_Set_FN_Server_OnShutdown(HP_ServerListener pListener			, HP_FN_Server_OnShutdown fn);
+HPSOCKET_API void __HP_CALL HP_Set_FN_Server_OnSendBufferHigh(HP_ServerListener pListener	, HP_FN_Server_OnSendBufferHigh fn);
+HPSOCKET_API void __HP_CALL HP_Set_FN_Server_OnSendBufferDrained(HP_ServerListener pListener	, HP_FN_Server_OnSendBufferDrained fn);
 
 /**********************************************************************************/
 /****************************** Agent 回调函数设置方法 *****************************/
@@ -345,8 +355,11 @@ HPSOCKET_API void __HP_CALL HP_Set_FN_Agent_OnHandShake(HP_AgentListener pListen
 HPSOCKET_API void __HP_CALL HP_Set_FN_Agent_OnSend(HP_AgentListener pListener				, HP_FN_Agent_OnSend fn);
 HPSOCKET_API void __HP_CALL HP_Set_FN_Agent_OnReceive(HP_AgentListener pListener			, HP_FN_Agent_OnReceive fn);
 HPSOCKET_API void __HP_CALL HP_Set_FN_Agent_OnPullReceive(HP_AgentListener pListener		, HP_FN_Agent_OnPullReceive fn);
+HPSOCKET_API void __HP_CALL HP_Set_FN_Agent_OnReceiveBatch(HP_AgentListener pListener		, HP_FN_Agent_OnReceiveBatch fn);
 HPSOCKET_API void __HP_CALL HP_Set_FN_Agent_OnClose(HP_AgentListener pListener				, HP_FN_Agent_OnClose fn);
 HPSOCKET_API void __HP_CALL HP_Set_FN_Agent_OnShutdown(HP_AgentListener pListener			, HP_FN_Agent_OnShutdown fn);
+HPSOCKET_API void __HP_CALL HP_Set_FN_Agent_OnSendBufferHigh(HP_AgentListener pListener		, HP_FN_Agent_OnSendBufferHigh fn);
+HPSOCKET_API void __HP_CALL HP_Set_FN_Agent_OnSendBufferDrained(HP_AgentListener pListener	, HP_FN_Agent_OnSendBufferDrained fn);
 
 /**********************************************************************************/
 /***************************** Client 回调函数设置方法 *****************************/
@@ -357,6 +370,7 @@ HPSOCKET_API void __HP_CALL HP_Set_FN_Client_OnHandShake(HP_ClientListener pList
 HPSOCKET_API void __HP_CALL HP_Set_FN_Client_OnSend(HP_ClientListener pListener				, HP_FN_Client_OnSend fn);
 HPSOCKET_API void __HP_CALL HP_Set_FN_Client_OnReceive(HP_ClientListener pListener			, HP_FN_Client_OnReceive fn);
 HPSOCKET_API void __HP_CALL HP_Set_FN_Client_OnPullReceive(HP_ClientListener pListener		, HP_FN_Client_OnPullReceive fn);
+HPSOCKET_API void __HP_CALL HP_Set_FN_Client_OnReceiveBatch(HP_ClientListener pListener		, HP_FN_Client_OnReceiveBatch fn);
 HPSOCKET_API void __HP_CALL HP_Set_FN_Client_OnClose(HP_ClientListener pListener			, HP_FN_Client_OnClose fn);
 
 #ifdef _UDP_SUPPORT
@@ -456,6 +470,19 @@ HPSOCKET_API BOOL __HP_CALL HP_Server_SendPackets(HP_Server pServer, HP_CONNID d
 */
 HPSOCKET_API BOOL __HP_CALL HP_Server_PauseReceive(HP_Server pServer, HP_CONNID dwConnID, BOOL bPause);
 
+/*
+* 名称：投递连接任务
+* 描述：在连接所属的工作线程中执行任务，任务与该连接的事件处理串行执行（不需要对连接状态加锁）
+*		任务总是被执行一次：如果任务执行前连接已关闭，则以 bValid = FALSE 执行（用于释放 pvArg）
+*		
+* 参数：		dwConnID	-- 连接 ID
+*			fnProc		-- 任务处理函数
+*			pvArg		-- 自定义参数
+* 返回值：	TRUE	-- 成功
+*			FALSE	-- 失败，可通过 SYS_GetLastError() 获取错误代码（任务不会被执行）
+*/
+HPSOCKET_API BOOL __HP_CALL HP_Server_Post(HP_Server pServer, HP_CONNID dwConnID, HP_Fn_ConnTaskProc fnProc, PVOID pvArg);
+
 /*
 * 名称：断开连接
 * 描述：断开与某个客户端的连接
@@ -534,6 +561,8 @@ HPSOCKET_API BOOL __HP_CALL HP_Server_IsConnected(HP_Server pServer, HP_CONNID d
 HPSOCKET_API DWORD __HP_CALL HP_Server_GetConnectionCount(HP_Server pServer);
 /* 获取所有连接的 HP_CONNID */
 HPSOCKET_API BOOL __HP_CALL HP_Server_GetAllConnectionIDs(HP_Server pServer, HP_CONNID pIDs[], DWORD* pdwCount);
+/* 获取工作线程运行统计快照（pStats 为空或 *pdwCount 小于工作线程数量时返回 FALSE，并通过 *pdwCount 返回工作线程数量） */
+HPSOCKET_API BOOL __HP_CALL HP_Server_GetWorkerStats(HP_Server pServer, HP_TWorkerStats pStats[], DWORD* pdwCount);
 /* 获取某个客户端连接时长（毫秒） */
 HPSOCKET_API BOOL __HP_CALL HP_Server_GetConnectPeriod(HP_Server pServer, HP_CONNID dwConnID, DWORD* pdwPeriod);
 /* 获取某个连接静默时间（毫秒） */
@@ -547,7 +576,7 @@ HPSOCKET_API BOOL __HP_CALL HP_Server_GetRemoteAddress(HP_Server pServer, HP_CON
 
 /* 设置地址重用选项 */
 HPSOCKET_API void __HP_CALL HP_Server_SetReuseAddressPolicy(HP_Server pServer, En_HP_ReuseAddressPolicy enReusePolicy);
-/* 设置数据发送策略（对 Linux 平台组件无效） */
+/* 设置数据发送策略（Linux 平台 TCP 组件支持 SP_DIRECT：连接没有待发送数据时在调用线程中直接发送，只缓存未发送的剩余数据，直接发送的数据在调用线程中触发 OnSend 事件（触发时持有该连接的发送锁，OnSend 中不要执行耗时操作或等待其它线程）；其它策略等同于 SP_PACK） */
 HPSOCKET_API void __HP_CALL HP_Server_SetSendPolicy(HP_Server pServer, En_HP_SendPolicy enSendPolicy);
 /* 设置 OnSend 事件同步策略（对 Linux 平台组件无效） */
 HPSOCKET_API void __HP_CALL HP_Server_SetOnSendSyncPolicy(HP_Server pServer, En_HP_OnSendSyncPolicy enSyncPolicy);
@@ -567,10 +596,12 @@ HPSOCKET_API void __HP_CALL HP_Server_SetMaxConnectionCount(HP_Server pServer, D
 HPSOCKET_API void __HP_CALL HP_Server_SetWorkerThreadCount(HP_Server pServer, DWORD dwWorkerThreadCount);
 /* 设置是否标记静默时间（设置为 TRUE 时 DisconnectSilenceConnections() 和 GetSilencePeriod() 才有效，默认：TRUE） */
 HPSOCKET_API void __HP_CALL HP_Server_SetMarkSilence(HP_Server pServer, BOOL bMarkSilence);
+/* 设置工作线程 CPU 亲和策略（lpszCpuList：CAP_LIST 策略的 CPU 列表，格式如 "0-3,8,10"） */
+HPSOCKET_API void __HP_CALL HP_Server_SetCpuAffinity(HP_Server pServer, En_HP_CpuAffinityPolicy enPolicy, LPCTSTR lpszCpuList);
 
 /* 获取地址重用选项 */
 HPSOCKET_API En_HP_ReuseAddressPolicy __HP_CALL HP_Server_GetReuseAddressPolicy(HP_Server pServer);
-/* 获取数据发送策略（对 Linux 平台组件无效） */
+/* 获取数据发送策略 */
 HPSOCKET_API En_HP_SendPolicy __HP_CALL HP_Server_GetSendPolicy(HP_Server pServer);
 /* 获取 OnSend 事件同步策略（对 Linux 平台组件无效） */
 HPSOCKET_API En_HP_OnSendSyncPolicy __HP_CALL HP_Server_GetOnSendSyncPolicy(HP_Server pServer);
@@ -590,6 +621,10 @@ HPSOCKET_API DWORD __HP_CALL HP_Server_GetMaxConnectionCount(HP_Server pServer);
 HPSOCKET_API DWORD __HP_CALL HP_Server_GetWorkerThreadCount(HP_Server pServer);
 /* 检测是否标记静默时间 */
 HPSOCKET_API BOOL __HP_CALL HP_Server_IsMarkSilence(HP_Server pServer);
+/* 获取工作线程 CPU 亲和策略 */
+HPSOCKET_API En_HP_CpuAffinityPolicy __HP_CALL HP_Server_GetCpuAffinityPolicy(HP_Server pServer);
+/* 获取工作线程 CPU 亲和列表 */
+HPSOCKET_API LPCTSTR __HP_CALL HP_Server_GetCpuAffinityList(HP_Server pServer);
 
 /**********************************************************************************/
 /******************************* TCP Server 操作方法 *******************************/
@@ -607,6 +642,90 @@ HPSOCKET_API BOOL __HP_CALL HP_Server_IsMarkSilence(HP_Server pServer);
 */
 HPSOCKET_API BOOL __HP_CALL HP_TcpServer_SendSmallFile(HP_Server pServer, HP_CONNID dwConnID, LPCTSTR lpszFileName, const LPWSABUF pHead, const LPWSABUF pTail);
 
+/*
+* 名称：以引用方式发送多组数据
+* 描述：向指定连接顺序发送多组数据，较大的数据块不复制到发送缓冲区而是直接引用用户缓冲区，
+*		用户缓冲区必须保持有效直到 fnRelease 被调用（数据全部发送完毕或连接关闭后调用）；
+*		无论发送成功与否 fnRelease 都会被调用一次，fnRelease 为 NULL 时等同于 SendPackets()
+*		
+* 参数：		dwConnID	-- 连接 ID
+*			pBuffers	-- 发送缓冲区数组
+*			iCount		-- 发送缓冲区数目
+*			fnRelease	-- 发送缓冲区释放函数
+*			pvArg		-- 自定义参数（传递给 fnRelease）
+* 返回值：	TRUE	-- 成功
+*			FALSE	-- 失败，可通过 SYS_GetLastError() 获取系统错误代码
+*/
+HPSOCKET_API BOOL __HP_CALL HP_TcpServer_SendRefPackets(HP_Server pServer, HP_CONNID dwConnID, const WSABUF pBuffers[], int iCount, HP_Fn_SendBufferRelease fnRelease, PVOID pvArg);
+
+/*
+* 名称：发送文件
+* 描述：向指定连接发送文件的指定范围（不限文件大小），文件数据在连接可写时由工作线程通过 sendfile() 分块发送，
+*		不复制到发送缓冲区，也不触发 OnSend 事件；pHead、pTail 的数据被复制到发送缓冲区；
+*		fnComplete 在全部数据发送完毕或连接关闭后调用，无论发送成功与否都会被调用一次；
+*		SSL 与 Pack 组件读取文件数据后以普通方式发送（受 4096 KB 限制），数据加入发送缓冲区后即调用 fnComplete
+*		
+* 参数：		dwConnID	-- 连接 ID
+*			lpszFileName-- 文件路径
+*			ullOffset	-- 文件偏移量
+*			ullLength	-- 发送长度（0 则发送到文件末尾）
+*			pHead		-- 头部附加数据
+*			pTail		-- 尾部附加数据
+*			fnComplete	-- 发送完成回调函数
+*			pvArg		-- 自定义参数（传递给 fnComplete）
+* 返回值：	TRUE	-- 成功
+*			FALSE	-- 失败，可通过 SYS_GetLastError() 获取系统错误代码
+*/
+HPSOCKET_API BOOL __HP_CALL HP_TcpServer_SendFile(HP_Server pServer, HP_CONNID dwConnID, LPCTSTR lpszFileName, ULONGLONG ullOffset, ULONGLONG ullLength, const LPWSABUF pHead, const LPWSABUF pTail, HP_Fn_SendBufferRelease fnComplete, PVOID pvArg);
+
+/*
+* 名称：发送暂存数据
+* 描述：立即发送指定连接因发送合并而暂存的数据（参考 HP_TcpServer_SetCoalesceSize()），没有暂存数据时不做任何操作
+*		
+* 参数：		dwConnID	-- 连接 ID
+* 返回值：	TRUE	-- 成功
+*			FALSE	-- 失败，可通过 SYS_GetLastError() 获取系统错误代码
+*/
+HPSOCKET_API BOOL __HP_CALL HP_TcpServer_Flush(HP_Server pServer, HP_CONNID dwConnID);
+
+/*
+* 名称：设置连接的发送合并阈值
+* 描述：覆盖组件的发送合并阈值（参考 HP_TcpServer_SetCoalesceSize()），0 则关闭该连接的发送合并；
+*		新阈值不大于已暂存数据的长度时立即发送暂存数据
+*		
+* 参数：		dwConnID		-- 连接 ID
+*			dwCoalesceSize	-- 发送合并阈值（字节）
+* 返回值：	TRUE	-- 成功
+*			FALSE	-- 失败，可通过 SYS_GetLastError() 获取系统错误代码
+*/
+HPSOCKET_API BOOL __HP_CALL HP_TcpServer_SetConnectionCoalesceSize(HP_Server pServer, HP_CONNID dwConnID, DWORD dwCoalesceSize);
+
+/*
+* 名称：广播发送多组数据
+* 描述：向多个连接发送同一组数据，数据（含 Pack 包头）只复制一次到共享缓冲区，各连接的发送缓冲区以引用方式共享，
+*		全部连接发送完毕或关闭后回收；需要唤醒工作线程的连接按工作线程合并为一个命令；
+*		无效连接与达到发送缓冲区高水位的连接被跳过；SSL 组件对每个连接分别加密发送
+*		
+* 参数：		pIDs		-- 连接 ID 数组
+*			dwCount		-- 连接 ID 数目
+*			pBuffers	-- 发送缓冲区数组
+*			iCount		-- 发送缓冲区数目
+* 返回值：	TRUE	-- 成功（至少一个连接发送成功）
+*			FALSE	-- 失败，可通过 SYS_GetLastError() 获取系统错误代码
+*/
+HPSOCKET_API BOOL __HP_CALL HP_TcpServer_Broadcast(HP_Server pServer, const HP_CONNID pIDs[], DWORD dwCount, const WSABUF pBuffers[], int iCount);
+
+/*
+* 名称：向所有连接广播发送多组数据
+* 描述：向当前所有连接发送同一组数据（参考 HP_TcpServer_Broadcast()）
+*		
+* 参数：		pBuffers	-- 发送缓冲区数组
+*			iCount		-- 发送缓冲区数目
+* 返回值：	TRUE	-- 成功（至少一个连接发送成功）
+*			FALSE	-- 失败，可通过 SYS_GetLastError() 获取系统错误代码
+*/
+HPSOCKET_API BOOL __HP_CALL HP_TcpServer_BroadcastAll(HP_Server pServer, const WSABUF pBuffers[], int iCount);
+
 /**********************************************************************************/
 /***************************** TCP Server 属性访问方法 *****************************/
 
@@ -614,6 +733,10 @@ HPSOCKET_API BOOL __HP_CALL HP_TcpServer_SendSmallFile(HP_Server pServer, HP_CON
 HPSOCKET_API void __HP_CALL HP_TcpServer_SetSocketListenQueue(HP_TcpServer pServer, DWORD dwSocketListenQueue);
 /* 设置 EPOLL 等待事件的最大数量 */
 HPSOCKET_API void __HP_CALL HP_TcpServer_SetAcceptSocketCount(HP_TcpServer pServer, DWORD dwAcceptSocketCount);
+/* 设置每次唤醒最多接受的连接数（0 则不限制，默认：64；防止大量连接涌入时饿死已建立的连接） */
+HPSOCKET_API void __HP_CALL HP_TcpServer_SetAcceptBudget(HP_TcpServer pServer, DWORD dwAcceptBudget);
+/* 设置延迟接受时间（毫秒，0 则不开启，默认：0；开启后使用 TCP_DEFER_ACCEPT，连接收到首个数据包时才被接受，适用于客户端先发送数据的协议） */
+HPSOCKET_API void __HP_CALL HP_TcpServer_SetDeferAcceptTime(HP_TcpServer pServer, DWORD dwDeferAcceptTime);
 /* 设置通信数据缓冲区大小（根据平均通信数据包大小调整设置，通常设置为 1024 的倍数） */
 HPSOCKET_API void __HP_CALL HP_TcpServer_SetSocketBufferSize(HP_TcpServer pServer, DWORD dwSocketBufferSize);
 /* 设置正常心跳包间隔（毫秒，0 则不发送心跳包，默认：60 * 1000） */
@@ -622,9 +745,39 @@ HPSOCKET_API void __HP_CALL HP_TcpServer_SetKeepAliveTime(HP_TcpServer pServer,
 HPSOCKET_API void __HP_CALL HP_TcpServer_SetKeepAliveInterval(HP_TcpServer pServer, DWORD dwKeepAliveInterval);
 /* 设置是否开启 nodelay 模式（默认：FALSE，不开启） */
 HPSOCKET_API void __HP_CALL HP_TcpServer_SetNoDelay(HP_TcpServer pServer, BOOL bNoDelay);
+/* 设置是否使用 io_uring 分发 IO 事件（默认：FALSE，使用 EPOLL；内核不支持 io_uring 时自动回退为 EPOLL） */
+HPSOCKET_API void __HP_CALL HP_TcpServer_SetUseIOUring(HP_TcpServer pServer, BOOL bUseIOUring);
+/* 设置忙轮询时间（微秒，0 则不开启低延迟忙轮询模式，默认：0；开启后工作线程在休眠前自旋轮询 IO 事件，并对连接开启 SO_BUSY_POLL 和 TCP_QUICKACK） */
+HPSOCKET_API void __HP_CALL HP_TcpServer_SetBusyPollTime(HP_TcpServer pServer, DWORD dwBusyPollTime);
+/* 设置工作线程负载均衡阈值（百分比，0 - 100，0 则不开启，默认：0；工作线程间的繁忙率差值达到该值时，把最繁忙工作线程上的活跃连接迁移到最空闲的工作线程） */
+HPSOCKET_API void __HP_CALL HP_TcpServer_SetRebalanceThreshold(HP_TcpServer pServer, DWORD dwRebalanceThreshold);
+/* 设置 MSG_ZEROCOPY 发送阈值（0 则不启用，默认：0；长度大于等于该值的发送数据块以 MSG_ZEROCOPY 方式发送，直至内核通知完成后才回收缓冲区，建议配合 SendRefPackets() 使用并设置为 32KB 以上） */
+HPSOCKET_API void __HP_CALL HP_TcpServer_SetZeroCopyThreshold(HP_TcpServer pServer, DWORD dwZeroCopyThreshold);
+/* 设置发送合并阈值（字节，0 则不合并，默认：0；开启后连接空闲时发送的数据先暂存，累计达到该值、超过合并延迟或调用 HP_TcpServer_Flush() 时才一次发送，适用于大量小数据包的场景） */
+HPSOCKET_API void __HP_CALL HP_TcpServer_SetCoalesceSize(HP_TcpServer pServer, DWORD dwCoalesceSize);
+/* 设置发送合并延迟（毫秒，0 则只在达到合并阈值或调用 HP_TcpServer_Flush() 时发送，默认：1） */
+HPSOCKET_API void __HP_CALL HP_TcpServer_SetCoalesceDelay(HP_TcpServer pServer, DWORD dwCoalesceDelay);
+/* 设置发送缓冲区高水位（字节，0 则不限制，默认：0；连接待发送数据达到该值时触发 OnSendBufferHigh 事件，此后的发送操作均失败并返回 ERROR_NOT_ENOUGH_QUOTA，直到回落到低水位并触发 OnSendBufferDrained 事件） */
+HPSOCKET_API void __HP_CALL HP_TcpServer_SetSendHighWatermark(HP_TcpServer pServer, DWORD dwSendHighWatermark);
+/* 设置发送缓冲区低水位（字节，必须小于高水位，默认：0） */
+HPSOCKET_API void __HP_CALL HP_TcpServer_SetSendLowWatermark(HP_TcpServer pServer, DWORD dwSendLowWatermark);
+/* 设置内核未发送数据低水位（字节，0 则不启用，默认：0；对连接设置 TCP_NOTSENT_LOWAT，内核中未发送的数据低于该值时才继续写入，其余数据保留在发送缓冲区中，可降低交互消息与大数据共用连接时的排队延迟） */
+HPSOCKET_API void __HP_CALL HP_TcpServer_SetNotSentLowat(HP_TcpServer pServer, DWORD dwNotSentLowat);
+/* 设置每次处理接收事件最多读取的字节数（0 则不限制，默认：Socket 缓冲区大小的 100 倍；连接超出预算后让出工作线程，剩余数据在下一轮事件循环中继续读取，防止高速连接长时间独占工作线程） */
+HPSOCKET_API void __HP_CALL HP_TcpServer_SetReadBudget(HP_TcpServer pServer, DWORD dwReadBudget);
+/* 设置每次处理发送事件最多写入的字节数（0 则不限制，默认：0；连接超出预算后让出工作线程，剩余数据在下一轮事件循环中继续发送） */
+HPSOCKET_API void __HP_CALL HP_TcpServer_SetWriteBudget(HP_TcpServer pServer, DWORD dwWriteBudget);
+/* 设置每次处理接收或发送事件的最长时间（微秒，0 则不限制，默认：0；与读写字节预算同时生效，任一预算用完即让出工作线程） */
+HPSOCKET_API void __HP_CALL HP_TcpServer_SetIoTimeBudget(HP_TcpServer pServer, DWORD dwIoTimeBudget);
+/* 设置空闲连接超时时间（毫秒，0 则不启用，默认：0；须开启 MarkSilence，每个连接在所属工作线程的时间轮上挂接定时器，超过该时间没有收到数据的连接被自动断开，无需定期调用 DisconnectSilenceConnections() 扫描全部连接） */
+HPSOCKET_API void __HP_CALL HP_TcpServer_SetIdleTimeout(HP_TcpServer pServer, DWORD dwIdleTimeout);
 
 /* 获取 EPOLL 等待事件的最大数量 */
 HPSOCKET_API DWORD __HP_CALL HP_TcpServer_GetAcceptSocketCount(HP_TcpServer pServer);
+/* 获取每次唤醒最多接受的连接数 */
+HPSOCKET_API DWORD __HP_CALL HP_TcpServer_GetAcceptBudget(HP_TcpServer pServer);
+/* 获取延迟接受时间 */
+HPSOCKET_API DWORD __HP_CALL HP_TcpServer_GetDeferAcceptTime(HP_TcpServer pServer);
 /* 获取通信数据缓冲区大小 */
 HPSOCKET_API DWORD __HP_CALL HP_TcpServer_GetSocketBufferSize(HP_TcpServer pServer);
 /* 获取监听 Socket 的等候队列大小 */
@@ -635,6 +788,32 @@ HPSOCKET_API DWORD __HP_CALL HP_TcpServer_GetKeepAliveTime(HP_TcpServer pServer)
 HPSOCKET_API DWORD __HP_CALL HP_TcpServer_GetKeepAliveInterval(HP_TcpServer pServer);
 /* 检查是否开启 nodelay 模式 */
 HPSOCKET_API BOOL __HP_CALL HP_TcpServer_IsNoDelay(HP_TcpServer pServer);
+/* 检查是否使用 io_uring 分发 IO 事件 */
+HPSOCKET_API BOOL __HP_CALL HP_TcpServer_IsUseIOUring(HP_TcpServer pServer);
+/* 获取忙轮询时间 */
+HPSOCKET_API DWORD __HP_CALL HP_TcpServer_GetBusyPollTime(HP_TcpServer pServer);
+/* 获取工作线程负载均衡阈值 */
+HPSOCKET_API DWORD __HP_CALL HP_TcpServer_GetRebalanceThreshold(HP_TcpServer pServer);
+/* 获取 MSG_ZEROCOPY 发送阈值 */
+HPSOCKET_API DWORD __HP_CALL HP_TcpServer_GetZeroCopyThreshold(HP_TcpServer pServer);
+/* 获取发送合并阈值 */
+HPSOCKET_API DWORD __HP_CALL HP_TcpServer_GetCoalesceSize(HP_TcpServer pServer);
+/* 获取发送合并延迟 */
+HPSOCKET_API DWORD __HP_CALL HP_TcpServer_GetCoalesceDelay(HP_TcpServer pServer);
+/* 获取发送缓冲区高水位 */
+HPSOCKET_API DWORD __HP_CALL HP_TcpServer_GetSendHighWatermark(HP_TcpServer pServer);
+/* 获取发送缓冲区低水位 */
+HPSOCKET_API DWORD __HP_CALL HP_TcpServer_GetSendLowWatermark(HP_TcpServer pServer);
+/* 获取内核未发送数据低水位 */
+HPSOCKET_API DWORD __HP_CALL HP_TcpServer_GetNotSentLowat(HP_TcpServer pServer);
+/* 获取每次处理接收事件最多读取的字节数 */
+HPSOCKET_API DWORD __HP_CALL HP_TcpServer_GetReadBudget(HP_TcpServer pServer);
+/* 获取每次处理发送事件最多写入的字节数 */
+HPSOCKET_API DWORD __HP_CALL HP_TcpServer_GetWriteBudget(HP_TcpServer pServer);
+/* 获取每次处理接收或发送事件的最长时间 */
+HPSOCKET_API DWORD __HP_CALL HP_TcpServer_GetIoTimeBudget(HP_TcpServer pServer);
+/* 获取空闲连接超时时间 */
+HPSOCKET_API DWORD __HP_CALL HP_TcpServer_GetIdleTimeout(HP_TcpServer pServer);
 
 #ifdef _UDP_SUPPORT
 
@@ -878,6 +1057,19 @@ HPSOCKET_API BOOL __HP_CALL HP_Agent_SendPackets(HP_Agent pAgent, HP_CONNID dwCo
 */
 HPSOCKET_API BOOL __HP_CALL HP_Agent_PauseReceive(HP_Agent pAgent, HP_CONNID dwConnID, BOOL bPause);
 
+/*
+* 名称：投递连接任务
+* 描述：在连接所属的工作线程中执行任务，任务与该连接的事件处理串行执行（不需要对连接状态加锁）
+*		任务总是被执行一次：如果任务执行前连接已关闭，则以 bValid = FALSE 执行（用于释放 pvArg）
+*		
+* 参数：		dwConnID	-- 连接 ID
+*			fnProc		-- 任务处理函数
+*			pvArg		-- 自定义参数
+* 返回值：	TRUE	-- 成功
+*			FALSE	-- 失败，可通过 SYS_GetLastError() 获取错误代码（任务不会被执行）
+*/
+HPSOCKET_API BOOL __HP_CALL HP_Agent_Post(HP_Agent pAgent, HP_CONNID dwConnID, HP_Fn_ConnTaskProc fnProc, PVOID pvArg);
+
 /*
 * 名称：断开连接
 * 描述：断开某个连接
@@ -946,6 +1138,8 @@ HPSOCKET_API En_HP_ServiceState __HP_CALL HP_Agent_GetState(HP_Agent pAgent);
 HPSOCKET_API DWORD __HP_CALL HP_Agent_GetConnectionCount(HP_Agent pAgent);
 /* 获取所有连接的 HP_CONNID */
 HPSOCKET_API BOOL __HP_CALL HP_Agent_GetAllConnectionIDs(HP_Agent pAgent, HP_CONNID pIDs[], DWORD* pdwCount);
+/* 获取工作线程运行统计快照（pStats 为空或 *pdwCount 小于工作线程数量时返回 FALSE，并通过 *pdwCount 返回工作线程数量） */
+HPSOCKET_API BOOL __HP_CALL HP_Agent_GetWorkerStats(HP_Agent pAgent, HP_TWorkerStats pStats[], DWORD* pdwCount);
 /* 获取某个连接时长（毫秒） */
 HPSOCKET_API BOOL __HP_CALL HP_Agent_GetConnectPeriod(HP_Agent pAgent, HP_CONNID dwConnID, DWORD* pdwPeriod);
 /* 获取某个连接静默时间（毫秒） */
@@ -969,7 +1163,7 @@ HPSOCKET_API BOOL __HP_CALL HP_Agent_IsConnected(HP_Agent pAgent, HP_CONNID dwCo
 
 /* 设置地址重用选项 */
 HPSOCKET_API void __HP_CALL HP_Agent_SetReuseAddressPolicy(HP_Agent pAgent, En_HP_ReuseAddressPolicy enReusePolicy);
-/* 设置数据发送策略（对 Linux 平台组件无效） */
+/* 设置数据发送策略（Linux 平台 TCP 组件支持 SP_DIRECT：连接没有待发送数据时在调用线程中直接发送，只缓存未发送的剩余数据，直接发送的数据在调用线程中触发 OnSend 事件（触发时持有该连接的发送锁，OnSend 中不要执行耗时操作或等待其它线程）；其它策略等同于 SP_PACK） */
 HPSOCKET_API void __HP_CALL HP_Agent_SetSendPolicy(HP_Agent pAgent, En_HP_SendPolicy enSendPolicy);
 /* 设置 OnSend 事件同步策略（对 Linux 平台组件无效） */
 HPSOCKET_API void __HP_CALL HP_Agent_SetOnSendSyncPolicy(HP_Agent pAgent, En_HP_OnSendSyncPolicy enSyncPolicy);
@@ -989,10 +1183,12 @@ HPSOCKET_API void __HP_CALL HP_Agent_SetMaxConnectionCount(HP_Agent pAgent, DWOR
 HPSOCKET_API void __HP_CALL HP_Agent_SetWorkerThreadCount(HP_Agent pAgent, DWORD dwWorkerThreadCount);
 /* 设置是否标记静默时间（设置为 TRUE 时 DisconnectSilenceConnections() 和 GetSilencePeriod() 才有效，默认：TRUE） */
 HPSOCKET_API void __HP_CALL HP_Agent_SetMarkSilence(HP_Agent pAgent, BOOL bMarkSilence);
+/* 设置工作线程 CPU 亲和策略（lpszCpuList：CAP_LIST 策略的 CPU 列表，格式如 "0-3,8,10"） */
+HPSOCKET_API void __HP_CALL HP_Agent_SetCpuAffinity(HP_Agent pAgent, En_HP_CpuAffinityPolicy enPolicy, LPCTSTR lpszCpuList);
 
 /* 获取地址重用选项 */
 HPSOCKET_API En_HP_ReuseAddressPolicy __HP_CALL HP_Agent_GetReuseAddressPolicy(HP_Agent pAgent);
-/* 获取数据发送策略（对 Linux 平台组件无效） */
+/* 获取数据发送策略 */
 HPSOCKET_API En_HP_SendPolicy __HP_CALL HP_Agent_GetSendPolicy(HP_Agent pAgent);
 /* 获取 OnSend 事件同步策略（对 Linux 平台组件无效） */
 HPSOCKET_API En_HP_OnSendSyncPolicy __HP_CALL HP_Agent_GetOnSendSyncPolicy(HP_Agent pAgent);
@@ -1012,6 +1208,10 @@ HPSOCKET_API DWORD __HP_CALL HP_Agent_GetMaxConnectionCount(HP_Agent pAgent);
 HPSOCKET_API DWORD __HP_CALL HP_Agent_GetWorkerThreadCount(HP_Agent pAgent);
 /* 检测是否标记静默时间 */
 HPSOCKET_API BOOL __HP_CALL HP_Agent_IsMarkSilence(HP_Agent pAgent);
+/* 获取工作线程 CPU 亲和策略 */
+HPSOCKET_API En_HP_CpuAffinityPolicy __HP_CALL HP_Agent_GetCpuAffinityPolicy(HP_Agent pAgent);
+/* 获取工作线程 CPU 亲和列表 */
+HPSOCKET_API LPCTSTR __HP_CALL HP_Agent_GetCpuAffinityList(HP_Agent pAgent);
 
 /**********************************************************************************/
 /******************************* TCP Agent 操作方法 *******************************/
@@ -1029,6 +1229,64 @@ HPSOCKET_API BOOL __HP_CALL HP_Agent_IsMarkSilence(HP_Agent pAgent);
 */
 HPSOCKET_API BOOL __HP_CALL HP_TcpAgent_SendSmallFile(HP_Agent pAgent, HP_CONNID dwConnID, LPCTSTR lpszFileName, const LPWSABUF pHead, const LPWSABUF pTail);
 
+/*
+* 名称：以引用方式发送多组数据
+* 描述：向指定连接顺序发送多组数据，较大的数据块不复制到发送缓冲区而是直接引用用户缓冲区，
+*		用户缓冲区必须保持有效直到 fnRelease 被调用（数据全部发送完毕或连接关闭后调用）；
+*		无论发送成功与否 fnRelease 都会被调用一次，fnRelease 为 NULL 时等同于 SendPackets()
+*		
+* 参数：		dwConnID	-- 连接 ID
+*			pBuffers	-- 发送缓冲区数组
+*			iCount		-- 发送缓冲区数目
+*			fnRelease	-- 发送缓冲区释放函数
+*			pvArg		-- 自定义参数（传递给 fnRelease）
+* 返回值：	TRUE	-- 成功
+*			FALSE	-- 失败，可通过 SYS_GetLastError() 获取系统错误代码
+*/
+HPSOCKET_API BOOL __HP_CALL HP_TcpAgent_SendRefPackets(HP_Agent pAgent, HP_CONNID dwConnID, const WSABUF pBuffers[], int iCount, HP_Fn_SendBufferRelease fnRelease, PVOID pvArg);
+
+/*
+* 名称：发送文件
+* 描述：向指定连接发送文件的指定范围（不限文件大小），文件数据在连接可写时由工作线程通过 sendfile() 分块发送，
+*		不复制到发送缓冲区，也不触发 OnSend 事件；pHead、pTail 的数据被复制到发送缓冲区；
+*		fnComplete 在全部数据发送完毕或连接关闭后调用，无论发送成功与否都会被调用一次；
+*		SSL 与 Pack 组件读取文件数据后以普通方式发送（受 4096 KB 限制），数据加入发送缓冲区后即调用 fnComplete
+*		
+* 参数：		dwConnID	-- 连接 ID
+*			lpszFileName-- 文件路径
+*			ullOffset	-- 文件偏移量
+*			ullLength	-- 发送长度（0 则发送到文件末尾）
+*			pHead		-- 头部附加数据
+*			pTail		-- 尾部附加数据
+*			fnComplete	-- 发送完成回调函数
+*			pvArg		-- 自定义参数（传递给 fnComplete）
+* 返回值：	TRUE	-- 成功
+*			FALSE	-- 失败，可通过 SYS_GetLastError() 获取系统错误代码
+*/
+HPSOCKET_API BOOL __HP_CALL HP_TcpAgent_SendFile(HP_Agent pAgent, HP_CONNID dwConnID, LPCTSTR lpszFileName, ULONGLONG ullOffset, ULONGLONG ullLength, const LPWSABUF pHead, const LPWSABUF pTail, HP_Fn_SendBufferRelease fnComplete, PVOID pvArg);
+
+/*
+* 名称：发送暂存数据
+* 描述：立即发送指定连接因发送合并而暂存的数据（参考 HP_TcpAgent_SetCoalesceSize()），没有暂存数据时不做任何操作
+*		
+* 参数：		dwConnID	-- 连接 ID
+* 返回值：	TRUE	-- 成功
+*			FALSE	-- 失败，可通过 SYS_GetLastError() 获取系统错误代码
+*/
+HPSOCKET_API BOOL __HP_CALL HP_TcpAgent_Flush(HP_Agent pAgent, HP_CONNID dwConnID);
+
+/*
+* 名称：设置连接的发送合并阈值
+* 描述：覆盖组件的发送合并阈值（参考 HP_TcpAgent_SetCoalesceSize()），0 则关闭该连接的发送合并；
+*		新阈值不大于已暂存数据的长度时立即发送暂存数据
+*		
+* 参数：		dwConnID		-- 连接 ID
+*			dwCoalesceSize	-- 发送合并阈值（字节）
+* 返回值：	TRUE	-- 成功
+*			FALSE	-- 失败，可通过 SYS_GetLastError() 获取系统错误代码
+*/
+HPSOCKET_API BOOL __HP_CALL HP_TcpAgent_SetConnectionCoalesceSize(HP_Agent pAgent, HP_CONNID dwConnID, DWORD dwCoalesceSize);
+
 /**********************************************************************************/
 /***************************** TCP Agent 属性访问方法 *****************************/
 
@@ -1042,6 +1300,30 @@ HPSOCKET_API void __HP_CALL HP_TcpAgent_SetKeepAliveTime(HP_TcpAgent pAgent, DWO
 HPSOCKET_API void __HP_CALL HP_TcpAgent_SetKeepAliveInterval(HP_TcpAgent pAgent, DWORD dwKeepAliveInterval);
 /* 设置是否开启 nodelay 模式（默认：FALSE，不开启） */
 HPSOCKET_API void __HP_CALL HP_TcpAgent_SetNoDelay(HP_TcpAgent pAgent, BOOL bNoDelay);
+/* 设置是否使用 io_uring 分发 IO 事件（默认：FALSE，使用 EPOLL；内核不支持 io_uring 时自动回退为 EPOLL） */
+HPSOCKET_API void __HP_CALL HP_TcpAgent_SetUseIOUring(HP_TcpAgent pAgent, BOOL bUseIOUring);
+/* 设置忙轮询时间（微秒，0 则不开启低延迟忙轮询模式，默认：0；开启后工作线程在休眠前自旋轮询 IO 事件，并对连接开启 SO_BUSY_POLL 和 TCP_QUICKACK） */
+HPSOCKET_API void __HP_CALL HP_TcpAgent_SetBusyPollTime(HP_TcpAgent pAgent, DWORD dwBusyPollTime);
+/* 设置工作线程负载均衡阈值（百分比，0 - 100，0 则不开启，默认：0；工作线程间的繁忙率差值达到该值时，把最繁忙工作线程上的活跃连接迁移到最空闲的工作线程） */
+HPSOCKET_API void __HP_CALL HP_TcpAgent_SetRebalanceThreshold(HP_TcpAgent pAgent, DWORD dwRebalanceThreshold);
+/* 设置 MSG_ZEROCOPY 发送阈值（0 则不启用，默认：0；长度大于等于该值的发送数据块以 MSG_ZEROCOPY 方式发送，直至内核通知完成后才回收缓冲区，建议配合 SendRefPackets() 使用并设置为 32KB 以上） */
+HPSOCKET_API void __HP_CALL HP_TcpAgent_SetZeroCopyThreshold(HP_TcpAgent pAgent, DWORD dwZeroCopyThreshold);
+/* 设置发送合并阈值（字节，0 则不合并，默认：0；开启后连接空闲时发送的数据先暂存，累计达到该值、超过合并延迟或调用 HP_TcpAgent_Flush() 时才一次发送，适用于大量小数据包的场景） */
+HPSOCKET_API void __HP_CALL HP_TcpAgent_SetCoalesceSize(HP_TcpAgent pAgent, DWORD dwCoalesceSize);
+/* 设置发送合并延迟（毫秒，0 则只在达到合并阈值或调用 HP_TcpAgent_Flush() 时发送，默认：1） */
+HPSOCKET_API void __HP_CALL HP_TcpAgent_SetCoalesceDelay(HP_TcpAgent pAgent, DWORD dwCoalesceDelay);
+/* 设置发送缓冲区高水位（字节，0 则不限制，默认：0；连接待发送数据达到该值时触发 OnSendBufferHigh 事件，此后的发送操作均失败并返回 ERROR_NOT_ENOUGH_QUOTA，直到回落到低水位并触发 OnSendBufferDrained 事件） */
+HPSOCKET_API void __HP_CALL HP_TcpAgent_SetSendHighWatermark(HP_TcpAgent pAgent, DWORD dwSendHighWatermark);
+/* 设置发送缓冲区低水位（字节，必须小于高水位，默认：0） */
+HPSOCKET_API void __HP_CALL HP_TcpAgent_SetSendLowWatermark(HP_TcpAgent pAgent, DWORD dwSendLowWatermark);
+/* 设置内核未发送数据低水位（字节，0 则不启用，默认：0；对连接设置 TCP_NOTSENT_LOWAT，内核中未发送的数据低于该值时才继续写入，其余数据保留在发送缓冲区中，可降低交互消息与大数据共用连接时的排队延迟） */
+HPSOCKET_API void __HP_CALL HP_TcpAgent_SetNotSentLowat(HP_TcpAgent pAgent, DWORD dwNotSentLowat);
+/* 设置每次处理接收事件最多读取的字节数（0 则不限制，默认：Socket 缓冲区大小的 100 倍；连接超出预算后让出工作线程，剩余数据在下一轮事件循环中继续读取，防止高速连接长时间独占工作线程） */
+HPSOCKET_API void __HP_CALL HP_TcpAgent_SetReadBudget(HP_TcpAgent pAgent, DWORD dwReadBudget);
+/* 设置每次处理发送事件最多写入的字节数（0 则不限制，默认：0；连接超出预算后让出工作线程，剩余数据在下一轮事件循环中继续发送） */
+HPSOCKET_API void __HP_CALL HP_TcpAgent_SetWriteBudget(HP_TcpAgent pAgent, DWORD dwWriteBudget);
+/* 设置每次处理接收或发送事件的最长时间（微秒，0 则不限制，默认：0；与读写字节预算同时生效，任一预算用完即让出工作线程） */
+HPSOCKET_API void __HP_CALL HP_TcpAgent_SetIoTimeBudget(HP_TcpAgent pAgent, DWORD dwIoTimeBudget);
 
 /* 获取同步连接超时时间 */
 HPSOCKET_API DWORD __HP_CALL HP_TcpAgent_GetSyncConnectTimeout(HP_TcpAgent pAgent);
@@ -1053,6 +1335,30 @@ HPSOCKET_API DWORD __HP_CALL HP_TcpAgent_GetKeepAliveTime(HP_TcpAgent pAgent);
 HPSOCKET_API DWORD __HP_CALL HP_TcpAgent_GetKeepAliveInterval(HP_TcpAgent pAgent);
 /* 检查是否开启 nodelay 模式 */
 HPSOCKET_API BOOL __HP_CALL HP_TcpAgent_IsNoDelay(HP_TcpAgent pAgent);
+/* 检查是否使用 io_uring 分发 IO 事件 */
+HPSOCKET_API BOOL __HP_CALL HP_TcpAgent_IsUseIOUring(HP_TcpAgent pAgent);
+/* 获取忙轮询时间 */
+HPSOCKET_API DWORD __HP_CALL HP_TcpAgent_GetBusyPollTime(HP_TcpAgent pAgent);
+/* 获取工作线程负载均衡阈值 */
+HPSOCKET_API DWORD __HP_CALL HP_TcpAgent_GetRebalanceThreshold(HP_TcpAgent pAgent);
+/* 获取 MSG_ZEROCOPY 发送阈值 */
+HPSOCKET_API DWORD __HP_CALL HP_TcpAgent_GetZeroCopyThreshold(HP_TcpAgent pAgent);
+/* 获取发送合并阈值 */
+HPSOCKET_API DWORD __HP_CALL HP_TcpAgent_GetCoalesceSize(HP_TcpAgent pAgent);
+/* 获取发送合并延迟 */
+HPSOCKET_API DWORD __HP_CALL HP_TcpAgent_GetCoalesceDelay(HP_TcpAgent pAgent);
+/* 获取发送缓冲区高水位 */
+HPSOCKET_API DWORD __HP_CALL HP_TcpAgent_GetSendHighWatermark(HP_TcpAgent pAgent);
+/* 获取发送缓冲区低水位 */
+HPSOCKET_API DWORD __HP_CALL HP_TcpAgent_GetSendLowWatermark(HP_TcpAgent pAgent);
+/* 获取内核未发送数据低水位 */
+HPSOCKET_API DWORD __HP_CALL HP_TcpAgent_GetNotSentLowat(HP_TcpAgent pAgent);
+/* 获取每次处理接收事件最多读取的字节数 */
+HPSOCKET_API DWORD __HP_CALL HP_TcpAgent_GetReadBudget(HP_TcpAgent pAgent);
+/* 获取每次处理发送事件最多写入的字节数 */
+HPSOCKET_API DWORD __HP_CALL HP_TcpAgent_GetWriteBudget(HP_TcpAgent pAgent);
+/* 获取每次处理接收或发送事件的最长时间 */
+HPSOCKET_API DWORD __HP_CALL HP_TcpAgent_GetIoTimeBudget(HP_TcpAgent pAgent);
 
 /******************************************************************************/
 /***************************** Client 组件操作方法 *****************************/
@@ -1222,6 +1528,21 @@ HPSOCKET_API DWORD __HP_CALL HP_Client_GetFreeBufferPoolHold(HP_Client pClient);
 */
 HPSOCKET_API BOOL __HP_CALL HP_TcpClient_SendSmallFile(HP_Client pClient, LPCTSTR lpszFileName, const LPWSABUF pHead, const LPWSABUF pTail);
 
+/*
+* 名称：以引用方式发送多组数据
+* 描述：向服务端顺序发送多组数据，较大的数据块不复制到发送缓冲区而是直接引用用户缓冲区，
+*		用户缓冲区必须保持有效直到 fnRelease 被调用（数据全部发送完毕或连接关闭后调用）；
+*		无论发送成功与否 fnRelease 都会被调用一次，fnRelease 为 NULL 时等同于 SendPackets()
+*		
+* 参数：		pBuffers	-- 发送缓冲区数组
+*			iCount		-- 发送缓冲区数目
+*			fnRelease	-- 发送缓冲区释放函数
+*			pvArg		-- 自定义参数（传递给 fnRelease）
+* 返回值：	TRUE	-- 成功
+*			FALSE	-- 失败，可通过 SYS_GetLastError() 获取系统错误代码
+*/
+HPSOCKET_API BOOL __HP_CALL HP_TcpClient_SendRefPackets(HP_Client pClient, const WSABUF pBuffers[], int iCount, HP_Fn_SendBufferRelease fnRelease, PVOID pvArg);
+
 /**********************************************************************************/
 /***************************** TCP Client 属性访问方法 *****************************/
 
@@ -1486,6 +1807,8 @@ HPSOCKET_API BOOL __HP_CALL HP_UdpNode_GetCastAddress(HP_UdpNode pNode, TCHAR lp
 HPSOCKET_API En_HP_CastMode __HP_CALL HP_UdpNode_GetCastMode(HP_UdpNode pNode);
 /* 获取未发出数据的长度 */
 HPSOCKET_API BOOL __HP_CALL HP_UdpNode_GetPendingDataLength(HP_UdpNode pNode, int* piPending);
+/* 获取工作线程运行统计快照（pStats 为空或 *pdwCount 小于工作线程数量时返回 FALSE，并通过 *pdwCount 返回工作线程数量） */
+HPSOCKET_API BOOL __HP_CALL HP_UdpNode_GetWorkerStats(HP_UdpNode pNode, HP_TWorkerStats pStats[], DWORD* pdwCount);
 
 /* 设置数据报文最大长度（建议在局域网环境下不超过 1432 字节，在广域网环境下不超过 548 字节） */
 HPSOCKET_API void __HP_CALL HP_UdpNode_SetMaxDatagramSize(HP_UdpNode pNode, DWORD dwMaxDatagramSize);
@@ -1551,9 +1874,38 @@ HPSOCKET_API En_HP_FetchResult __HP_CALL HP_TcpPullServer_Fetch(HP_TcpPullServer
 */
 HPSOCKET_API En_HP_FetchResult __HP_CALL HP_TcpPullServer_Peek(HP_TcpPullServer pServer, HP_CONNID dwConnID, BYTE* pData, int iLength);
 
+/*
+* 名称：窥探数据视图（不会移除缓冲区数据，不复制数据）
+* 描述：用户通过该方法获取接收缓冲区中前 iLength 字节数据所在的连续内存段；
+*		内存段只在下一次 Fetch / Skip 或 OnReceive 事件返回前有效
+*		
+* 参数：		dwConnID	-- 连接 ID
+*			pBuffers	-- 内存段数组
+*			piCount		-- 内存段数组长度（输入：数组长度；输出：覆盖 iLength 字节所需的内存段数量）
+*			iLength		-- 窥探数据长度
+* 返回值：	En_HP_FetchResult（数据不足时返回 FR_LENGTH_TOO_LONG 且 *piCount 为 0；数组长度不足时返回 FR_LENGTH_TOO_LONG 且 *piCount 为所需数量）
+*/
+HPSOCKET_API En_HP_FetchResult __HP_CALL HP_TcpPullServer_PeekView(HP_TcpPullServer pServer, HP_CONNID dwConnID, WSABUF pBuffers[], int* piCount, int iLength);
+
+/*
+* 名称：跳过数据
+* 描述：用户通过该方法移除接收缓冲区中前 iLength 字节数据（通常在处理完 PeekView 获取的数据后调用）
+*		
+* 参数：		dwConnID	-- 连接 ID
+*			iLength		-- 跳过数据长度
+* 返回值：	En_HP_FetchResult
+*/
+HPSOCKET_API En_HP_FetchResult __HP_CALL HP_TcpPullServer_Skip(HP_TcpPullServer pServer, HP_CONNID dwConnID, int iLength);
+
 /***************************************************************************************/
 /***************************** TCP Pull Server 属性访问方法 *****************************/
 
+/* 设置是否启用直接接收（启用后数据通过 readv() 直接读取到连接接收缓冲区，省去一次内存复制；SSL 组件忽略该设置，默认：FALSE） */
+HPSOCKET_API void __HP_CALL HP_TcpPullServer_SetDirectReceive(HP_TcpPullServer pServer, BOOL bDirectReceive);
+
+/* 检测是否启用直接接收 */
+HPSOCKET_API BOOL __HP_CALL HP_TcpPullServer_IsDirectReceive(HP_TcpPullServer pServer);
+
 /***************************************************************************************/
 /***************************** TCP Pull Agent 组件操作方法 *****************************/
 
@@ -1579,9 +1931,38 @@ HPSOCKET_API En_HP_FetchResult __HP_CALL HP_TcpPullAgent_Fetch(HP_TcpPullAgent p
 */
 HPSOCKET_API En_HP_FetchResult __HP_CALL HP_TcpPullAgent_Peek(HP_TcpPullAgent pAgent, HP_CONNID dwConnID, BYTE* pData, int iLength);
 
+/*
+* 名称：窥探数据视图（不会移除缓冲区数据，不复制数据）
+* 描述：用户通过该方法获取接收缓冲区中前 iLength 字节数据所在的连续内存段；
+*		内存段只在下一次 Fetch / Skip 或 OnReceive 事件返回前有效
+*		
+* 参数：		dwConnID	-- 连接 ID
+*			pBuffers	-- 内存段数组
+*			piCount		-- 内存段数组长度（输入：数组长度；输出：覆盖 iLength 字节所需的内存段数量）
+*			iLength		-- 窥探数据长度
+* 返回值：	En_HP_FetchResult（数据不足时返回 FR_LENGTH_TOO_LONG 且 *piCount 为 0；数组长度不足时返回 FR_LENGTH_TOO_LONG 且 *piCount 为所需数量）
+*/
+HPSOCKET_API En_HP_FetchResult __HP_CALL HP_TcpPullAgent_PeekView(HP_TcpPullAgent pAgent, HP_CONNID dwConnID, WSABUF pBuffers[], int* piCount, int iLength);
+
+/*
+* 名称：跳过数据
+* 描述：用户通过该方法移除接收缓冲区中前 iLength 字节数据（通常在处理完 PeekView 获取的数据后调用）
+*		
+* 参数：		dwConnID	-- 连接 ID
+*			iLength		-- 跳过数据长度
+* 返回值：	En_HP_FetchResult
+*/
+HPSOCKET_API En_HP_FetchResult __HP_CALL HP_TcpPullAgent_Skip(HP_TcpPullAgent pAgent, HP_CONNID dwConnID, int iLength);
+
 /***************************************************************************************/
 /***************************** TCP Pull Agent 属性访问方法 *****************************/
 
+/* 设置是否启用直接接收（启用后数据通过 readv() 直接读取到连接接收缓冲区，省去一次内存复制；SSL 组件忽略该设置，默认：FALSE） */
+HPSOCKET_API void __HP_CALL HP_TcpPullAgent_SetDirectReceive(HP_TcpPullAgent pAgent, BOOL bDirectReceive);
+
+/* 检测是否启用直接接收 */
+HPSOCKET_API BOOL __HP_CALL HP_TcpPullAgent_IsDirectReceive(HP_TcpPullAgent pAgent);
+
 /***************************************************************************************/
 /***************************** TCP Pull Client 组件操作方法 *****************************/
 
@@ -1607,6 +1988,27 @@ HPSOCKET_API En_HP_FetchResult __HP_CALL HP_TcpPullClient_Fetch(HP_TcpPullClient
 */
 HPSOCKET_API En_HP_FetchResult __HP_CALL HP_TcpPullClient_Peek(HP_TcpPullClient pClient, BYTE* pData, int iLength);
 
+/*
+* 名称：窥探数据视图（不会移除缓冲区数据，不复制数据）
+* 描述：用户通过该方法获取接收缓冲区中前 iLength 字节数据所在的连续内存段；
+*		内存段只在下一次 Fetch / Skip 或 OnReceive 事件返回前有效
+*		
+* 参数：		pBuffers	-- 内存段数组
+*			piCount		-- 内存段数组长度（输入：数组长度；输出：覆盖 iLength 字节所需的内存段数量）
+*			iLength		-- 窥探数据长度
+* 返回值：	En_HP_FetchResult（数据不足时返回 FR_LENGTH_TOO_LONG 且 *piCount 为 0；数组长度不足时返回 FR_LENGTH_TOO_LONG 且 *piCount 为所需数量）
+*/
+HPSOCKET_API En_HP_FetchResult __HP_CALL HP_TcpPullClient_PeekView(HP_TcpPullClient pClient, WSABUF pBuffers[], int* piCount, int iLength);
+
+/*
+* 名称：跳过数据
+* 描述：用户通过该方法移除接收缓冲区中前 iLength 字节数据（通常在处理完 PeekView 获取的数据后调用）
+*		
+* 参数：		iLength		-- 跳过数据长度
+* 返回值：	En_HP_FetchResult
+*/
+HPSOCKET_API En_HP_FetchResult __HP_CALL HP_TcpPullClient_Skip(HP_TcpPullClient pClient, int iLength);
+
 /***************************************************************************************/
 /***************************** TCP Pull Client 属性访问方法 *****************************/
 
@@ -1620,11 +2022,19 @@ HPSOCKET_API En_HP_FetchResult __HP_CALL HP_TcpPullClient_Peek(HP_TcpPullClient
 HPSOCKET_API void __HP_CALL HP_TcpPackServer_SetMaxPackSize(HP_TcpPackServer pServer, DWORD dwMaxPackSize);
 /* 设置包头标识（有效包头标识取值范围 0 ~ 1023/0x3FF，当包头标识为 0 时不校验包头，默认：0） */
 HPSOCKET_API void __HP_CALL HP_TcpPackServer_SetPackHeaderFlag(HP_TcpPackServer pServer, USHORT usPackHeaderFlag);
+/* 设置是否启用批量接收（启用后一次读取中解析出的所有完整数据包通过 OnReceiveBatch 事件一次性交付，默认：FALSE） */
+HPSOCKET_API void __HP_CALL HP_TcpPackServer_SetReceiveBatch(HP_TcpPackServer pServer, BOOL bReceiveBatch);
+/* 设置是否启用直接接收（启用后数据通过 readv() 直接读取到连接接收缓冲区，位于同一个缓冲节点中的数据包直接在缓冲节点中分发；SSL 组件忽略该设置，默认：FALSE） */
+HPSOCKET_API void __HP_CALL HP_TcpPackServer_SetDirectReceive(HP_TcpPackServer pServer, BOOL bDirectReceive);
 
 /* 获取数据包最大长度 */
 HPSOCKET_API DWORD __HP_CALL HP_TcpPackServer_GetMaxPackSize(HP_TcpPackServer pServer);
 /* 获取包头标识 */
 HPSOCKET_API USHORT __HP_CALL HP_TcpPackServer_GetPackHeaderFlag(HP_TcpPackServer pServer);
+/* 检测是否启用批量接收 */
+HPSOCKET_API BOOL __HP_CALL HP_TcpPackServer_IsReceiveBatch(HP_TcpPackServer pServer);
+/* 检测是否启用直接接收 */
+HPSOCKET_API BOOL __HP_CALL HP_TcpPackServer_IsDirectReceive(HP_TcpPackServer pServer);
 
 /***************************************************************************************/
 /***************************** TCP Pack Agent 组件操作方法 *****************************/
@@ -1636,11 +2046,19 @@ HPSOCKET_API USHORT __HP_CALL HP_TcpPackServer_GetPackHeaderFlag(HP_TcpPackServe
 HPSOCKET_API void __HP_CALL HP_TcpPackAgent_SetMaxPackSize(HP_TcpPackAgent pAgent, DWORD dwMaxPackSize);
 /* 设置包头标识（有效包头标识取值范围 0 ~ 1023/0x3FF，当包头标识为 0 时不校验包头，默认：0） */
 HPSOCKET_API void __HP_CALL HP_TcpPackAgent_SetPackHeaderFlag(HP_TcpPackAgent pAgent, USHORT usPackHeaderFlag);
+/* 设置是否启用批量接收（启用后一次读取中解析出的所有完整数据包通过 OnReceiveBatch 事件一次性交付，默认：FALSE） */
+HPSOCKET_API void __HP_CALL HP_TcpPackAgent_SetReceiveBatch(HP_TcpPackAgent pAgent, BOOL bReceiveBatch);
+/* 设置是否启用直接接收（启用后数据通过 readv() 直接读取到连接接收缓冲区，位于同一个缓冲节点中的数据包直接在缓冲节点中分发；SSL 组件忽略该设置，默认：FALSE） */
+HPSOCKET_API void __HP_CALL HP_TcpPackAgent_SetDirectReceive(HP_TcpPackAgent pAgent, BOOL bDirectReceive);
 
 /* 获取数据包最大长度 */
 HPSOCKET_API DWORD __HP_CALL HP_TcpPackAgent_GetMaxPackSize(HP_TcpPackAgent pAgent);
 /* 获取包头标识 */
 HPSOCKET_API USHORT __HP_CALL HP_TcpPackAgent_GetPackHeaderFlag(HP_TcpPackAgent pAgent);
+/* 检测是否启用批量接收 */
+HPSOCKET_API BOOL __HP_CALL HP_TcpPackAgent_IsReceiveBatch(HP_TcpPackAgent pAgent);
+/* 检测是否启用直接接收 */
+HPSOCKET_API BOOL __HP_CALL HP_TcpPackAgent_IsDirectReceive(HP_TcpPackAgent pAgent);
 
 /***************************************************************************************/
 /***************************** TCP Pack Client 组件操作方法 *****************************/
@@ -1652,11 +2070,15 @@ HPSOCKET_API USHORT __HP_CALL HP_TcpPackAgent_GetPackHeaderFlag(HP_TcpPackAgent
 HPSOCKET_API void __HP_CALL HP_TcpPackClient_SetMaxPackSize(HP_TcpPackClient pClient, DWORD dwMaxPackSize);
 /* 设置包头标识（有效包头标识取值范围 0 ~ 1023/0x3FF，当包头标识为 0 时不校验包头，默认：0） */
 HPSOCKET_API void __HP_CALL HP_TcpPackClient_SetPackHeaderFlag(HP_TcpPackClient pClient, USHORT usPackHeaderFlag);
+/* 设置是否启用批量接收（启用后一次读取中解析出的所有完整数据包通过 OnReceiveBatch 事件一次性交付，默认：FALSE） */
+HPSOCKET_API void __HP_CALL HP_TcpPackClient_SetReceiveBatch(HP_TcpPackClient pClient, BOOL bReceiveBatch);
 
 /* 获取数据包最大长度 */
 HPSOCKET_API DWORD __HP_CALL HP_TcpPackClient_GetMaxPackSize(HP_TcpPackClient pClient);
 /* 获取包头标识 */
 HPSOCKET_API USHORT __HP_CALL HP_TcpPackClient_GetPackHeaderFlag(HP_TcpPackClient pClient);
+/* 检测是否启用批量接收 */
+HPSOCKET_API BOOL __HP_CALL HP_TcpPackClient_IsReceiveBatch(HP_TcpPackClient pClient);
 
 /*****************************************************************************************************************************************************/
 /*************************************************************** Global Function Exports *************************************************************/
@@ -1872,6 +2294,8 @@ typedef HP_FN_Server_OnReceive				HP_FN_HttpServer_OnReceive;
 typedef HP_FN_Server_OnSend					HP_FN_HttpServer_OnSend;
 typedef HP_FN_Server_OnClose				HP_FN_HttpServer_OnClose;
 typedef HP_FN_Server_OnShutdown				HP_FN_HttpServer_OnShutdown;
+typedef HP_FN_Server_OnSendBufferHigh		HP_FN_HttpServer_OnSendBufferHigh;
+typedef HP_FN_Server_OnSendBufferDrained	HP_FN_HttpServer_OnSendBufferDrained;
 
 /* HTTP Agent 回调函数 */
 typedef HP_FN_Http_OnMessageBegin			HP_FN_HttpAgent_OnMessageBegin;
@@ -1896,6 +2320,8 @@ typedef HP_FN_Agent_OnReceive				HP_FN_HttpAgent_OnReceive;
 typedef HP_FN_Agent_OnSend					HP_FN_HttpAgent_OnSend;
 typedef HP_FN_Agent_OnClose					HP_FN_HttpAgent_OnClose;
 typedef HP_FN_Agent_OnShutdown				HP_FN_HttpAgent_OnShutdown;
+typedef HP_FN_Agent_OnSendBufferHigh		HP_FN_HttpAgent_OnSendBufferHigh;
+typedef HP_FN_Agent_OnSendBufferDrained		HP_FN_HttpAgent_OnSendBufferDrained;
 
 /* HTTP Client 回调函数 */
 typedef HP_FN_Http_OnMessageBegin			HP_FN_HttpClient_OnMessageBegin;
@@ -1980,6 +2406,8 @@ HPSOCKET_API void __HP_CALL HP_Set_FN_HttpServer_OnReceive(HP_HttpServerListener
 HPSOCKET_API void __HP_CALL HP_Set_FN_HttpServer_OnSend(HP_HttpServerListener pListener				, HP_FN_HttpServer_OnSend fn);
 HPSOCKET_API void __HP_CALL HP_Set_FN_HttpServer_OnClose(HP_HttpServerListener pListener			, HP_FN_HttpServer_OnClose fn);
 HPSOCKET_API void __HP_CALL HP_Set_FN_HttpServer_OnShutdown(HP_HttpServerListener pListener			, HP_FN_HttpServer_OnShutdown fn);
+HPSOCKET_API void __HP_CALL HP_Set_FN_HttpServer_OnSendBufferHigh(HP_HttpServerListener pListener	, HP_FN_HttpServer_OnSendBufferHigh fn);
+HPSOCKET_API void __HP_CALL HP_Set_FN_HttpServer_OnSendBufferDrained(HP_HttpServerListener pListener, HP_FN_HttpServer_OnSendBufferDrained fn);
 
 /**********************************************************************************/
 /**************************** HTTP Agent 回调函数设置方法 **************************/
@@ -2006,6 +2434,8 @@ HPSOCKET_API void __HP_CALL HP_Set_FN_HttpAgent_OnReceive(HP_HttpAgentListener p
 HPSOCKET_API void __HP_CALL HP_Set_FN_HttpAgent_OnSend(HP_HttpAgentListener pListener				, HP_FN_HttpAgent_OnSend fn);
 HPSOCKET_API void __HP_CALL HP_Set_FN_HttpAgent_OnClose(HP_HttpAgentListener pListener				, HP_FN_HttpAgent_OnClose fn);
 HPSOCKET_API void __HP_CALL HP_Set_FN_HttpAgent_OnShutdown(HP_HttpAgentListener pListener			, HP_FN_HttpAgent_OnShutdown fn);
+HPSOCKET_API void __HP_CALL HP_Set_FN_HttpAgent_OnSendBufferHigh(HP_HttpAgentListener pListener	, HP_FN_HttpAgent_OnSendBufferHigh fn);
+HPSOCKET_API void __HP_CALL HP_Set_FN_HttpAgent_OnSendBufferDrained(HP_HttpAgentListener pListener	, HP_FN_HttpAgent_OnSendBufferDrained fn);
 
 /**********************************************************************************/
 /*************************** HTTP Client 回调函数设置方法 **************************/
@@ -2053,7 +2483,7 @@ HPSOCKET_API BOOL __HP_CALL HP_HttpServer_SendResponse(HP_HttpServer pServer, HP
 
 /*
 * 名称：发送本地文件
-* 描述：向指定连接发送 4096 KB 以下的小文件
+* 描述：向指定连接发送本地文件（通过 sendfile() 发送，不限文件大小；HTTPS 组件只能发送 4096 KB 以下的小文件）
 *		
 * 参数：		dwConnID		-- 连接 ID
 *			lpszFileName	-- 文件路径
@@ -2066,6 +2496,21 @@ HPSOCKET_API BOOL __HP_CALL HP_HttpServer_SendResponse(HP_HttpServer pServer, HP
 */
 HPSOCKET_API BOOL __HP_CALL HP_HttpServer_SendLocalFile(HP_HttpServer pServer, HP_CONNID dwConnID, LPCSTR lpszFileName, USHORT usStatusCode, LPCSTR lpszDesc, const HP_THeader lpHeaders[], int iHeaderCount);
 
+/*
+* 名称：按范围发送本地文件
+* 描述：根据 Range 请求头发送本地文件：范围有效时回复 206 和 Content-Range，范围无法满足时回复 416，
+*		无 Range 请求头或包含多个范围时回复 200 和整个文件（通过 sendfile() 发送，HTTPS 组件受 4096 KB 限制）
+*		
+* 参数：		dwConnID		-- 连接 ID
+*			lpszFileName	-- 文件路径
+*			lpszRange		-- 范围（如："bytes=0-1023"，NULL 则使用请求的 Range 请求头）
+*			lpHeaders		-- 回复请求头
+*			iHeaderCount	-- 回复请求头数量
+* 返回值：	TRUE			-- 成功
+*			FALSE			-- 失败
+*/
+HPSOCKET_API BOOL __HP_CALL HP_HttpServer_SendRangeFile(HP_HttpServer pServer, HP_CONNID dwConnID, LPCSTR lpszFileName, LPCSTR lpszRange, const HP_THeader lpHeaders[], int iHeaderCount);
+
 /*
 * 名称：发送 Chunked 数据分片
 * 描述：向对端发送 Chunked 数据分片
@@ -2099,6 +2544,23 @@ HPSOCKET_API BOOL __HP_CALL HP_HttpServer_SendChunkData(HP_HttpServer pServer, H
 */
 HPSOCKET_API BOOL __HP_CALL HP_HttpServer_SendWSMessage(HP_HttpServer pServer, HP_CONNID dwConnID, BOOL bFinal, BYTE iReserved, BYTE iOperationCode, const BYTE* pData, int iLength, ULONGLONG ullBodyLen);
 
+/*
+* 名称：广播 WebSocket 消息
+* 描述：向多个连接发送同一 WebSocket 消息，消息帧只构造一次并由各连接共享（参考 HP_TcpServer_Broadcast()）
+*		
+* 参数：		pIDs			-- 连接 ID 数组
+*			dwCount			-- 连接 ID 数目
+*			bFinal			-- 是否结束帧
+*			iReserved		-- RSV1/RSV2/RSV3 各 1 位
+*			iOperationCode	-- 操作码：0x0 - 0xF
+*			pData			-- 消息体数据缓冲区
+*			iLength			-- 消息体数据长度
+*			ullBodyLen		-- 消息总长度（参考 HP_HttpServer_SendWSMessage()）
+* 返回值：	TRUE			-- 成功（至少一个连接发送成功）
+*			FALSE			-- 失败
+*/
+HPSOCKET_API BOOL __HP_CALL HP_HttpServer_BroadcastWSMessage(HP_HttpServer pServer, const HP_CONNID pIDs[], DWORD dwCount, BOOL bFinal, BYTE iReserved, BYTE iOperationCode, const BYTE* pData, int iLength, ULONGLONG ullBodyLen);
+
 /*
 * 名称：释放连接
 * 描述：把连接放入释放队列，等待某个时间（通过 SetReleaseDelay() 设置）关闭连接
@@ -2720,6 +3182,13 @@ HPSOCKET_API DWORD __HP_CALL HP_ThreadPool_GetMaxQueueSize(HP_ThreadPool pThread
 /* 获取任务拒绝处理策略 */
 HPSOCKET_API En_HP_RejectedPolicy __HP_CALL HP_ThreadPool_GetRejectedPolicy(HP_ThreadPool pThreadPool);
 
+/* 设置工作线程 CPU 亲和策略（lpszCpuList：CAP_LIST 策略的 CPU 列表，格式如 "0-3,8,10"） */
+HPSOCKET_API void __HP_CALL HP_ThreadPool_SetCpuAffinity(HP_ThreadPool pThreadPool, En_HP_CpuAffinityPolicy enPolicy, LPCTSTR lpszCpuList);
+/* 获取工作线程 CPU 亲和策略 */
+HPSOCKET_API En_HP_CpuAffinityPolicy __HP_CALL HP_ThreadPool_GetCpuAffinityPolicy(HP_ThreadPool pThreadPool);
+/* 获取工作线程 CPU 亲和列表 */
+HPSOCKET_API LPCTSTR __HP_CALL HP_ThreadPool_GetCpuAffinityList(HP_ThreadPool pThreadPool);
+
 /*****************************************************************************************************************************************************/
 /********************************************************* Compressor / Decompressor Exports *********************************************************/
 /*****************************************************************************************************************************************************/
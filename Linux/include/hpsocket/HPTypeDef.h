@@ -183,6 +183,23 @@ typedef enum EnReuseAddressPolicy
 	RAP_ADDR_AND_PORT	= 2,	// 重用地址和端口
 } En_HP_ReuseAddressPolicy;
 
+/************************************************************************
+名称：CPU 亲和策略
+描述：通信组件及线程池工作线程绑定 CPU 的策略
+
+* 不绑定（默认）	：不设置工作线程的 CPU 亲和性
+* 紧凑			：按物理核顺序依次绑定（同一物理核的超线程相邻）
+* 分散			：优先把工作线程分散到不同物理核和 CPU 插槽
+* 列表			：按指定的 CPU 列表（如："0-3,8,10"）依次绑定
+************************************************************************/
+typedef enum EnCpuAffinityPolicy
+{
+	CAP_NONE			= 0,	// 不绑定（默认）
+	CAP_COMPACT			= 1,	// 紧凑
+	CAP_SCATTER			= 2,	// 分散
+	CAP_LIST			= 3,	// 列表
+} En_HP_CpuAffinityPolicy;
+
 /************************************************************************
 名称：操作结果代码
 描述：组件 Start() / Stop() 方法执行失败时，可通过 GetLastError() 获取错误代码
@@ -283,6 +300,29 @@ typedef enum EnTaskBufferType
 typedef VOID (__HP_CALL *Fn_TaskProc)(PVOID pvArg);
 typedef Fn_TaskProc	HP_Fn_TaskProc;
 
+/************************************************************************
+名称：连接任务处理函数
+描述：Post() 投递的连接任务入口函数，在连接所属的工作线程中执行，
+	  与该连接的事件处理串行执行
+参数：dwConnID	-- 连接 ID
+	  pvArg		-- 自定义参数
+	  bValid	-- 连接是否有效（任务执行前连接已关闭或通信组件已停止则为 FALSE）
+返回值：（无）
+************************************************************************/
+typedef VOID (__HP_CALL *Fn_ConnTaskProc)(CONNID dwConnID, PVOID pvArg, BOOL bValid);
+typedef Fn_ConnTaskProc	HP_Fn_ConnTaskProc;
+
+/************************************************************************
+名称：发送缓冲区释放函数
+描述：SendRefPackets() 以引用方式发送的用户缓冲区不再被通信组件使用时
+	  （数据已全部发送或连接已关闭）调用，每次 SendRefPackets() 调用对应一次，
+	  可能在任意线程中执行，不应执行耗时操作
+参数：pvArg -- 自定义参数
+返回值：（无）
+************************************************************************/
+typedef VOID (__HP_CALL *Fn_SendBufferRelease)(PVOID pvArg);
+typedef Fn_SendBufferRelease	HP_Fn_SendBufferRelease;
+
 struct TSocketTask;
 
 /************************************************************************
@@ -310,6 +350,27 @@ typedef struct TSocketTask
 	LPARAM					lparam;		// 自定义参数
 } *LPTSocketTask, HP_TSocketTask, *HP_LPTSocketTask;
 
+/************************************************************************
+名称：工作线程运行统计结构体
+描述：通信组件 IO 工作线程事件循环的运行统计快照（时间单位：微秒）
+************************************************************************/
+typedef struct TWorkerStats
+{
+	DWORD	index;				// 工作线程序号
+	DWORD	maxLoopEvents;		// 单次唤醒最大事件数
+	ULLONG	loops;				// 事件循环唤醒次数
+	ULLONG	events;				// 已处理事件数（events / loops 为平均每次唤醒事件数）
+	ULLONG	commands;			// 已处理命令数
+	DWORD	commandQueueDepth;	// 当前命令队列深度
+	DWORD	maxCommandLatency;	// 最大命令排空延迟（从唤醒工作线程到命令全部处理完毕）
+	ULLONG	commandDrains;		// 命令排空次数
+	ULLONG	commandLatency;		// 命令排空总延迟
+	ULLONG	handleTime;			// 事件处理总耗时（含套接字读写等系统调用与用户回调，不单独统计用户回调耗时）
+	ULLONG	waitTime;			// 内核中等待事件总耗时（含空闲时间）
+	DWORD	maxHandleTime;		// 最长单次事件处理耗时（同 handleTime 的统计范围）
+	DWORD	migrations;			// 负载均衡迁出的连接数
+} *LPTWorkerStats, HP_TWorkerStats, *HP_LPTWorkerStats;
+
 /************************************************************************
 名称：获取 HPSocket 版本号
 描述：版本号（4 个字节分别为：主版本号，子版本号，修正版本号，构建编号）
@@ -156,6 +156,20 @@ public:
 	*/
 	virtual BOOL PauseReceive(CONNID dwConnID, BOOL bPause = TRUE)					= 0;
 
+	/*
+	* 名称：投递连接任务
+	* 描述：在连接所属的工作线程中执行任务，任务与该连接的事件处理串行执行（不需要对连接状态加锁）
+	*		任务总是被执行一次：如果任务执行前连接已关闭，则以 bValid = FALSE 执行（用于释放 pvArg）
+	*		同一线程先后投递的任务以及 PauseReceive()、Disconnect() 等请求按调用顺序执行，连接在工作线程之间迁移时也是如此
+	*		
+	* 参数：		dwConnID	-- 连接 ID
+	*			fnProc		-- 任务处理函数
+	*			pvArg		-- 自定义参数
+	* 返回值：	TRUE	-- 成功
+	*			FALSE	-- 失败，可通过 SYS_GetLastError() 获取错误代码（任务不会被执行）
+	*/
+	virtual BOOL Post(CONNID dwConnID, Fn_ConnTaskProc fnProc, PVOID pvArg)			= 0;
+
 	/*
 	* 名称：断开连接
 	* 描述：断开某个连接
@@ -236,6 +250,8 @@ public:
 	virtual DWORD GetConnectionCount	()										= 0;
 	/* 获取所有连接的 CONNID */
 	virtual BOOL GetAllConnectionIDs	(CONNID pIDs[], DWORD& dwCount)			= 0;
+	/* 获取工作线程运行统计快照（pStats 为空或 dwCount 小于工作线程数量时返回 FALSE，并通过 dwCount 返回工作线程数量） */
+	virtual BOOL GetWorkerStats			(TWorkerStats pStats[], DWORD& dwCount)	= 0;
 	/* 获取某个连接时长（毫秒） */
 	virtual BOOL GetConnectPeriod		(CONNID dwConnID, DWORD& dwPeriod)		= 0;
 	/* 获取某个连接静默时间（毫秒） */
@@ -257,7 +273,7 @@ public:
 
 	/* 设置地址重用选项 */
 	virtual void SetReuseAddressPolicy(EnReuseAddressPolicy enReusePolicy)		= 0;
-	/* 设置数据发送策略（对 Linux 平台组件无效） */
+	/* 设置数据发送策略（Linux 平台 TCP 组件支持 SP_DIRECT：连接没有待发送数据时在调用线程中直接发送，只缓存未发送的剩余数据，直接发送的数据在调用线程中触发 OnSend 事件（触发时持有该连接的发送锁，OnSend 中不要执行耗时操作或等待其它线程）；其它策略等同于 SP_PACK） */
 	virtual void SetSendPolicy				(EnSendPolicy enSendPolicy)			= 0;
 	/* 设置 OnSend 事件同步策略（对 Linux 平台组件无效） */
 	virtual void SetOnSendSyncPolicy		(EnOnSendSyncPolicy enSyncPolicy)	= 0;
@@ -277,10 +293,12 @@ public:
 	virtual void SetWorkerThreadCount		(DWORD dwWorkerThreadCount)			= 0;
 	/* 设置是否标记静默时间（设置为 TRUE 时 DisconnectSilenceConnections() 和 GetSilencePeriod() 才有效，默认：TRUE） */
 	virtual void SetMarkSilence				(BOOL bMarkSilence)					= 0;
+	/* 设置工作线程 CPU 亲和策略（lpszCpuList -- CAP_LIST 策略绑定的 CPU 列表，如："0-3,8"；默认：CAP_NONE，不绑定） */
+	virtual void SetCpuAffinity				(EnCpuAffinityPolicy enPolicy, LPCTSTR lpszCpuList = nullptr)	= 0;
 
 	/* 获取地址重用选项 */
 	virtual EnReuseAddressPolicy GetReuseAddressPolicy	()	= 0;
-	/* 获取数据发送策略（对 Linux 平台组件无效） */
+	/* 获取数据发送策略 */
 	virtual EnSendPolicy GetSendPolicy					()	= 0;
 	/* 获取 OnSend 事件同步策略（对 Linux 平台组件无效） */
 	virtual EnOnSendSyncPolicy GetOnSendSyncPolicy		()	= 0;
@@ -300,6 +318,10 @@ public:
 	virtual DWORD GetWorkerThreadCount					()	= 0;
 	/* 检测是否标记静默时间 */
 	virtual BOOL IsMarkSilence							()	= 0;
+	/* 获取工作线程 CPU 亲和策略 */
+	virtual EnCpuAffinityPolicy GetCpuAffinityPolicy	()	= 0;
+	/* 获取工作线程 CPU 列表（CAP_LIST 策略） */
+	virtual LPCTSTR GetCpuAffinityList					()	= 0;
 
 public:
 	virtual ~IComplexSocket() = default;
@@ -360,6 +382,91 @@ public:
 	*/
 	virtual BOOL SendSmallFile(CONNID dwConnID, LPCTSTR lpszFileName, const LPWSABUF pHead = nullptr, const LPWSABUF pTail = nullptr)	= 0;
 
+	/*
+	* 名称：以引用方式发送多组数据
+	* 描述：向指定连接顺序发送多组数据，较大的数据块不复制到发送缓冲区而是直接引用用户缓冲区，
+	*		用户缓冲区必须保持有效直到 fnRelease 被调用（数据全部发送完毕或连接关闭后调用）；
+	*		无论发送成功与否 fnRelease 都会被调用一次（SSL 连接的数据加密后立即调用），
+	*		fnRelease 为 nullptr 时等同于 SendPackets()
+	*		
+	* 参数：		dwConnID	-- 连接 ID
+	*			pBuffers	-- 发送缓冲区数组
+	*			iCount		-- 发送缓冲区数目
+	*			fnRelease	-- 发送缓冲区释放函数
+	*			pvArg		-- 自定义参数（传递给 fnRelease）
+	* 返回值：	TRUE	-- 成功
+	*			FALSE	-- 失败，可通过 SYS_GetLastError() 获取错误代码
+	*/
+	virtual BOOL SendRefPackets(CONNID dwConnID, const WSABUF pBuffers[], int iCount, Fn_SendBufferRelease fnRelease, PVOID pvArg = nullptr)	= 0;
+
+	/*
+	* 名称：发送文件
+	* 描述：向指定连接发送文件的指定范围（不限文件大小），文件数据在连接可写时由工作线程通过 sendfile() 分块发送，
+	*		不复制到发送缓冲区，也不触发 OnSend 事件；pHead、pTail 的数据被复制到发送缓冲区；
+	*		fnComplete 在全部数据发送完毕或连接关闭后调用，无论发送成功与否都会被调用一次；
+	*		SSL 与 Pack 组件读取文件数据后以普通方式发送（受 4096 KB 限制），数据加入发送缓冲区后即调用 fnComplete
+	*		
+	* 参数：		dwConnID	-- 连接 ID
+	*			lpszFileName-- 文件路径
+	*			ullOffset	-- 文件偏移量
+	*			ullLength	-- 发送长度（0 则发送到文件末尾）
+	*			pHead		-- 头部附加数据
+	*			pTail		-- 尾部附加数据
+	*			fnComplete	-- 发送完成回调函数
+	*			pvArg		-- 自定义参数（传递给 fnComplete）
+	* 返回值：	TRUE	-- 成功
+	*			FALSE	-- 失败，可通过 SYS_GetLastError() 获取错误代码
+	*/
+	virtual BOOL SendFile(CONNID dwConnID, LPCTSTR lpszFileName, ULONGLONG ullOffset = 0, ULONGLONG ullLength = 0, const LPWSABUF pHead = nullptr, const LPWSABUF pTail = nullptr, Fn_SendBufferRelease fnComplete = nullptr, PVOID pvArg = nullptr)	= 0;
+
+	/*
+	* 名称：发送暂存数据
+	* 描述：立即发送指定连接因发送合并而暂存的数据（参考 SetCoalesceSize()），没有暂存数据时不做任何操作
+	*		
+	* 参数：		dwConnID	-- 连接 ID
+	* 返回值：	TRUE	-- 成功
+	*			FALSE	-- 失败，可通过 SYS_GetLastError() 获取错误代码
+	*/
+	virtual BOOL Flush(CONNID dwConnID)	= 0;
+
+	/*
+	* 名称：设置连接的发送合并阈值
+	* 描述：覆盖组件的发送合并阈值（参考 SetCoalesceSize()），0 则关闭该连接的发送合并；
+	*		新阈值不大于已暂存数据的长度时立即发送暂存数据
+	*		
+	* 参数：		dwConnID		-- 连接 ID
+	*			dwCoalesceSize	-- 发送合并阈值（字节）
+	* 返回值：	TRUE	-- 成功
+	*			FALSE	-- 失败，可通过 SYS_GetLastError() 获取错误代码
+	*/
+	virtual BOOL SetConnectionCoalesceSize(CONNID dwConnID, DWORD dwCoalesceSize)	= 0;
+
+	/*
+	* 名称：广播发送多组数据
+	* 描述：向多个连接发送同一组数据，数据（含 Pack 包头）只复制一次到共享缓冲区，各连接的发送缓冲区以引用方式共享，
+	*		全部连接发送完毕或关闭后回收；需要唤醒工作线程的连接按工作线程合并为一个命令；
+	*		无效连接与达到发送缓冲区高水位的连接被跳过；SSL 组件对每个连接分别加密发送
+	*		
+	* 参数：		pIDs		-- 连接 ID 数组
+	*			dwCount		-- 连接 ID 数目
+	*			pBuffers	-- 发送缓冲区数组
+	*			iCount		-- 发送缓冲区数目
+	* 返回值：	TRUE	-- 成功（至少一个连接发送成功）
+	*			FALSE	-- 失败，可通过 SYS_GetLastError() 获取错误代码
+	*/
+	virtual BOOL Broadcast(const CONNID pIDs[], DWORD dwCount, const WSABUF pBuffers[], int iCount)	= 0;
+
+	/*
+	* 名称：向所有连接广播发送多组数据
+	* 描述：向当前所有连接发送同一组数据（参考 Broadcast()）
+	*		
+	* 参数：		pBuffers	-- 发送缓冲区数组
+	*			iCount		-- 发送缓冲区数目
+	* 返回值：	TRUE	-- 成功（至少一个连接发送成功）
+	*			FALSE	-- 失败，可通过 SYS_GetLastError() 获取错误代码
+	*/
+	virtual BOOL BroadcastAll(const WSABUF pBuffers[], int iCount)	= 0;
+
 #ifdef _SSL_SUPPORT
 	/*
 	* 名称：初始化通信组件 SSL 环境参数
@@ -465,6 +572,10 @@ public:
 
 	/* 设置 EPOLL 等待事件的最大数量 */
 	virtual void SetAcceptSocketCount	(DWORD dwAcceptSocketCount)		= 0;
+	/* 设置每次唤醒最多接受的连接数（0 则不限制，默认：64；防止大量连接涌入时饿死已建立的连接） */
+	virtual void SetAcceptBudget		(DWORD dwAcceptBudget)			= 0;
+	/* 设置延迟接受时间（毫秒，0 则不开启，默认：0；开启后使用 TCP_DEFER_ACCEPT，连接收到首个数据包时才被接受，适用于客户端先发送数据的协议） */
+	virtual void SetDeferAcceptTime		(DWORD dwDeferAcceptTime)		= 0;
 	/* 设置通信数据缓冲区大小（根据平均通信数据包大小调整设置，通常设置为 1024 的倍数） */
 	virtual void SetSocketBufferSize	(DWORD dwSocketBufferSize)		= 0;
 	/* 设置监听 Socket 的等候队列大小（根据并发连接数量调整设置） */
@@ -475,9 +586,39 @@ public:
 	virtual void SetKeepAliveInterval	(DWORD dwKeepAliveInterval)		= 0;
 	/* 设置是否开启 nodelay 模式（默认：FALSE，不开启） */
 	virtual void SetNoDelay				(BOOL bNoDelay)					= 0;
+	/* 设置是否使用 io_uring 分发 IO 事件（默认：FALSE，使用 EPOLL；内核不支持 io_uring 时自动回退为 EPOLL） */
+	virtual void SetUseIOUring			(BOOL bUseIOUring)				= 0;
+	/* 设置忙轮询时间（微秒，0 则不开启低延迟忙轮询模式，默认：0；开启后工作线程在休眠前自旋轮询 IO 事件，并对连接开启 SO_BUSY_POLL 和 TCP_QUICKACK） */
+	virtual void SetBusyPollTime		(DWORD dwBusyPollTime)			= 0;
+	/* 设置工作线程负载均衡阈值（百分比，0 - 100，0 则不开启，默认：0；工作线程间的繁忙率差值达到该值时，把最繁忙工作线程上的活跃连接迁移到最空闲的工作线程） */
+	virtual void SetRebalanceThreshold	(DWORD dwRebalanceThreshold)	= 0;
+	/* 设置 MSG_ZEROCOPY 发送阈值（0 则不启用，默认：0；长度大于等于该值的发送数据块以 MSG_ZEROCOPY 方式发送，直至内核通知完成后才回收缓冲区，建议配合 SendRefPackets() 使用并设置为 32KB 以上） */
+	virtual void SetZeroCopyThreshold	(DWORD dwZeroCopyThreshold)	= 0;
+	/* 设置发送合并阈值（字节，0 则不合并，默认：0；开启后连接空闲时发送的数据先暂存，累计达到该值、超过合并延迟或调用 Flush() 时才一次发送，适用于大量小数据包的场景） */
+	virtual void SetCoalesceSize		(DWORD dwCoalesceSize)		= 0;
+	/* 设置发送合并延迟（毫秒，0 则只在达到合并阈值或调用 Flush() 时发送，默认：1） */
+	virtual void SetCoalesceDelay		(DWORD dwCoalesceDelay)		= 0;
+	/* 设置发送缓冲区高水位（字节，0 则不限制，默认：0；连接的待发送数据达到该值时触发 OnSendBufferHigh()，并拒绝后续发送直到降至低水位） */
+	virtual void SetSendHighWatermark	(DWORD dwSendHighWatermark)	= 0;
+	/* 设置发送缓冲区低水位（字节，必须小于高水位，默认：0；待发送数据降至该值时触发 OnSendBufferDrained() 并恢复发送） */
+	virtual void SetSendLowWatermark	(DWORD dwSendLowWatermark)	= 0;
+	/* 设置内核未发送数据低水位（字节，0 则不启用，默认：0；对连接设置 TCP_NOTSENT_LOWAT，内核中未发送的数据低于该值时才继续写入，其余数据保留在发送缓冲区中，可降低交互消息与大数据共用连接时的排队延迟） */
+	virtual void SetNotSentLowat		(DWORD dwNotSentLowat)		= 0;
+	/* 设置每次处理接收事件最多读取的字节数（0 则不限制，默认：Socket 缓冲区大小的 100 倍；连接超出预算后让出工作线程，剩余数据在下一轮事件循环中继续读取，防止高速连接长时间独占工作线程） */
+	virtual void SetReadBudget			(DWORD dwReadBudget)		= 0;
+	/* 设置每次处理发送事件最多写入的字节数（0 则不限制，默认：0；连接超出预算后让出工作线程，剩余数据在下一轮事件循环中继续发送） */
+	virtual void SetWriteBudget			(DWORD dwWriteBudget)		= 0;
+	/* 设置每次处理接收或发送事件的最长时间（微秒，0 则不限制，默认：0；与读写字节预算同时生效，任一预算用完即让出工作线程） */
+	virtual void SetIoTimeBudget		(DWORD dwIoTimeBudget)		= 0;
+	/* 设置空闲连接超时时间（毫秒，0 则不启用，默认：0；须开启 MarkSilence，每个连接在所属工作线程的时间轮上挂接定时器，超过该时间没有收到数据的连接被自动断开，无需定期调用 DisconnectSilenceConnections() 扫描全部连接） */
+	virtual void SetIdleTimeout			(DWORD dwIdleTimeout)		= 0;
 
 	/* 获取 EPOLL 等待事件的最大数量 */
 	virtual DWORD GetAcceptSocketCount	()	= 0;
+	/* 获取每次唤醒最多接受的连接数 */
+	virtual DWORD GetAcceptBudget		()	= 0;
+	/* 获取延迟接受时间 */
+	virtual DWORD GetDeferAcceptTime	()	= 0;
 	/* 获取通信数据缓冲区大小 */
 	virtual DWORD GetSocketBufferSize	()	= 0;
 	/* 获取监听 Socket 的等候队列大小 */
@@ -488,6 +629,32 @@ public:
 	virtual DWORD GetKeepAliveInterval	()	= 0;
 	/* 检查是否开启 nodelay 模式 */
 	virtual BOOL IsNoDelay				()	= 0;
+	/* 检查是否使用 io_uring 分发 IO 事件 */
+	virtual BOOL IsUseIOUring			()	= 0;
+	/* 获取忙轮询时间 */
+	virtual DWORD GetBusyPollTime		()	= 0;
+	/* 获取工作线程负载均衡阈值 */
+	virtual DWORD GetRebalanceThreshold	()	= 0;
+	/* 获取 MSG_ZEROCOPY 发送阈值 */
+	virtual DWORD GetZeroCopyThreshold	()	= 0;
+	/* 获取发送合并阈值 */
+	virtual DWORD GetCoalesceSize		()	= 0;
+	/* 获取发送合并延迟 */
+	virtual DWORD GetCoalesceDelay		()	= 0;
+	/* 获取发送缓冲区高水位 */
+	virtual DWORD GetSendHighWatermark	()	= 0;
+	/* 获取发送缓冲区低水位 */
+	virtual DWORD GetSendLowWatermark	()	= 0;
+	/* 获取内核未发送数据低水位 */
+	virtual DWORD GetNotSentLowat		()	= 0;
+	/* 获取每次处理接收事件最多读取的字节数 */
+	virtual DWORD GetReadBudget			()	= 0;
+	/* 获取每次处理发送事件最多写入的字节数 */
+	virtual DWORD GetWriteBudget		()	= 0;
+	/* 获取每次处理接收或发送事件的最长时间 */
+	virtual DWORD GetIoTimeBudget		()	= 0;
+	/* 获取空闲连接超时时间 */
+	virtual DWORD GetIdleTimeout		()	= 0;
 
 #ifdef _SSL_SUPPORT
 	/* 设置通信组件握手方式（默认：TRUE，自动握手） */
@@ -699,6 +866,65 @@ public:
 	*/
 	virtual BOOL SendSmallFile(CONNID dwConnID, LPCTSTR lpszFileName, const LPWSABUF pHead = nullptr, const LPWSABUF pTail = nullptr)	= 0;
 
+	/*
+	* 名称：以引用方式发送多组数据
+	* 描述：向指定连接顺序发送多组数据，较大的数据块不复制到发送缓冲区而是直接引用用户缓冲区，
+	*		用户缓冲区必须保持有效直到 fnRelease 被调用（数据全部发送完毕或连接关闭后调用）；
+	*		无论发送成功与否 fnRelease 都会被调用一次（SSL 连接的数据加密后立即调用），
+	*		fnRelease 为 nullptr 时等同于 SendPackets()
+	*		
+	* 参数：		dwConnID	-- 连接 ID
+	*			pBuffers	-- 发送缓冲区数组
+	*			iCount		-- 发送缓冲区数目
+	*			fnRelease	-- 发送缓冲区释放函数
+	*			pvArg		-- 自定义参数（传递给 fnRelease）
+	* 返回值：	TRUE	-- 成功
+	*			FALSE	-- 失败，可通过 SYS_GetLastError() 获取错误代码
+	*/
+	virtual BOOL SendRefPackets(CONNID dwConnID, const WSABUF pBuffers[], int iCount, Fn_SendBufferRelease fnRelease, PVOID pvArg = nullptr)	= 0;
+
+	/*
+	* 名称：发送文件
+	* 描述：向指定连接发送文件的指定范围（不限文件大小），文件数据在连接可写时由工作线程通过 sendfile() 分块发送，
+	*		不复制到发送缓冲区，也不触发 OnSend 事件；pHead、pTail 的数据被复制到发送缓冲区；
+	*		fnComplete 在全部数据发送完毕或连接关闭后调用，无论发送成功与否都会被调用一次；
+	*		SSL 与 Pack 组件读取文件数据后以普通方式发送（受 4096 KB 限制），数据加入发送缓冲区后即调用 fnComplete
+	*		
+	* 参数：		dwConnID	-- 连接 ID
+	*			lpszFileName-- 文件路径
+	*			ullOffset	-- 文件偏移量
+	*			ullLength	-- 发送长度（0 则发送到文件末尾）
+	*			pHead		-- 头部附加数据
+	*			pTail		-- 尾部附加数据
+	*			fnComplete	-- 发送完成回调函数
+	*			pvArg		-- 自定义参数（传递给 fnComplete）
+	* 返回值：	TRUE	-- 成功
+	*			FALSE	-- 失败，可通过 SYS_GetLastError() 获取错误代码
+	*/
+	virtual BOOL SendFile(CONNID dwConnID, LPCTSTR lpszFileName, ULONGLONG ullOffset = 0, ULONGLONG ullLength = 0, const LPWSABUF pHead = nullptr, const LPWSABUF pTail = nullptr, Fn_SendBufferRelease fnComplete = nullptr, PVOID pvArg = nullptr)	= 0;
+
+	/*
+	* 名称：发送暂存数据
+	* 描述：立即发送指定连接因发送合并而暂存的数据（参考 SetCoalesceSize()），没有暂存数据时不做任何操作
+	*		
+	* 参数：		dwConnID	-- 连接 ID
+	* 返回值：	TRUE	-- 成功
+	*			FALSE	-- 失败，可通过 SYS_GetLastError() 获取错误代码
+	*/
+	virtual BOOL Flush(CONNID dwConnID)	= 0;
+
+	/*
+	* 名称：设置连接的发送合并阈值
+	* 描述：覆盖组件的发送合并阈值（参考 SetCoalesceSize()），0 则关闭该连接的发送合并；
+	*		新阈值不大于已暂存数据的长度时立即发送暂存数据
+	*		
+	* 参数：		dwConnID		-- 连接 ID
+	*			dwCoalesceSize	-- 发送合并阈值（字节）
+	* 返回值：	TRUE	-- 成功
+	*			FALSE	-- 失败，可通过 SYS_GetLastError() 获取错误代码
+	*/
+	virtual BOOL SetConnectionCoalesceSize(CONNID dwConnID, DWORD dwCoalesceSize)	= 0;
+
 #ifdef _SSL_SUPPORT
 	/*
 	* 名称：初始化通信组件 SSL 环境参数
@@ -768,6 +994,30 @@ public:
 	virtual void SetKeepAliveInterval	(DWORD dwKeepAliveInterval)		= 0;
 	/* 设置是否开启 nodelay 模式（默认：FALSE，不开启） */
 	virtual void SetNoDelay				(BOOL bNoDelay)					= 0;
+	/* 设置是否使用 io_uring 分发 IO 事件（默认：FALSE，使用 EPOLL；内核不支持 io_uring 时自动回退为 EPOLL） */
+	virtual void SetUseIOUring			(BOOL bUseIOUring)				= 0;
+	/* 设置忙轮询时间（微秒，0 则不开启低延迟忙轮询模式，默认：0；开启后工作线程在休眠前自旋轮询 IO 事件，并对连接开启 SO_BUSY_POLL 和 TCP_QUICKACK） */
+	virtual void SetBusyPollTime		(DWORD dwBusyPollTime)			= 0;
+	/* 设置工作线程负载均衡阈值（百分比，0 - 100，0 则不开启，默认：0；工作线程间的繁忙率差值达到该值时，把最繁忙工作线程上的活跃连接迁移到最空闲的工作线程） */
+	virtual void SetRebalanceThreshold	(DWORD dwRebalanceThreshold)	= 0;
+	/* 设置 MSG_ZEROCOPY 发送阈值（0 则不启用，默认：0；长度大于等于该值的发送数据块以 MSG_ZEROCOPY 方式发送，直至内核通知完成后才回收缓冲区，建议配合 SendRefPackets() 使用并设置为 32KB 以上） */
+	virtual void SetZeroCopyThreshold	(DWORD dwZeroCopyThreshold)	= 0;
+	/* 设置发送合并阈值（字节，0 则不合并，默认：0；开启后连接空闲时发送的数据先暂存，累计达到该值、超过合并延迟或调用 Flush() 时才一次发送，适用于大量小数据包的场景） */
+	virtual void SetCoalesceSize		(DWORD dwCoalesceSize)		= 0;
+	/* 设置发送合并延迟（毫秒，0 则只在达到合并阈值或调用 Flush() 时发送，默认：1） */
+	virtual void SetCoalesceDelay		(DWORD dwCoalesceDelay)		= 0;
+	/* 设置发送缓冲区高水位（字节，0 则不限制，默认：0；连接的待发送数据达到该值时触发 OnSendBufferHigh()，并拒绝后续发送直到降至低水位） */
+	virtual void SetSendHighWatermark	(DWORD dwSendHighWatermark)	= 0;
+	/* 设置发送缓冲区低水位（字节，必须小于高水位，默认：0；待发送数据降至该值时触发 OnSendBufferDrained() 并恢复发送） */
+	virtual void SetSendLowWatermark	(DWORD dwSendLowWatermark)	= 0;
+	/* 设置内核未发送数据低水位（字节，0 则不启用，默认：0；对连接设置 TCP_NOTSENT_LOWAT，内核中未发送的数据低于该值时才继续写入，其余数据保留在发送缓冲区中，可降低交互消息与大数据共用连接时的排队延迟） */
+	virtual void SetNotSentLowat		(DWORD dwNotSentLowat)		= 0;
+	/* 设置每次处理接收事件最多读取的字节数（0 则不限制，默认：Socket 缓冲区大小的 100 倍；连接超出预算后让出工作线程，剩余数据在下一轮事件循环中继续读取，防止高速连接长时间独占工作线程） */
+	virtual void SetReadBudget			(DWORD dwReadBudget)		= 0;
+	/* 设置每次处理发送事件最多写入的字节数（0 则不限制，默认：0；连接超出预算后让出工作线程，剩余数据在下一轮事件循环中继续发送） */
+	virtual void SetWriteBudget			(DWORD dwWriteBudget)		= 0;
+	/* 设置每次处理接收或发送事件的最长时间（微秒，0 则不限制，默认：0；与读写字节预算同时生效，任一预算用完即让出工作线程） */
+	virtual void SetIoTimeBudget		(DWORD dwIoTimeBudget)		= 0;
 
 	/* 获取同步连接超时时间 */
 	virtual DWORD GetSyncConnectTimeout	()	= 0;
@@ -779,6 +1029,30 @@ public:
 	virtual DWORD GetKeepAliveInterval	()	= 0;
 	/* 检查是否开启 nodelay 模式 */
 	virtual BOOL IsNoDelay				()	= 0;
+	/* 检查是否使用 io_uring 分发 IO 事件 */
+	virtual BOOL IsUseIOUring			()	= 0;
+	/* 获取忙轮询时间 */
+	virtual DWORD GetBusyPollTime		()	= 0;
+	/* 获取工作线程负载均衡阈值 */
+	virtual DWORD GetRebalanceThreshold	()	= 0;
+	/* 获取 MSG_ZEROCOPY 发送阈值 */
+	virtual DWORD GetZeroCopyThreshold	()	= 0;
+	/* 获取发送合并阈值 */
+	virtual DWORD GetCoalesceSize		()	= 0;
+	/* 获取发送合并延迟 */
+	virtual DWORD GetCoalesceDelay		()	= 0;
+	/* 获取发送缓冲区高水位 */
+	virtual DWORD GetSendHighWatermark	()	= 0;
+	/* 获取发送缓冲区低水位 */
+	virtual DWORD GetSendLowWatermark	()	= 0;
+	/* 获取内核未发送数据低水位 */
+	virtual DWORD GetNotSentLowat		()	= 0;
+	/* 获取每次处理接收事件最多读取的字节数 */
+	virtual DWORD GetReadBudget			()	= 0;
+	/* 获取每次处理发送事件最多写入的字节数 */
+	virtual DWORD GetWriteBudget		()	= 0;
+	/* 获取每次处理接收或发送事件的最长时间 */
+	virtual DWORD GetIoTimeBudget		()	= 0;
 
 #ifdef _SSL_SUPPORT
 	/* 设置通信组件握手方式（默认：TRUE，自动握手） */
@@ -958,6 +1232,22 @@ public:
 	*/
 	virtual BOOL SendSmallFile(LPCTSTR lpszFileName, const LPWSABUF pHead = nullptr, const LPWSABUF pTail = nullptr)	= 0;
 
+	/*
+	* 名称：以引用方式发送多组数据
+	* 描述：向服务端顺序发送多组数据，较大的数据块不复制到发送缓冲区而是直接引用用户缓冲区，
+	*		用户缓冲区必须保持有效直到 fnRelease 被调用（数据全部发送完毕或连接关闭后调用）；
+	*		无论发送成功与否 fnRelease 都会被调用一次（SSL 连接的数据加密后立即调用），
+	*		fnRelease 为 nullptr 时等同于 SendPackets()
+	*		
+	* 参数：		pBuffers	-- 发送缓冲区数组
+	*			iCount		-- 发送缓冲区数目
+	*			fnRelease	-- 发送缓冲区释放函数
+	*			pvArg		-- 自定义参数（传递给 fnRelease）
+	* 返回值：	TRUE	-- 成功
+	*			FALSE	-- 失败，可通过 SYS_GetLastError() 获取错误代码
+	*/
+	virtual BOOL SendRefPackets(const WSABUF pBuffers[], int iCount, Fn_SendBufferRelease fnRelease, PVOID pvArg = nullptr)	= 0;
+
 #ifdef _SSL_SUPPORT
 	/*
 	* 名称：初始化通信组件 SSL 环境参数
@@ -1256,6 +1546,8 @@ public:
 	virtual EnCastMode GetCastMode		()														= 0;
 	/* 获取未发出数据的长度 */
 	virtual BOOL GetPendingDataLength	(int& iPending)											= 0;
+	/* 获取工作线程运行统计快照（pStats 为空或 dwCount 小于工作线程数量时返回 FALSE，并通过 dwCount 返回工作线程数量） */
+	virtual BOOL GetWorkerStats			(TWorkerStats pStats[], DWORD& dwCount)					= 0;
 
 	/* 设置数据报文最大长度（建议在局域网环境下不超过 1432 字节，在广域网环境下不超过 548 字节） */
 	virtual void SetMaxDatagramSize	(DWORD dwMaxDatagramSize)	= 0;
@@ -1405,6 +1697,40 @@ public:
 	*/
 	virtual EnFetchResult Peek	(CONNID dwConnID, BYTE* pData, int iLength)	= 0;
 
+	/*
+	* 名称：窥探数据视图（不会移除缓冲区数据，不复制数据）
+	* 描述：用户通过该方法获取连接接收缓冲区中前 iLength 字节数据所在的连续内存段；
+	*		内存段只在下一次 Fetch() / Skip() 或 OnReceive() 事件返回前有效，在 OnReceive() 事件中调用时无需查找连接缓冲区
+	*		
+	* 参数：		dwConnID	-- 连接 ID
+	*			pBuffers	-- 内存段数组
+	*			iCount		-- 内存段数组长度（输入：数组长度；输出：覆盖 iLength 字节所需的内存段数量）
+	*			iLength		-- 窥探数据长度
+	* 返回值：	EnFetchResult（数据不足时返回 FR_LENGTH_TOO_LONG 且 iCount 为 0；数组长度不足时返回 FR_LENGTH_TOO_LONG 且 iCount 为所需数量）
+	*/
+	virtual EnFetchResult PeekView	(CONNID dwConnID, WSABUF pBuffers[], int& iCount, int iLength)	= 0;
+
+	/*
+	* 名称：跳过数据
+	* 描述：用户通过该方法移除连接接收缓冲区中前 iLength 字节数据（通常在处理完 PeekView() 获取的数据后调用）
+	*		
+	* 参数：		dwConnID	-- 连接 ID
+	*			iLength		-- 跳过数据长度
+	* 返回值：	EnFetchResult
+	*/
+	virtual EnFetchResult Skip		(CONNID dwConnID, int iLength)	= 0;
+
+public:
+
+	/***********************************************************************/
+	/***************************** 属性访问方法 *****************************/
+
+	/* 设置是否启用直接接收（启用后数据通过 readv() 直接读取到连接接收缓冲区，省去一次内存复制；SSL 组件忽略该设置，默认：FALSE） */
+	virtual void SetDirectReceive	(BOOL bDirectReceive)	= 0;
+
+	/* 检测是否启用直接接收 */
+	virtual BOOL IsDirectReceive	()						= 0;
+
 public:
 	virtual ~IPullSocket() = default;
 };
@@ -1437,6 +1763,27 @@ public:
 	*/
 	virtual EnFetchResult Peek	(BYTE* pData, int iLength)	= 0;
 
+	/*
+	* 名称：窥探数据视图（不会移除缓冲区数据，不复制数据）
+	* 描述：用户通过该方法获取接收缓冲区中前 iLength 字节数据所在的连续内存段；
+	*		内存段只在下一次 Fetch() / Skip() 或 OnReceive() 事件返回前有效
+	*		
+	* 参数：		pBuffers	-- 内存段数组
+	*			iCount		-- 内存段数组长度（输入：数组长度；输出：覆盖 iLength 字节所需的内存段数量）
+	*			iLength		-- 窥探数据长度
+	* 返回值：	EnFetchResult（数据不足时返回 FR_LENGTH_TOO_LONG 且 iCount 为 0；数组长度不足时返回 FR_LENGTH_TOO_LONG 且 iCount 为所需数量）
+	*/
+	virtual EnFetchResult PeekView	(WSABUF pBuffers[], int& iCount, int iLength)	= 0;
+
+	/*
+	* 名称：跳过数据
+	* 描述：用户通过该方法移除接收缓冲区中前 iLength 字节数据（通常在处理完 PeekView() 获取的数据后调用）
+	*		
+	* 参数：		iLength		-- 跳过数据长度
+	* 返回值：	EnFetchResult
+	*/
+	virtual EnFetchResult Skip		(int iLength)	= 0;
+
 public:
 	virtual ~IPullClient() = default;
 };
@@ -1464,11 +1811,19 @@ public:
 	virtual void SetMaxPackSize		(DWORD dwMaxPackSize)			= 0;
 	/* 设置包头标识（有效包头标识取值范围 0 ~ 1023/0x3FF，当包头标识为 0 时不校验包头，默认：0） */
 	virtual void SetPackHeaderFlag	(USHORT usPackHeaderFlag)		= 0;
+	/* 设置是否启用批量接收（启用后一次读取中解析出的所有完整数据包通过 OnReceiveBatch() 事件一次性交付，默认：FALSE） */
+	virtual void SetReceiveBatch	(BOOL bReceiveBatch)			= 0;
+	/* 设置是否启用直接接收（启用后数据通过 readv() 直接读取到连接接收缓冲区，位于同一个缓冲节点中的数据包直接在缓冲节点中分发；SSL 组件忽略该设置，默认：FALSE） */
+	virtual void SetDirectReceive	(BOOL bDirectReceive)			= 0;
 
 	/* 获取数据包最大长度 */
 	virtual DWORD GetMaxPackSize	()								= 0;
 	/* 获取包头标识 */
 	virtual USHORT GetPackHeaderFlag()								= 0;
+	/* 检测是否启用批量接收 */
+	virtual BOOL IsReceiveBatch		()								= 0;
+	/* 检测是否启用直接接收 */
+	virtual BOOL IsDirectReceive	()								= 0;
 
 public:
 	virtual ~IPackSocket() = default;
@@ -1489,11 +1844,15 @@ public:
 	virtual void SetMaxPackSize		(DWORD dwMaxPackSize)			= 0;
 	/* 设置包头标识（有效包头标识取值范围 0 ~ 1023/0x3FF，当包头标识为 0 时不校验包头，默认：0） */
 	virtual void SetPackHeaderFlag	(USHORT usPackHeaderFlag)		= 0;
+	/* 设置是否启用批量接收（启用后一次读取中解析出的所有完整数据包通过 OnReceiveBatch() 事件一次性交付，默认：FALSE） */
+	virtual void SetReceiveBatch	(BOOL bReceiveBatch)			= 0;
 
 	/* 获取数据包最大长度 */
 	virtual DWORD GetMaxPackSize	()								= 0;
 	/* 获取包头标识 */
 	virtual USHORT GetPackHeaderFlag()								= 0;
+	/* 检测是否启用批量接收 */
+	virtual BOOL IsReceiveBatch		()								= 0;
 
 public:
 	virtual ~IPackClient() = default;
@@ -1638,6 +1997,46 @@ class ITcpServerListener : public IServerListenerT<ITcpServer>
 {
 public:
 
+	/*
+	* 名称：发送缓冲区高水位通知
+	* 描述：连接的待发送数据达到高水位（参考 SetSendHighWatermark()）后，Socket 监听器将在工作线程中收到该通知；
+	*		此后该连接的发送操作立即失败（错误代码：ERROR_NOT_ENOUGH_QUOTA），直到待发送数据降至低水位并触发 OnSendBufferDrained()
+	*		
+	* 参数：		pSender		-- 事件源对象
+	*			dwConnID	-- 连接 ID
+	*			iPending	-- 待发送数据长度
+	* 返回值：	HR_OK / HR_IGNORE	-- 继续执行
+	*			HR_ERROR			-- 引发 OnClose() 事件并关闭连接
+	*/
+	virtual EnHandleResult OnSendBufferHigh(ITcpServer* pSender, CONNID dwConnID, int iPending)		= 0;
+
+	/*
+	* 名称：发送缓冲区已排空通知
+	* 描述：触发 OnSendBufferHigh() 的连接的待发送数据降至低水位（参考 SetSendLowWatermark()）后，
+	*		Socket 监听器将在工作线程中收到该通知，此后该连接恢复发送
+	*		
+	* 参数：		pSender		-- 事件源对象
+	*			dwConnID	-- 连接 ID
+	*			iPending	-- 待发送数据长度
+	* 返回值：	HR_OK / HR_IGNORE	-- 继续执行
+	*			HR_ERROR			-- 引发 OnClose() 事件并关闭连接
+	*/
+	virtual EnHandleResult OnSendBufferDrained(ITcpServer* pSender, CONNID dwConnID, int iPending)	= 0;
+
+	/*
+	* 名称：批量数据到达通知（PACK 模型）
+	* 描述：PACK 模型组件启用批量接收（参考 SetReceiveBatch()）后，一次读取中解析出的所有完整数据包
+	*		通过该通知一次性交付，取代逐个数据包的 OnReceive() 通知；数据包内存只在通知期间有效
+	*		
+	* 参数：		pSender		-- 事件源对象
+	*			dwConnID	-- 连接 ID
+	*			pFrames		-- 数据包数组
+	*			iCount		-- 数据包数量
+	* 返回值：	HR_OK / HR_IGNORE	-- 继续执行
+	*			HR_ERROR			-- 引发 OnClose() 事件并关闭连接
+	*/
+	virtual EnHandleResult OnReceiveBatch(ITcpServer* pSender, CONNID dwConnID, const WSABUF pFrames[], int iCount)	= 0;
+
 };
 
 /************************************************************************
@@ -1653,6 +2052,20 @@ public:
 	virtual EnHandleResult OnReceive(ITcpServer* pSender, CONNID dwConnID, int iLength)						override {return HR_IGNORE;}
 	virtual EnHandleResult OnSend(ITcpServer* pSender, CONNID dwConnID, const BYTE* pData, int iLength)		override {return HR_IGNORE;}
 	virtual EnHandleResult OnShutdown(ITcpServer* pSender)													override {return HR_IGNORE;}
+	virtual EnHandleResult OnSendBufferHigh(ITcpServer* pSender, CONNID dwConnID, int iPending)				override {return HR_IGNORE;}
+	virtual EnHandleResult OnSendBufferDrained(ITcpServer* pSender, CONNID dwConnID, int iPending)			override {return HR_IGNORE;}
+	virtual EnHandleResult OnReceiveBatch(ITcpServer* pSender, CONNID dwConnID, const WSABUF pFrames[], int iCount)	override
+	{
+		ITcpServerListener* pListener = this;
+
+		for(int i = 0; i < iCount; i++)
+		{
+			if(pListener->OnReceive(pSender, dwConnID, (const BYTE*)pFrames[i].buf, (int)pFrames[i].len) == HR_ERROR)
+				return HR_ERROR;
+		}
+
+		return HR_OK;
+	}
 };
 
 /************************************************************************
@@ -1737,6 +2150,46 @@ class ITcpAgentListener : public IAgentListenerT<ITcpAgent>
 {
 public:
 
+	/*
+	* 名称：发送缓冲区高水位通知
+	* 描述：连接的待发送数据达到高水位（参考 SetSendHighWatermark()）后，Socket 监听器将在工作线程中收到该通知；
+	*		此后该连接的发送操作立即失败（错误代码：ERROR_NOT_ENOUGH_QUOTA），直到待发送数据降至低水位并触发 OnSendBufferDrained()
+	*		
+	* 参数：		pSender		-- 事件源对象
+	*			dwConnID	-- 连接 ID
+	*			iPending	-- 待发送数据长度
+	* 返回值：	HR_OK / HR_IGNORE	-- 继续执行
+	*			HR_ERROR			-- 引发 OnClose() 事件并关闭连接
+	*/
+	virtual EnHandleResult OnSendBufferHigh(ITcpAgent* pSender, CONNID dwConnID, int iPending)		= 0;
+
+	/*
+	* 名称：发送缓冲区已排空通知
+	* 描述：触发 OnSendBufferHigh() 的连接的待发送数据降至低水位（参考 SetSendLowWatermark()）后，
+	*		Socket 监听器将在工作线程中收到该通知，此后该连接恢复发送
+	*		
+	* 参数：		pSender		-- 事件源对象
+	*			dwConnID	-- 连接 ID
+	*			iPending	-- 待发送数据长度
+	* 返回值：	HR_OK / HR_IGNORE	-- 继续执行
+	*			HR_ERROR			-- 引发 OnClose() 事件并关闭连接
+	*/
+	virtual EnHandleResult OnSendBufferDrained(ITcpAgent* pSender, CONNID dwConnID, int iPending)	= 0;
+
+	/*
+	* 名称：批量数据到达通知（PACK 模型）
+	* 描述：PACK 模型组件启用批量接收（参考 SetReceiveBatch()）后，一次读取中解析出的所有完整数据包
+	*		通过该通知一次性交付，取代逐个数据包的 OnReceive() 通知；数据包内存只在通知期间有效
+	*		
+	* 参数：		pSender		-- 事件源对象
+	*			dwConnID	-- 连接 ID
+	*			pFrames		-- 数据包数组
+	*			iCount		-- 数据包数量
+	* 返回值：	HR_OK / HR_IGNORE	-- 继续执行
+	*			HR_ERROR			-- 引发 OnClose() 事件并关闭连接
+	*/
+	virtual EnHandleResult OnReceiveBatch(ITcpAgent* pSender, CONNID dwConnID, const WSABUF pFrames[], int iCount)	= 0;
+
 };
 
 /************************************************************************
@@ -1752,6 +2205,20 @@ public:
 	virtual EnHandleResult OnReceive(ITcpAgent* pSender, CONNID dwConnID, int iLength)						override {return HR_IGNORE;}
 	virtual EnHandleResult OnSend(ITcpAgent* pSender, CONNID dwConnID, const BYTE* pData, int iLength)		override {return HR_IGNORE;}
 	virtual EnHandleResult OnShutdown(ITcpAgent* pSender)													override {return HR_IGNORE;}
+	virtual EnHandleResult OnSendBufferHigh(ITcpAgent* pSender, CONNID dwConnID, int iPending)				override {return HR_IGNORE;}
+	virtual EnHandleResult OnSendBufferDrained(ITcpAgent* pSender, CONNID dwConnID, int iPending)			override {return HR_IGNORE;}
+	virtual EnHandleResult OnReceiveBatch(ITcpAgent* pSender, CONNID dwConnID, const WSABUF pFrames[], int iCount)	override
+	{
+		ITcpAgentListener* pListener = this;
+
+		for(int i = 0; i < iCount; i++)
+		{
+			if(pListener->OnReceive(pSender, dwConnID, (const BYTE*)pFrames[i].buf, (int)pFrames[i].len) == HR_ERROR)
+				return HR_ERROR;
+		}
+
+		return HR_OK;
+	}
 };
 
 /************************************************************************
@@ -1808,6 +2275,20 @@ class ITcpClientListener : public IClientListenerT<ITcpClient>
 {
 public:
 
+	/*
+	* 名称：批量数据到达通知（PACK 模型）
+	* 描述：PACK 模型组件启用批量接收（参考 SetReceiveBatch()）后，一次读取中解析出的所有完整数据包
+	*		通过该通知一次性交付，取代逐个数据包的 OnReceive() 通知；数据包内存只在通知期间有效
+	*		
+	* 参数：		pSender		-- 事件源对象
+	*			dwConnID	-- 连接 ID
+	*			pFrames		-- 数据包数组
+	*			iCount		-- 数据包数量
+	* 返回值：	HR_OK / HR_IGNORE	-- 继续执行
+	*			HR_ERROR			-- 引发 OnClose() 事件并关闭连接
+	*/
+	virtual EnHandleResult OnReceiveBatch(ITcpClient* pSender, CONNID dwConnID, const WSABUF pFrames[], int iCount)	= 0;
+
 };
 
 /************************************************************************
@@ -1822,6 +2303,18 @@ public:
 	virtual EnHandleResult OnHandShake(ITcpClient* pSender, CONNID dwConnID)								override {return HR_IGNORE;}
 	virtual EnHandleResult OnReceive(ITcpClient* pSender, CONNID dwConnID, int iLength)						override {return HR_IGNORE;}
 	virtual EnHandleResult OnSend(ITcpClient* pSender, CONNID dwConnID, const BYTE* pData, int iLength)		override {return HR_IGNORE;}
+	virtual EnHandleResult OnReceiveBatch(ITcpClient* pSender, CONNID dwConnID, const WSABUF pFrames[], int iCount)	override
+	{
+		ITcpClientListener* pListener = this;
+
+		for(int i = 0; i < iCount; i++)
+		{
+			if(pListener->OnReceive(pSender, dwConnID, (const BYTE*)pFrames[i].buf, (int)pFrames[i].len) == HR_ERROR)
+				return HR_ERROR;
+		}
+
+		return HR_OK;
+	}
 };
 
 /************************************************************************
@@ -2203,6 +2696,23 @@ public:
 	*/
 	virtual BOOL SendWSMessage(CONNID dwConnID, BOOL bFinal, BYTE iReserved, BYTE iOperationCode, const BYTE* pData = nullptr, int iLength = 0, ULONGLONG ullBodyLen = 0)	= 0;
 
+	/*
+	* 名称：广播 WebSocket 消息
+	* 描述：向多个连接发送同一 WebSocket 消息，消息帧只构造一次并由各连接共享（参考 ITcpServer::Broadcast()）
+	*		
+	* 参数：		pIDs			-- 连接 ID 数组
+	*			dwCount			-- 连接 ID 数目
+	*			bFinal			-- 是否结束帧
+	*			iReserved		-- RSV1/RSV2/RSV3 各 1 位
+	*			iOperationCode	-- 操作码：0x0 - 0xF
+	*			pData			-- 消息体数据缓冲区
+	*			iLength			-- 消息体数据长度
+	*			ullBodyLen		-- 消息总长度（参考 SendWSMessage()）
+	* 返回值：	TRUE			-- 成功（至少一个连接发送成功）
+	*			FALSE			-- 失败
+	*/
+	virtual BOOL BroadcastWSMessage(const CONNID pIDs[], DWORD dwCount, BOOL bFinal, BYTE iReserved, BYTE iOperationCode, const BYTE* pData = nullptr, int iLength = 0, ULONGLONG ullBodyLen = 0)	= 0;
+
 	/*
 	* 名称：回复请求
 	* 描述：向客户端回复 HTTP 请求
@@ -2221,7 +2731,7 @@ public:
 
 	/*
 	* 名称：发送本地文件
-	* 描述：向指定连接发送 4096 KB 以下的小文件
+	* 描述：向指定连接发送本地文件（通过 sendfile() 发送，不限文件大小；HTTPS 组件只能发送 4096 KB 以下的小文件）
 	*		
 	* 参数：		dwConnID		-- 连接 ID
 	*			lpszFileName	-- 文件路径
@@ -2234,6 +2744,21 @@ public:
 	*/
 	virtual BOOL SendLocalFile(CONNID dwConnID, LPCSTR lpszFileName, USHORT usStatusCode = HSC_OK, LPCSTR lpszDesc = nullptr, const THeader lpHeaders[] = nullptr, int iHeaderCount = 0)				= 0;
 
+	/*
+	* 名称：按范围发送本地文件
+	* 描述：根据 Range 请求头发送本地文件：范围有效时回复 206 和 Content-Range，范围无法满足时回复 416，
+	*		无 Range 请求头或包含多个范围时回复 200 和整个文件（通过 sendfile() 发送，HTTPS 组件受 4096 KB 限制）
+	*		
+	* 参数：		dwConnID		-- 连接 ID
+	*			lpszFileName	-- 文件路径
+	*			lpszRange		-- 范围（如："bytes=0-1023"，nullptr 则使用请求的 Range 请求头）
+	*			lpHeaders		-- 回复请求头
+	*			iHeaderCount	-- 回复请求头数量
+	* 返回值：	TRUE			-- 成功
+	*			FALSE			-- 失败
+	*/
+	virtual BOOL SendRangeFile(CONNID dwConnID, LPCSTR lpszFileName, LPCSTR lpszRange = nullptr, const THeader lpHeaders[] = nullptr, int iHeaderCount = 0)												= 0;
+
 	/*
 	* 名称：释放连接
 	* 描述：把连接放入释放队列，等待某个时间（通过 SetReleaseDelay() 设置）关闭连接
@@ -2752,6 +3277,9 @@ public:
 	virtual EnHandleResult OnReceive(ITcpServer* pSender, CONNID dwConnID, const BYTE* pData, int iLength)				override {return HR_IGNORE;}
 	virtual EnHandleResult OnSend(ITcpServer* pSender, CONNID dwConnID, const BYTE* pData, int iLength)					override {return HR_IGNORE;}
 	virtual EnHandleResult OnShutdown(ITcpServer* pSender)																override {return HR_IGNORE;}
+	virtual EnHandleResult OnSendBufferHigh(ITcpServer* pSender, CONNID dwConnID, int iPending)							override {return HR_IGNORE;}
+	virtual EnHandleResult OnSendBufferDrained(ITcpServer* pSender, CONNID dwConnID, int iPending)						override {return HR_IGNORE;}
+	virtual EnHandleResult OnReceiveBatch(ITcpServer* pSender, CONNID dwConnID, const WSABUF pFrames[], int iCount)		override {return HR_IGNORE;}
 
 	virtual EnHttpParseResult OnMessageBegin(IHttpServer* pSender, CONNID dwConnID)										override {return HPR_OK;}
 	virtual EnHttpParseResult OnRequestLine(IHttpServer* pSender, CONNID dwConnID, LPCSTR lpszMethod, LPCSTR lpszUrl)	override {return HPR_OK;}
@@ -2780,6 +3308,9 @@ public:
 	virtual EnHandleResult OnReceive(ITcpAgent* pSender, CONNID dwConnID, const BYTE* pData, int iLength)				override {return HR_IGNORE;}
 	virtual EnHandleResult OnSend(ITcpAgent* pSender, CONNID dwConnID, const BYTE* pData, int iLength)					override {return HR_IGNORE;}
 	virtual EnHandleResult OnShutdown(ITcpAgent* pSender)																override {return HR_IGNORE;}
+	virtual EnHandleResult OnSendBufferHigh(ITcpAgent* pSender, CONNID dwConnID, int iPending)							override {return HR_IGNORE;}
+	virtual EnHandleResult OnSendBufferDrained(ITcpAgent* pSender, CONNID dwConnID, int iPending)						override {return HR_IGNORE;}
+	virtual EnHandleResult OnReceiveBatch(ITcpAgent* pSender, CONNID dwConnID, const WSABUF pFrames[], int iCount)		override {return HR_IGNORE;}
 
 	virtual EnHttpParseResult OnMessageBegin(IHttpAgent* pSender, CONNID dwConnID)										override {return HPR_OK;}
 	virtual EnHttpParseResult OnRequestLine(IHttpAgent* pSender, CONNID dwConnID, LPCSTR lpszMethod, LPCSTR lpszUrl)	override {return HPR_OK;}
@@ -2808,6 +3339,7 @@ public:
 	virtual EnHandleResult OnReceive(ITcpClient* pSender, CONNID dwConnID, int iLength)									override {return HR_IGNORE;}
 	virtual EnHandleResult OnReceive(ITcpClient* pSender, CONNID dwConnID, const BYTE* pData, int iLength)				override {return HR_IGNORE;}
 	virtual EnHandleResult OnSend(ITcpClient* pSender, CONNID dwConnID, const BYTE* pData, int iLength)					override {return HR_IGNORE;}
+	virtual EnHandleResult OnReceiveBatch(ITcpClient* pSender, CONNID dwConnID, const WSABUF pFrames[], int iCount)		override {return HR_IGNORE;}
 
 	virtual EnHttpParseResult OnMessageBegin(IHttpClient* pSender, CONNID dwConnID)										override {return HPR_OK;}
 	virtual EnHttpParseResult OnRequestLine(IHttpClient* pSender, CONNID dwConnID, LPCSTR lpszMethod, LPCSTR lpszUrl)	override {return HPR_OK;}
@@ -2939,6 +3471,13 @@ public:
 	/***********************************************************************/
 	/***************************** 属性访问方法 *****************************/
 
+	/* 设置工作线程 CPU 亲和策略（lpszCpuList：CAP_LIST 策略的 CPU 列表，格式如 "0-3,8,10"） */
+	virtual void SetCpuAffinity(EnCpuAffinityPolicy enPolicy, LPCTSTR lpszCpuList = nullptr)	= 0;
+	/* 获取工作线程 CPU 亲和策略 */
+	virtual EnCpuAffinityPolicy GetCpuAffinityPolicy	()	= 0;
+	/* 获取工作线程 CPU 亲和列表 */
+	virtual LPCTSTR GetCpuAffinityList			()	= 0;
+
 	/* 检查线程池组件是否已启动 */
 	virtual BOOL HasStarted						()	= 0;
 	/* 查看线程池组件当前状态 */
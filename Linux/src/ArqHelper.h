@@ -613,29 +613,38 @@ template<class T, class S> class CArqSessionExT : public CArqSessionT<T, S>, pub
 
 public:
 	DWORD GetFreeTime	()	const	{return m_dwFreeTime;}
-	FD GetTimer			()	const	{return m_fdTimer;}
 
 protected:
 	virtual void RenewExtra(const TArqAttr& attr)
 	{
 		ResetCount();
 
-		m_fdTimer = m_ioDispatcher.AddTimer(attr.dwFlushInterval, this);
-		ASSERT(IS_VALID_FD(m_fdTimer));
+		/* 刷新定时器挂接到所属组件分发器中连接工作线程的时间轮，与连接的收发处理在同一线程执行 */
+		VERIFY(m_ioDispatcher.SetTimer(this->m_pSocket->index, &m_timer, attr.dwFlushInterval, attr.dwFlushInterval));
 	}
 
 	virtual void ResetExtra()
 	{
-		m_ioDispatcher.DelTimer(m_fdTimer);
+		m_ioDispatcher.KillTimer(&m_timer);
 
 		m_dwFreeTime = ::TimeGetTime();
-		m_fdTimer	 = INVALID_FD;
+	}
+
+private:
+	static void OnFlushTimer(PVOID pv)
+	{
+		CArqSessionExT* pSession = (CArqSessionExT*)pv;
+
+		CLocalSafeCounter localcounter(*pSession);
+
+		if(!pSession->Check() && pSession->IsValid() && S::IsValid(pSession->m_pSocket))
+			pSession->m_pContext->Disconnect(pSession->m_pSocket->connID);
 	}
 
 public:
 	CArqSessionExT(CIODispatcher& ioDispatcher)
 	: m_ioDispatcher(ioDispatcher)
-	, m_fdTimer		(INVALID_FD)
+	, m_timer		(OnFlushTimer, this)
 	, m_dwFreeTime	(0)
 	{
 
@@ -655,11 +664,11 @@ public:
 private:
 	CIODispatcher& m_ioDispatcher;
 
-	FD		m_fdTimer;
-	DWORD	m_dwFreeTime;
+	TDispTimer	m_timer;
+	DWORD		m_dwFreeTime;
 };
 
-template<class T, class S> class CArqSessionPoolT : private CIOHandler
+template<class T, class S> class CArqSessionPoolT
 {
 	using CArqSessionEx		= CArqSessionExT<T, S>;
 	using TArqSessionList	= CRingPool<CArqSessionEx>;
@@ -703,14 +712,10 @@ public:
 	void Prepare()
 	{
 		m_lsFreeSession.Reset(m_dwSessionPoolSize);
-
-		m_ioDispatcher.Start(this, m_pContext->GetPostReceiveCount(), m_pContext->GetWorkerThreadCount());
 	}
 
 	void Clear()
 	{
-		m_ioDispatcher.Stop();
-
 		m_lsFreeSession.Clear();
 
 		ReleaseGCSession(TRUE);
@@ -722,24 +727,6 @@ public:
 		::ReleaseGCObj(m_lsGCSession, m_dwSessionLockTime, bForce);
 	}
 
-	virtual BOOL OnReadyRead(const TDispContext* pContext, PVOID pv, UINT events) override
-	{
-
-		if(events & _EPOLL_ALL_ERROR_EVENTS)
-			return FALSE;
-
-		CArqSessionEx* pSession = (CArqSessionEx*)pv;
-
-		CLocalSafeCounter localcounter(*pSession);
-
-		if(!pSession->Check() && pSession->IsValid() && TUdpSocketObj::IsValid(pSession->m_pSocket))
-			pSession->m_pContext->Disconnect(pSession->m_pSocket->connID);
-
-		::ReadTimer(pSession->GetTimer());
-
-		return TRUE;
-	}
-
 public:
 	void SetSessionLockTime	(DWORD dwSessionLockTime)	{m_dwSessionLockTime = dwSessionLockTime;}
 	void SetSessionPoolSize	(DWORD dwSessionPoolSize)	{m_dwSessionPoolSize = dwSessionPoolSize;}
@@ -751,10 +738,12 @@ public:
 
 public:
 	CArqSessionPoolT(T* pContext,
+					CIODispatcher& ioDispatcher,
 					DWORD dwPoolSize = DEFAULT_SESSION_POOL_SIZE,
 					DWORD dwPoolHold = DEFAULT_SESSION_POOL_HOLD,
 					DWORD dwLockTime = DEFAULT_SESSION_LOCK_TIME)
 	: m_pContext(pContext)
+	, m_ioDispatcher(ioDispatcher)
 	, m_dwSessionPoolSize(dwPoolSize)
 	, m_dwSessionPoolHold(dwPoolHold)
 	, m_dwSessionLockTime(dwLockTime)
@@ -773,6 +762,7 @@ public:
 
 private:
 	T*					m_pContext;
+	CIODispatcher&		m_ioDispatcher;
 
 	DWORD				m_dwSessionLockTime;
 	DWORD				m_dwSessionPoolSize;
@@ -780,8 +770,6 @@ private:
 
 	TArqSessionList		m_lsFreeSession;
 	TArqSessionQueue	m_lsGCSession;
-
-	CIODispatcher		m_ioDispatcher;
 };
 
 template<class T, class S> const DWORD CArqSessionPoolT<T, S>::DEFAULT_SESSION_LOCK_TIME	= DEFAULT_OBJECT_CACHE_LOCK_TIME;
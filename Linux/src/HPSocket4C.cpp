@@ -416,6 +416,11 @@ HPSOCKET_API void __HP_CALL HP_Set_FN_Server_OnPullReceive(HP_ServerListener pLi
 	((C_HP_TcpServerListener*)pListener)->m_fnOnPullReceive = fn;
 }
 
+HPSOCKET_API void __HP_CALL HP_Set_FN_Server_OnReceiveBatch(HP_ServerListener pListener, HP_FN_Server_OnReceiveBatch fn)
+{
+	((C_HP_TcpServerListener*)pListener)->m_fnOnReceiveBatch = fn;
+}
+
 HPSOCKET_API void __HP_CALL HP_Set_FN_Server_OnClose(HP_ServerListener pListener, HP_FN_Server_OnClose fn)
 {
 	((C_HP_TcpServerListener*)pListener)->m_fnOnClose = fn;
@@ -426,6 +431,16 @@ HPSOCKET_API void __HP_CALL HP_Set_FN_Server_OnShutdown(HP_ServerListener pListe
 	((C_HP_TcpServerListener*)pListener)->m_fnOnShutdown = fn;
 }
 
+HPSOCKET_API void __HP_CALL HP_Set_FN_Server_OnSendBufferHigh(HP_ServerListener pListener, HP_FN_Server_OnSendBufferHigh fn)
+{
+	((C_HP_TcpServerListener*)pListener)->m_fnOnSendBufferHigh = fn;
+}
+
+HPSOCKET_API void __HP_CALL HP_Set_FN_Server_OnSendBufferDrained(HP_ServerListener pListener, HP_FN_Server_OnSendBufferDrained fn)
+{
+	((C_HP_TcpServerListener*)pListener)->m_fnOnSendBufferDrained = fn;
+}
+
 /**********************************************************************************/
 /***************************** Agent 回调函数设置方法 *****************************/
 
@@ -459,6 +474,11 @@ HPSOCKET_API void __HP_CALL HP_Set_FN_Agent_OnPullReceive(HP_AgentListener pList
 	((C_HP_TcpAgentListener*)pListener)->m_fnOnPullReceive = fn;
 }
 
+HPSOCKET_API void __HP_CALL HP_Set_FN_Agent_OnReceiveBatch(HP_AgentListener pListener, HP_FN_Agent_OnReceiveBatch fn)
+{
+	((C_HP_TcpAgentListener*)pListener)->m_fnOnReceiveBatch = fn;
+}
+
 HPSOCKET_API void __HP_CALL HP_Set_FN_Agent_OnClose(HP_AgentListener pListener, HP_FN_Agent_OnClose fn)
 {
 	((C_HP_TcpAgentListener*)pListener)->m_fnOnClose = fn;
@@ -469,6 +489,16 @@ HPSOCKET_API void __HP_CALL HP_Set_FN_Agent_OnShutdown(HP_AgentListener pListene
 	((C_HP_TcpAgentListener*)pListener)->m_fnOnShutdown = fn;
 }
 
+HPSOCKET_API void __HP_CALL HP_Set_FN_Agent_OnSendBufferHigh(HP_AgentListener pListener, HP_FN_Agent_OnSendBufferHigh fn)
+{
+	((C_HP_TcpAgentListener*)pListener)->m_fnOnSendBufferHigh = fn;
+}
+
+HPSOCKET_API void __HP_CALL HP_Set_FN_Agent_OnSendBufferDrained(HP_AgentListener pListener, HP_FN_Agent_OnSendBufferDrained fn)
+{
+	((C_HP_TcpAgentListener*)pListener)->m_fnOnSendBufferDrained = fn;
+}
+
 /**********************************************************************************/
 /***************************** Client 回调函数设置方法 *****************************/
 
@@ -502,6 +532,11 @@ HPSOCKET_API void __HP_CALL HP_Set_FN_Client_OnPullReceive(HP_ClientListener pLi
 	((C_HP_TcpClientListener*)pListener)->m_fnOnPullReceive = fn;
 }
 
+HPSOCKET_API void __HP_CALL HP_Set_FN_Client_OnReceiveBatch(HP_ClientListener pListener, HP_FN_Client_OnReceiveBatch fn)
+{
+	((C_HP_TcpClientListener*)pListener)->m_fnOnReceiveBatch = fn;
+}
+
 HPSOCKET_API void __HP_CALL HP_Set_FN_Client_OnClose(HP_ClientListener pListener, HP_FN_Client_OnClose fn)
 {
 	((C_HP_TcpClientListener*)pListener)->m_fnOnClose = fn;
@@ -578,6 +613,11 @@ HPSOCKET_API BOOL __HP_CALL HP_Server_PauseReceive(HP_Server pServer, HP_CONNID
 	return C_HP_Object::ToSecond<IServer>(pServer)->PauseReceive(dwConnID, bPause);
 }
 
+HPSOCKET_API BOOL __HP_CALL HP_Server_Post(HP_Server pServer, HP_CONNID dwConnID, HP_Fn_ConnTaskProc fnProc, PVOID pvArg)
+{
+	return C_HP_Object::ToSecond<IServer>(pServer)->Post(dwConnID, fnProc, pvArg);
+}
+
 HPSOCKET_API BOOL __HP_CALL HP_Server_Disconnect(HP_Server pServer, HP_CONNID dwConnID, BOOL bForce)
 {
 	return C_HP_Object::ToSecond<IServer>(pServer)->Disconnect(dwConnID, bForce);
@@ -656,6 +696,11 @@ HPSOCKET_API BOOL __HP_CALL HP_Server_GetAllConnectionIDs(HP_Server pServer, HP_
 	return C_HP_Object::ToSecond<IServer>(pServer)->GetAllConnectionIDs(pIDs, *pdwCount);
 }
 
+HPSOCKET_API BOOL __HP_CALL HP_Server_GetWorkerStats(HP_Server pServer, HP_TWorkerStats pStats[], DWORD* pdwCount)
+{
+	return C_HP_Object::ToSecond<IServer>(pServer)->GetWorkerStats(pStats, *pdwCount);
+}
+
 HPSOCKET_API BOOL __HP_CALL HP_Server_GetConnectPeriod(HP_Server pServer, HP_CONNID dwConnID, DWORD* pdwPeriod)
 {
 	return C_HP_Object::ToSecond<IServer>(pServer)->GetConnectPeriod(dwConnID, *pdwPeriod);
@@ -736,6 +781,11 @@ HPSOCKET_API void __HP_CALL HP_Server_SetMarkSilence(HP_Server pServer, BOOL bMa
 	C_HP_Object::ToSecond<IServer>(pServer)->SetMarkSilence(bMarkSilence);
 }
 
+HPSOCKET_API void __HP_CALL HP_Server_SetCpuAffinity(HP_Server pServer, En_HP_CpuAffinityPolicy enPolicy, LPCTSTR lpszCpuList)
+{
+	C_HP_Object::ToSecond<IServer>(pServer)->SetCpuAffinity(enPolicy, lpszCpuList);
+}
+
 HPSOCKET_API En_HP_ReuseAddressPolicy __HP_CALL HP_Server_GetReuseAddressPolicy(HP_Server pServer)
 {
 	return C_HP_Object::ToSecond<IServer>(pServer)->GetReuseAddressPolicy();
@@ -791,6 +841,16 @@ HPSOCKET_API BOOL __HP_CALL HP_Server_IsMarkSilence(HP_Server pServer)
 	return C_HP_Object::ToSecond<IServer>(pServer)->IsMarkSilence();
 }
 
+HPSOCKET_API En_HP_CpuAffinityPolicy __HP_CALL HP_Server_GetCpuAffinityPolicy(HP_Server pServer)
+{
+	return C_HP_Object::ToSecond<IServer>(pServer)->GetCpuAffinityPolicy();
+}
+
+HPSOCKET_API LPCTSTR __HP_CALL HP_Server_GetCpuAffinityList(HP_Server pServer)
+{
+	return C_HP_Object::ToSecond<IServer>(pServer)->GetCpuAffinityList();
+}
+
 /**********************************************************************************/
 /******************************* TCP Server 操作方法 *******************************/
 
@@ -799,6 +859,36 @@ HPSOCKET_API BOOL __HP_CALL HP_TcpServer_SendSmallFile(HP_Server pServer, HP_CON
 	return C_HP_Object::ToSecond<ITcpServer>(pServer)->SendSmallFile(dwConnID, lpszFileName, pHead, pTail);
 }
 
+HPSOCKET_API BOOL __HP_CALL HP_TcpServer_SendRefPackets(HP_Server pServer, HP_CONNID dwConnID, const WSABUF pBuffers[], int iCount, HP_Fn_SendBufferRelease fnRelease, PVOID pvArg)
+{
+	return C_HP_Object::ToSecond<ITcpServer>(pServer)->SendRefPackets(dwConnID, pBuffers, iCount, fnRelease, pvArg);
+}
+
+HPSOCKET_API BOOL __HP_CALL HP_TcpServer_SendFile(HP_Server pServer, HP_CONNID dwConnID, LPCTSTR lpszFileName, ULONGLONG ullOffset, ULONGLONG ullLength, const LPWSABUF pHead, const LPWSABUF pTail, HP_Fn_SendBufferRelease fnComplete, PVOID pvArg)
+{
+	return C_HP_Object::ToSecond<ITcpServer>(pServer)->SendFile(dwConnID, lpszFileName, ullOffset, ullLength, pHead, pTail, fnComplete, pvArg);
+}
+
+HPSOCKET_API BOOL __HP_CALL HP_TcpServer_Flush(HP_Server pServer, HP_CONNID dwConnID)
+{
+	return C_HP_Object::ToSecond<ITcpServer>(pServer)->Flush(dwConnID);
+}
+
+HPSOCKET_API BOOL __HP_CALL HP_TcpServer_SetConnectionCoalesceSize(HP_Server pServer, HP_CONNID dwConnID, DWORD dwCoalesceSize)
+{
+	return C_HP_Object::ToSecond<ITcpServer>(pServer)->SetConnectionCoalesceSize(dwConnID, dwCoalesceSize);
+}
+
+HPSOCKET_API BOOL __HP_CALL HP_TcpServer_Broadcast(HP_Server pServer, const HP_CONNID pIDs[], DWORD dwCount, const WSABUF pBuffers[], int iCount)
+{
+	return C_HP_Object::ToSecond<ITcpServer>(pServer)->Broadcast(pIDs, dwCount, pBuffers, iCount);
+}
+
+HPSOCKET_API BOOL __HP_CALL HP_TcpServer_BroadcastAll(HP_Server pServer, const WSABUF pBuffers[], int iCount)
+{
+	return C_HP_Object::ToSecond<ITcpServer>(pServer)->BroadcastAll(pBuffers, iCount);
+}
+
 /**********************************************************************************/
 /***************************** TCP Server 属性访问方法 *****************************/
 
@@ -807,6 +897,16 @@ HPSOCKET_API void __HP_CALL HP_TcpServer_SetAcceptSocketCount(HP_TcpServer pServ
 	C_HP_Object::ToSecond<ITcpServer>(pServer)->SetAcceptSocketCount(dwAcceptSocketCount);
 }
 
+HPSOCKET_API void __HP_CALL HP_TcpServer_SetAcceptBudget(HP_TcpServer pServer, DWORD dwAcceptBudget)
+{
+	C_HP_Object::ToSecond<ITcpServer>(pServer)->SetAcceptBudget(dwAcceptBudget);
+}
+
+HPSOCKET_API void __HP_CALL HP_TcpServer_SetDeferAcceptTime(HP_TcpServer pServer, DWORD dwDeferAcceptTime)
+{
+	C_HP_Object::ToSecond<ITcpServer>(pServer)->SetDeferAcceptTime(dwDeferAcceptTime);
+}
+
 HPSOCKET_API void __HP_CALL HP_TcpServer_SetSocketBufferSize(HP_TcpServer pServer, DWORD dwSocketBufferSize)
 {
 	C_HP_Object::ToSecond<ITcpServer>(pServer)->SetSocketBufferSize(dwSocketBufferSize);
@@ -832,11 +932,86 @@ HPSOCKET_API void __HP_CALL HP_TcpServer_SetNoDelay(HP_TcpServer pServer, BOOL b
 	C_HP_Object::ToSecond<ITcpServer>(pServer)->SetNoDelay(bNoDelay);
 }
 
+HPSOCKET_API void __HP_CALL HP_TcpServer_SetUseIOUring(HP_TcpServer pServer, BOOL bUseIOUring)
+{
+	C_HP_Object::ToSecond<ITcpServer>(pServer)->SetUseIOUring(bUseIOUring);
+}
+
+HPSOCKET_API void __HP_CALL HP_TcpServer_SetBusyPollTime(HP_TcpServer pServer, DWORD dwBusyPollTime)
+{
+	C_HP_Object::ToSecond<ITcpServer>(pServer)->SetBusyPollTime(dwBusyPollTime);
+}
+
+HPSOCKET_API void __HP_CALL HP_TcpServer_SetRebalanceThreshold(HP_TcpServer pServer, DWORD dwRebalanceThreshold)
+{
+	C_HP_Object::ToSecond<ITcpServer>(pServer)->SetRebalanceThreshold(dwRebalanceThreshold);
+}
+
+HPSOCKET_API void __HP_CALL HP_TcpServer_SetZeroCopyThreshold(HP_TcpServer pServer, DWORD dwZeroCopyThreshold)
+{
+	C_HP_Object::ToSecond<ITcpServer>(pServer)->SetZeroCopyThreshold(dwZeroCopyThreshold);
+}
+
+HPSOCKET_API void __HP_CALL HP_TcpServer_SetCoalesceSize(HP_TcpServer pServer, DWORD dwCoalesceSize)
+{
+	C_HP_Object::ToSecond<ITcpServer>(pServer)->SetCoalesceSize(dwCoalesceSize);
+}
+
+HPSOCKET_API void __HP_CALL HP_TcpServer_SetCoalesceDelay(HP_TcpServer pServer, DWORD dwCoalesceDelay)
+{
+	C_HP_Object::ToSecond<ITcpServer>(pServer)->SetCoalesceDelay(dwCoalesceDelay);
+}
+
+HPSOCKET_API void __HP_CALL HP_TcpServer_SetSendHighWatermark(HP_TcpServer pServer, DWORD dwSendHighWatermark)
+{
+	C_HP_Object::ToSecond<ITcpServer>(pServer)->SetSendHighWatermark(dwSendHighWatermark);
+}
+
+HPSOCKET_API void __HP_CALL HP_TcpServer_SetSendLowWatermark(HP_TcpServer pServer, DWORD dwSendLowWatermark)
+{
+	C_HP_Object::ToSecond<ITcpServer>(pServer)->SetSendLowWatermark(dwSendLowWatermark);
+}
+
+HPSOCKET_API void __HP_CALL HP_TcpServer_SetNotSentLowat(HP_TcpServer pServer, DWORD dwNotSentLowat)
+{
+	C_HP_Object::ToSecond<ITcpServer>(pServer)->SetNotSentLowat(dwNotSentLowat);
+}
+
+HPSOCKET_API void __HP_CALL HP_TcpServer_SetReadBudget(HP_TcpServer pServer, DWORD dwReadBudget)
+{
+	C_HP_Object::ToSecond<ITcpServer>(pServer)->SetReadBudget(dwReadBudget);
+}
+
+HPSOCKET_API void __HP_CALL HP_TcpServer_SetWriteBudget(HP_TcpServer pServer, DWORD dwWriteBudget)
+{
+	C_HP_Object::ToSecond<ITcpServer>(pServer)->SetWriteBudget(dwWriteBudget);
+}
+
+HPSOCKET_API void __HP_CALL HP_TcpServer_SetIoTimeBudget(HP_TcpServer pServer, DWORD dwIoTimeBudget)
+{
+	C_HP_Object::ToSecond<ITcpServer>(pServer)->SetIoTimeBudget(dwIoTimeBudget);
+}
+
+HPSOCKET_API void __HP_CALL HP_TcpServer_SetIdleTimeout(HP_TcpServer pServer, DWORD dwIdleTimeout)
+{
+	C_HP_Object::ToSecond<ITcpServer>(pServer)->SetIdleTimeout(dwIdleTimeout);
+}
+
 HPSOCKET_API DWORD __HP_CALL HP_TcpServer_GetAcceptSocketCount(HP_TcpServer pServer)
 {
 	return C_HP_Object::ToSecond<ITcpServer>(pServer)->GetAcceptSocketCount();
 }
 
+HPSOCKET_API DWORD __HP_CALL HP_TcpServer_GetAcceptBudget(HP_TcpServer pServer)
+{
+	return C_HP_Object::ToSecond<ITcpServer>(pServer)->GetAcceptBudget();
+}
+
+HPSOCKET_API DWORD __HP_CALL HP_TcpServer_GetDeferAcceptTime(HP_TcpServer pServer)
+{
+	return C_HP_Object::ToSecond<ITcpServer>(pServer)->GetDeferAcceptTime();
+}
+
 HPSOCKET_API DWORD __HP_CALL HP_TcpServer_GetSocketBufferSize(HP_TcpServer pServer)
 {
 	return C_HP_Object::ToSecond<ITcpServer>(pServer)->GetSocketBufferSize();
@@ -862,6 +1037,71 @@ HPSOCKET_API BOOL __HP_CALL HP_TcpServer_IsNoDelay(HP_TcpServer pServer)
 	return C_HP_Object::ToSecond<ITcpServer>(pServer)->IsNoDelay();
 }
 
+HPSOCKET_API BOOL __HP_CALL HP_TcpServer_IsUseIOUring(HP_TcpServer pServer)
+{
+	return C_HP_Object::ToSecond<ITcpServer>(pServer)->IsUseIOUring();
+}
+
+HPSOCKET_API DWORD __HP_CALL HP_TcpServer_GetBusyPollTime(HP_TcpServer pServer)
+{
+	return C_HP_Object::ToSecond<ITcpServer>(pServer)->GetBusyPollTime();
+}
+
+HPSOCKET_API DWORD __HP_CALL HP_TcpServer_GetRebalanceThreshold(HP_TcpServer pServer)
+{
+	return C_HP_Object::ToSecond<ITcpServer>(pServer)->GetRebalanceThreshold();
+}
+
+HPSOCKET_API DWORD __HP_CALL HP_TcpServer_GetZeroCopyThreshold(HP_TcpServer pServer)
+{
+	return C_HP_Object::ToSecond<ITcpServer>(pServer)->GetZeroCopyThreshold();
+}
+
+HPSOCKET_API DWORD __HP_CALL HP_TcpServer_GetCoalesceSize(HP_TcpServer pServer)
+{
+	return C_HP_Object::ToSecond<ITcpServer>(pServer)->GetCoalesceSize();
+}
+
+HPSOCKET_API DWORD __HP_CALL HP_TcpServer_GetCoalesceDelay(HP_TcpServer pServer)
+{
+	return C_HP_Object::ToSecond<ITcpServer>(pServer)->GetCoalesceDelay();
+}
+
+HPSOCKET_API DWORD __HP_CALL HP_TcpServer_GetSendHighWatermark(HP_TcpServer pServer)
+{
+	return C_HP_Object::ToSecond<ITcpServer>(pServer)->GetSendHighWatermark();
+}
+
+HPSOCKET_API DWORD __HP_CALL HP_TcpServer_GetSendLowWatermark(HP_TcpServer pServer)
+{
+	return C_HP_Object::ToSecond<ITcpServer>(pServer)->GetSendLowWatermark();
+}
+
+HPSOCKET_API DWORD __HP_CALL HP_TcpServer_GetNotSentLowat(HP_TcpServer pServer)
+{
+	return C_HP_Object::ToSecond<ITcpServer>(pServer)->GetNotSentLowat();
+}
+
+HPSOCKET_API DWORD __HP_CALL HP_TcpServer_GetReadBudget(HP_TcpServer pServer)
+{
+	return C_HP_Object::ToSecond<ITcpServer>(pServer)->GetReadBudget();
+}
+
+HPSOCKET_API DWORD __HP_CALL HP_TcpServer_GetWriteBudget(HP_TcpServer pServer)
+{
+	return C_HP_Object::ToSecond<ITcpServer>(pServer)->GetWriteBudget();
+}
+
+HPSOCKET_API DWORD __HP_CALL HP_TcpServer_GetIoTimeBudget(HP_TcpServer pServer)
+{
+	return C_HP_Object::ToSecond<ITcpServer>(pServer)->GetIoTimeBudget();
+}
+
+HPSOCKET_API DWORD __HP_CALL HP_TcpServer_GetIdleTimeout(HP_TcpServer pServer)
+{
+	return C_HP_Object::ToSecond<ITcpServer>(pServer)->GetIdleTimeout();
+}
+
 #ifdef _UDP_SUPPORT
 
 /**********************************************************************************/
@@ -1095,6 +1335,11 @@ HPSOCKET_API BOOL __HP_CALL HP_Agent_PauseReceive(HP_Agent pAgent, HP_CONNID dwC
 	return C_HP_Object::ToSecond<IAgent>(pAgent)->PauseReceive(dwConnID, bPause);
 }
 
+HPSOCKET_API BOOL __HP_CALL HP_Agent_Post(HP_Agent pAgent, HP_CONNID dwConnID, HP_Fn_ConnTaskProc fnProc, PVOID pvArg)
+{
+	return C_HP_Object::ToSecond<IAgent>(pAgent)->Post(dwConnID, fnProc, pvArg);
+}
+
 HPSOCKET_API BOOL __HP_CALL HP_Agent_Disconnect(HP_Agent pAgent, HP_CONNID dwConnID, BOOL bForce)
 {
 	return C_HP_Object::ToSecond<IAgent>(pAgent)->Disconnect(dwConnID, bForce);
@@ -1173,6 +1418,11 @@ HPSOCKET_API BOOL __HP_CALL HP_Agent_GetAllConnectionIDs(HP_Agent pAgent, HP_CON
 	return C_HP_Object::ToSecond<IAgent>(pAgent)->GetAllConnectionIDs(pIDs, *pdwCount);
 }
 
+HPSOCKET_API BOOL __HP_CALL HP_Agent_GetWorkerStats(HP_Agent pAgent, HP_TWorkerStats pStats[], DWORD* pdwCount)
+{
+	return C_HP_Object::ToSecond<IAgent>(pAgent)->GetWorkerStats(pStats, *pdwCount);
+}
+
 HPSOCKET_API BOOL __HP_CALL HP_Agent_GetConnectPeriod(HP_Agent pAgent, HP_CONNID dwConnID, DWORD* pdwPeriod)
 {
 	return C_HP_Object::ToSecond<IAgent>(pAgent)->GetConnectPeriod(dwConnID, *pdwPeriod);
@@ -1253,6 +1503,11 @@ HPSOCKET_API void __HP_CALL HP_Agent_SetMarkSilence(HP_Agent pAgent, BOOL bMarkS
 	C_HP_Object::ToSecond<IAgent>(pAgent)->SetMarkSilence(bMarkSilence);
 }
 
+HPSOCKET_API void __HP_CALL HP_Agent_SetCpuAffinity(HP_Agent pAgent, En_HP_CpuAffinityPolicy enPolicy, LPCTSTR lpszCpuList)
+{
+	C_HP_Object::ToSecond<IAgent>(pAgent)->SetCpuAffinity(enPolicy, lpszCpuList);
+}
+
 HPSOCKET_API En_HP_ReuseAddressPolicy __HP_CALL HP_Agent_GetReuseAddressPolicy(HP_Agent pAgent)
 {
 	return C_HP_Object::ToSecond<IAgent>(pAgent)->GetReuseAddressPolicy();
@@ -1308,6 +1563,16 @@ HPSOCKET_API BOOL __HP_CALL HP_Agent_IsMarkSilence(HP_Agent pAgent)
 	return C_HP_Object::ToSecond<IAgent>(pAgent)->IsMarkSilence();
 }
 
+HPSOCKET_API En_HP_CpuAffinityPolicy __HP_CALL HP_Agent_GetCpuAffinityPolicy(HP_Agent pAgent)
+{
+	return C_HP_Object::ToSecond<IAgent>(pAgent)->GetCpuAffinityPolicy();
+}
+
+HPSOCKET_API LPCTSTR __HP_CALL HP_Agent_GetCpuAffinityList(HP_Agent pAgent)
+{
+	return C_HP_Object::ToSecond<IAgent>(pAgent)->GetCpuAffinityList();
+}
+
 /**********************************************************************************/
 /******************************* TCP Agent 操作方法 *******************************/
 
@@ -1316,6 +1581,26 @@ HPSOCKET_API BOOL __HP_CALL HP_TcpAgent_SendSmallFile(HP_Agent pAgent, HP_CONNID
 	return C_HP_Object::ToSecond<ITcpAgent>(pAgent)->SendSmallFile(dwConnID, lpszFileName, pHead, pTail);
 }
 
+HPSOCKET_API BOOL __HP_CALL HP_TcpAgent_SendRefPackets(HP_Agent pAgent, HP_CONNID dwConnID, const WSABUF pBuffers[], int iCount, HP_Fn_SendBufferRelease fnRelease, PVOID pvArg)
+{
+	return C_HP_Object::ToSecond<ITcpAgent>(pAgent)->SendRefPackets(dwConnID, pBuffers, iCount, fnRelease, pvArg);
+}
+
+HPSOCKET_API BOOL __HP_CALL HP_TcpAgent_SendFile(HP_Agent pAgent, HP_CONNID dwConnID, LPCTSTR lpszFileName, ULONGLONG ullOffset, ULONGLONG ullLength, const LPWSABUF pHead, const LPWSABUF pTail, HP_Fn_SendBufferRelease fnComplete, PVOID pvArg)
+{
+	return C_HP_Object::ToSecond<ITcpAgent>(pAgent)->SendFile(dwConnID, lpszFileName, ullOffset, ullLength, pHead, pTail, fnComplete, pvArg);
+}
+
+HPSOCKET_API BOOL __HP_CALL HP_TcpAgent_Flush(HP_Agent pAgent, HP_CONNID dwConnID)
+{
+	return C_HP_Object::ToSecond<ITcpAgent>(pAgent)->Flush(dwConnID);
+}
+
+HPSOCKET_API BOOL __HP_CALL HP_TcpAgent_SetConnectionCoalesceSize(HP_Agent pAgent, HP_CONNID dwConnID, DWORD dwCoalesceSize)
+{
+	return C_HP_Object::ToSecond<ITcpAgent>(pAgent)->SetConnectionCoalesceSize(dwConnID, dwCoalesceSize);
+}
+
 /**********************************************************************************/
 /***************************** TCP Agent 属性访问方法 *****************************/
 
@@ -1344,6 +1629,66 @@ HPSOCKET_API void __HP_CALL HP_TcpAgent_SetNoDelay(HP_TcpAgent pAgent, BOOL bNoD
 	C_HP_Object::ToSecond<ITcpAgent>(pAgent)->SetNoDelay(bNoDelay);
 }
 
+HPSOCKET_API void __HP_CALL HP_TcpAgent_SetUseIOUring(HP_TcpAgent pAgent, BOOL bUseIOUring)
+{
+	C_HP_Object::ToSecond<ITcpAgent>(pAgent)->SetUseIOUring(bUseIOUring);
+}
+
+HPSOCKET_API void __HP_CALL HP_TcpAgent_SetBusyPollTime(HP_TcpAgent pAgent, DWORD dwBusyPollTime)
+{
+	C_HP_Object::ToSecond<ITcpAgent>(pAgent)->SetBusyPollTime(dwBusyPollTime);
+}
+
+HPSOCKET_API void __HP_CALL HP_TcpAgent_SetRebalanceThreshold(HP_TcpAgent pAgent, DWORD dwRebalanceThreshold)
+{
+	C_HP_Object::ToSecond<ITcpAgent>(pAgent)->SetRebalanceThreshold(dwRebalanceThreshold);
+}
+
+HPSOCKET_API void __HP_CALL HP_TcpAgent_SetZeroCopyThreshold(HP_TcpAgent pAgent, DWORD dwZeroCopyThreshold)
+{
+	C_HP_Object::ToSecond<ITcpAgent>(pAgent)->SetZeroCopyThreshold(dwZeroCopyThreshold);
+}
+
+HPSOCKET_API void __HP_CALL HP_TcpAgent_SetCoalesceSize(HP_TcpAgent pAgent, DWORD dwCoalesceSize)
+{
+	C_HP_Object::ToSecond<ITcpAgent>(pAgent)->SetCoalesceSize(dwCoalesceSize);
+}
+
+HPSOCKET_API void __HP_CALL HP_TcpAgent_SetCoalesceDelay(HP_TcpAgent pAgent, DWORD dwCoalesceDelay)
+{
+	C_HP_Object::ToSecond<ITcpAgent>(pAgent)->SetCoalesceDelay(dwCoalesceDelay);
+}
+
+HPSOCKET_API void __HP_CALL HP_TcpAgent_SetSendHighWatermark(HP_TcpAgent pAgent, DWORD dwSendHighWatermark)
+{
+	C_HP_Object::ToSecond<ITcpAgent>(pAgent)->SetSendHighWatermark(dwSendHighWatermark);
+}
+
+HPSOCKET_API void __HP_CALL HP_TcpAgent_SetSendLowWatermark(HP_TcpAgent pAgent, DWORD dwSendLowWatermark)
+{
+	C_HP_Object::ToSecond<ITcpAgent>(pAgent)->SetSendLowWatermark(dwSendLowWatermark);
+}
+
+HPSOCKET_API void __HP_CALL HP_TcpAgent_SetNotSentLowat(HP_TcpAgent pAgent, DWORD dwNotSentLowat)
+{
+	C_HP_Object::ToSecond<ITcpAgent>(pAgent)->SetNotSentLowat(dwNotSentLowat);
+}
+
+HPSOCKET_API void __HP_CALL HP_TcpAgent_SetReadBudget(HP_TcpAgent pAgent, DWORD dwReadBudget)
+{
+	C_HP_Object::ToSecond<ITcpAgent>(pAgent)->SetReadBudget(dwReadBudget);
+}
+
+HPSOCKET_API void __HP_CALL HP_TcpAgent_SetWriteBudget(HP_TcpAgent pAgent, DWORD dwWriteBudget)
+{
+	C_HP_Object::ToSecond<ITcpAgent>(pAgent)->SetWriteBudget(dwWriteBudget);
+}
+
+HPSOCKET_API void __HP_CALL HP_TcpAgent_SetIoTimeBudget(HP_TcpAgent pAgent, DWORD dwIoTimeBudget)
+{
+	C_HP_Object::ToSecond<ITcpAgent>(pAgent)->SetIoTimeBudget(dwIoTimeBudget);
+}
+
 HPSOCKET_API DWORD __HP_CALL HP_TcpAgent_GetSyncConnectTimeout(HP_TcpAgent pAgent)
 {
 	return C_HP_Object::ToSecond<ITcpAgent>(pAgent)->GetSyncConnectTimeout();
@@ -1369,6 +1714,66 @@ HPSOCKET_API BOOL __HP_CALL HP_TcpAgent_IsNoDelay(HP_TcpAgent pAgent)
 	return C_HP_Object::ToSecond<ITcpAgent>(pAgent)->IsNoDelay();
 }
 
+HPSOCKET_API BOOL __HP_CALL HP_TcpAgent_IsUseIOUring(HP_TcpAgent pAgent)
+{
+	return C_HP_Object::ToSecond<ITcpAgent>(pAgent)->IsUseIOUring();
+}
+
+HPSOCKET_API DWORD __HP_CALL HP_TcpAgent_GetBusyPollTime(HP_TcpAgent pAgent)
+{
+	return C_HP_Object::ToSecond<ITcpAgent>(pAgent)->GetBusyPollTime();
+}
+
+HPSOCKET_API DWORD __HP_CALL HP_TcpAgent_GetRebalanceThreshold(HP_TcpAgent pAgent)
+{
+	return C_HP_Object::ToSecond<ITcpAgent>(pAgent)->GetRebalanceThreshold();
+}
+
+HPSOCKET_API DWORD __HP_CALL HP_TcpAgent_GetZeroCopyThreshold(HP_TcpAgent pAgent)
+{
+	return C_HP_Object::ToSecond<ITcpAgent>(pAgent)->GetZeroCopyThreshold();
+}
+
+HPSOCKET_API DWORD __HP_CALL HP_TcpAgent_GetCoalesceSize(HP_TcpAgent pAgent)
+{
+	return C_HP_Object::ToSecond<ITcpAgent>(pAgent)->GetCoalesceSize();
+}
+
+HPSOCKET_API DWORD __HP_CALL HP_TcpAgent_GetCoalesceDelay(HP_TcpAgent pAgent)
+{
+	return C_HP_Object::ToSecond<ITcpAgent>(pAgent)->GetCoalesceDelay();
+}
+
+HPSOCKET_API DWORD __HP_CALL HP_TcpAgent_GetSendHighWatermark(HP_TcpAgent pAgent)
+{
+	return C_HP_Object::ToSecond<ITcpAgent>(pAgent)->GetSendHighWatermark();
+}
+
+HPSOCKET_API DWORD __HP_CALL HP_TcpAgent_GetSendLowWatermark(HP_TcpAgent pAgent)
+{
+	return C_HP_Object::ToSecond<ITcpAgent>(pAgent)->GetSendLowWatermark();
+}
+
+HPSOCKET_API DWORD __HP_CALL HP_TcpAgent_GetNotSentLowat(HP_TcpAgent pAgent)
+{
+	return C_HP_Object::ToSecond<ITcpAgent>(pAgent)->GetNotSentLowat();
+}
+
+HPSOCKET_API DWORD __HP_CALL HP_TcpAgent_GetReadBudget(HP_TcpAgent pAgent)
+{
+	return C_HP_Object::ToSecond<ITcpAgent>(pAgent)->GetReadBudget();
+}
+
+HPSOCKET_API DWORD __HP_CALL HP_TcpAgent_GetWriteBudget(HP_TcpAgent pAgent)
+{
+	return C_HP_Object::ToSecond<ITcpAgent>(pAgent)->GetWriteBudget();
+}
+
+HPSOCKET_API DWORD __HP_CALL HP_TcpAgent_GetIoTimeBudget(HP_TcpAgent pAgent)
+{
+	return C_HP_Object::ToSecond<ITcpAgent>(pAgent)->GetIoTimeBudget();
+}
+
 /******************************************************************************/
 /***************************** Client 组件操作方法 *****************************/
 
@@ -1523,6 +1928,11 @@ HPSOCKET_API BOOL __HP_CALL HP_TcpClient_SendSmallFile(HP_Client pClient, LPCTST
 	return C_HP_Object::ToSecond<ITcpClient>(pClient)->SendSmallFile(lpszFileName, pHead, pTail);
 }
 
+HPSOCKET_API BOOL __HP_CALL HP_TcpClient_SendRefPackets(HP_Client pClient, const WSABUF pBuffers[], int iCount, HP_Fn_SendBufferRelease fnRelease, PVOID pvArg)
+{
+	return C_HP_Object::ToSecond<ITcpClient>(pClient)->SendRefPackets(pBuffers, iCount, fnRelease, pvArg);
+}
+
 /**********************************************************************************/
 /***************************** TCP Client 属性访问方法 *****************************/
 
@@ -1883,6 +2293,11 @@ HPSOCKET_API BOOL __HP_CALL HP_UdpNode_GetPendingDataLength(HP_UdpNode pNode, in
 	return C_HP_Object::ToSecond<IUdpNode>(pNode)->GetPendingDataLength(*piPending);
 }
 
+HPSOCKET_API BOOL __HP_CALL HP_UdpNode_GetWorkerStats(HP_UdpNode pNode, HP_TWorkerStats pStats[], DWORD* pdwCount)
+{
+	return C_HP_Object::ToSecond<IUdpNode>(pNode)->GetWorkerStats(pStats, *pdwCount);
+}
+
 HPSOCKET_API void __HP_CALL HP_UdpNode_SetMaxDatagramSize(HP_UdpNode pNode, DWORD dwMaxDatagramSize)
 {
 	C_HP_Object::ToSecond<IUdpNode>(pNode)->SetMaxDatagramSize(dwMaxDatagramSize);
@@ -1978,9 +2393,29 @@ HPSOCKET_API En_HP_FetchResult __HP_CALL HP_TcpPullServer_Peek(HP_TcpPullServer
 	return C_HP_Object::ToFirst<IPullSocket>(pServer)->Peek(dwConnID, pData, iLength);
 }
 
+HPSOCKET_API En_HP_FetchResult __HP_CALL HP_TcpPullServer_PeekView(HP_TcpPullServer pServer, HP_CONNID dwConnID, WSABUF pBuffers[], int* piCount, int iLength)
+{
+	return C_HP_Object::ToFirst<IPullSocket>(pServer)->PeekView(dwConnID, pBuffers, *piCount, iLength);
+}
+
+HPSOCKET_API En_HP_FetchResult __HP_CALL HP_TcpPullServer_Skip(HP_TcpPullServer pServer, HP_CONNID dwConnID, int iLength)
+{
+	return C_HP_Object::ToFirst<IPullSocket>(pServer)->Skip(dwConnID, iLength);
+}
+
 /***************************************************************************************/
 /***************************** TCP Pull Server 属性访问方法 *****************************/
 
+HPSOCKET_API void __HP_CALL HP_TcpPullServer_SetDirectReceive(HP_TcpPullServer pServer, BOOL bDirectReceive)
+{
+	C_HP_Object::ToFirst<IPullSocket>(pServer)->SetDirectReceive(bDirectReceive);
+}
+
+HPSOCKET_API BOOL __HP_CALL HP_TcpPullServer_IsDirectReceive(HP_TcpPullServer pServer)
+{
+	return C_HP_Object::ToFirst<IPullSocket>(pServer)->IsDirectReceive();
+}
+
 /***************************************************************************************/
 /***************************** TCP Pull Agent 组件操作方法 *****************************/
 
@@ -1994,9 +2429,29 @@ HPSOCKET_API En_HP_FetchResult __HP_CALL HP_TcpPullAgent_Peek(HP_TcpPullAgent pA
 	return C_HP_Object::ToFirst<IPullSocket>(pAgent)->Peek(dwConnID, pData, iLength);
 }
 
+HPSOCKET_API En_HP_FetchResult __HP_CALL HP_TcpPullAgent_PeekView(HP_TcpPullAgent pAgent, HP_CONNID dwConnID, WSABUF pBuffers[], int* piCount, int iLength)
+{
+	return C_HP_Object::ToFirst<IPullSocket>(pAgent)->PeekView(dwConnID, pBuffers, *piCount, iLength);
+}
+
+HPSOCKET_API En_HP_FetchResult __HP_CALL HP_TcpPullAgent_Skip(HP_TcpPullAgent pAgent, HP_CONNID dwConnID, int iLength)
+{
+	return C_HP_Object::ToFirst<IPullSocket>(pAgent)->Skip(dwConnID, iLength);
+}
+
 /***************************************************************************************/
 /***************************** TCP Pull Agent 属性访问方法 *****************************/
 
+HPSOCKET_API void __HP_CALL HP_TcpPullAgent_SetDirectReceive(HP_TcpPullAgent pAgent, BOOL bDirectReceive)
+{
+	C_HP_Object::ToFirst<IPullSocket>(pAgent)->SetDirectReceive(bDirectReceive);
+}
+
+HPSOCKET_API BOOL __HP_CALL HP_TcpPullAgent_IsDirectReceive(HP_TcpPullAgent pAgent)
+{
+	return C_HP_Object::ToFirst<IPullSocket>(pAgent)->IsDirectReceive();
+}
+
 /***************************************************************************************/
 /***************************** TCP Pull Client 组件操作方法 *****************************/
 
@@ -2010,6 +2465,16 @@ HPSOCKET_API En_HP_FetchResult __HP_CALL HP_TcpPullClient_Peek(HP_TcpPullClient
 	return C_HP_Object::ToFirst<IPullClient>(pClient)->Peek(pData, iLength);
 }
 
+HPSOCKET_API En_HP_FetchResult __HP_CALL HP_TcpPullClient_PeekView(HP_TcpPullClient pClient, WSABUF pBuffers[], int* piCount, int iLength)
+{
+	return C_HP_Object::ToFirst<IPullClient>(pClient)->PeekView(pBuffers, *piCount, iLength);
+}
+
+HPSOCKET_API En_HP_FetchResult __HP_CALL HP_TcpPullClient_Skip(HP_TcpPullClient pClient, int iLength)
+{
+	return C_HP_Object::ToFirst<IPullClient>(pClient)->Skip(iLength);
+}
+
 /***************************************************************************************/
 /***************************** TCP Pull Client 属性访问方法 *****************************/
 
@@ -2029,6 +2494,16 @@ HPSOCKET_API void __HP_CALL HP_TcpPackServer_SetPackHeaderFlag(HP_TcpPackServer
 	C_HP_Object::ToFirst<IPackSocket>(pServer)->SetPackHeaderFlag(usPackHeaderFlag);
 }
 
+HPSOCKET_API void __HP_CALL HP_TcpPackServer_SetReceiveBatch(HP_TcpPackServer pServer, BOOL bReceiveBatch)
+{
+	C_HP_Object::ToFirst<IPackSocket>(pServer)->SetReceiveBatch(bReceiveBatch);
+}
+
+HPSOCKET_API void __HP_CALL HP_TcpPackServer_SetDirectReceive(HP_TcpPackServer pServer, BOOL bDirectReceive)
+{
+	C_HP_Object::ToFirst<IPackSocket>(pServer)->SetDirectReceive(bDirectReceive);
+}
+
 HPSOCKET_API DWORD __HP_CALL HP_TcpPackServer_GetMaxPackSize(HP_TcpPackServer pServer)
 {
 	return C_HP_Object::ToFirst<IPackSocket>(pServer)->GetMaxPackSize();
@@ -2039,6 +2514,16 @@ HPSOCKET_API USHORT __HP_CALL HP_TcpPackServer_GetPackHeaderFlag(HP_TcpPackServe
 	return C_HP_Object::ToFirst<IPackSocket>(pServer)->GetPackHeaderFlag();
 }
 
+HPSOCKET_API BOOL __HP_CALL HP_TcpPackServer_IsReceiveBatch(HP_TcpPackServer pServer)
+{
+	return C_HP_Object::ToFirst<IPackSocket>(pServer)->IsReceiveBatch();
+}
+
+HPSOCKET_API BOOL __HP_CALL HP_TcpPackServer_IsDirectReceive(HP_TcpPackServer pServer)
+{
+	return C_HP_Object::ToFirst<IPackSocket>(pServer)->IsDirectReceive();
+}
+
 /***************************************************************************************/
 /***************************** TCP Pack Agent 组件操作方法 *****************************/
 
@@ -2055,6 +2540,16 @@ HPSOCKET_API void __HP_CALL HP_TcpPackAgent_SetPackHeaderFlag(HP_TcpPackAgent pA
 	C_HP_Object::ToFirst<IPackSocket>(pAgent)->SetPackHeaderFlag(usPackHeaderFlag);
 }
 
+HPSOCKET_API void __HP_CALL HP_TcpPackAgent_SetReceiveBatch(HP_TcpPackAgent pAgent, BOOL bReceiveBatch)
+{
+	C_HP_Object::ToFirst<IPackSocket>(pAgent)->SetReceiveBatch(bReceiveBatch);
+}
+
+HPSOCKET_API void __HP_CALL HP_TcpPackAgent_SetDirectReceive(HP_TcpPackAgent pAgent, BOOL bDirectReceive)
+{
+	C_HP_Object::ToFirst<IPackSocket>(pAgent)->SetDirectReceive(bDirectReceive);
+}
+
 HPSOCKET_API DWORD __HP_CALL HP_TcpPackAgent_GetMaxPackSize(HP_TcpPackAgent pAgent)
 {
 	return C_HP_Object::ToFirst<IPackSocket>(pAgent)->GetMaxPackSize();
@@ -2065,6 +2560,16 @@ HPSOCKET_API USHORT __HP_CALL HP_TcpPackAgent_GetPackHeaderFlag(HP_TcpPackAgent
 	return C_HP_Object::ToFirst<IPackSocket>(pAgent)->GetPackHeaderFlag();
 }
 
+HPSOCKET_API BOOL __HP_CALL HP_TcpPackAgent_IsReceiveBatch(HP_TcpPackAgent pAgent)
+{
+	return C_HP_Object::ToFirst<IPackSocket>(pAgent)->IsReceiveBatch();
+}
+
+HPSOCKET_API BOOL __HP_CALL HP_TcpPackAgent_IsDirectReceive(HP_TcpPackAgent pAgent)
+{
+	return C_HP_Object::ToFirst<IPackSocket>(pAgent)->IsDirectReceive();
+}
+
 /***************************************************************************************/
 /***************************** TCP Pack Client 组件操作方法 *****************************/
 
@@ -2081,6 +2586,11 @@ HPSOCKET_API void __HP_CALL HP_TcpPackClient_SetPackHeaderFlag(HP_TcpPackClient
 	C_HP_Object::ToFirst<IPackClient>(pClient)->SetPackHeaderFlag(usPackHeaderFlag);
 }
 
+HPSOCKET_API void __HP_CALL HP_TcpPackClient_SetReceiveBatch(HP_TcpPackClient pClient, BOOL bReceiveBatch)
+{
+	C_HP_Object::ToFirst<IPackClient>(pClient)->SetReceiveBatch(bReceiveBatch);
+}
+
 HPSOCKET_API DWORD __HP_CALL HP_TcpPackClient_GetMaxPackSize(HP_TcpPackClient pClient)
 {
 	return C_HP_Object::ToFirst<IPackClient>(pClient)->GetMaxPackSize();
@@ -2091,6 +2601,11 @@ HPSOCKET_API USHORT __HP_CALL HP_TcpPackClient_GetPackHeaderFlag(HP_TcpPackClien
 	return C_HP_Object::ToFirst<IPackClient>(pClient)->GetPackHeaderFlag();
 }
 
+HPSOCKET_API BOOL __HP_CALL HP_TcpPackClient_IsReceiveBatch(HP_TcpPackClient pClient)
+{
+	return C_HP_Object::ToFirst<IPackClient>(pClient)->IsReceiveBatch();
+}
+
 /*****************************************************************************************************************************************************/
 /*************************************************************** Global Function Exports *************************************************************/
 /*****************************************************************************************************************************************************/
@@ -2619,6 +3134,16 @@ HPSOCKET_API void __HP_CALL HP_Set_FN_HttpServer_OnShutdown(HP_HttpServerListene
 	((C_HP_HttpServerListener*)pListener)->m_lsnServer.m_fnOnShutdown = fn;
 }
 
+HPSOCKET_API void __HP_CALL HP_Set_FN_HttpServer_OnSendBufferHigh(HP_HttpServerListener pListener, HP_FN_HttpServer_OnSendBufferHigh fn)
+{
+	((C_HP_HttpServerListener*)pListener)->m_lsnServer.m_fnOnSendBufferHigh = fn;
+}
+
+HPSOCKET_API void __HP_CALL HP_Set_FN_HttpServer_OnSendBufferDrained(HP_HttpServerListener pListener, HP_FN_HttpServer_OnSendBufferDrained fn)
+{
+	((C_HP_HttpServerListener*)pListener)->m_lsnServer.m_fnOnSendBufferDrained = fn;
+}
+
 /**********************************************************************************/
 /**************************** HTTP Agent 回调函数设置方法 **************************/
 
@@ -2722,6 +3247,16 @@ HPSOCKET_API void __HP_CALL HP_Set_FN_HttpAgent_OnShutdown(HP_HttpAgentListener
 	((C_HP_HttpAgentListener*)pListener)->m_lsnAgent.m_fnOnShutdown = fn;
 }
 
+HPSOCKET_API void __HP_CALL HP_Set_FN_HttpAgent_OnSendBufferHigh(HP_HttpAgentListener pListener, HP_FN_HttpAgent_OnSendBufferHigh fn)
+{
+	((C_HP_HttpAgentListener*)pListener)->m_lsnAgent.m_fnOnSendBufferHigh = fn;
+}
+
+HPSOCKET_API void __HP_CALL HP_Set_FN_HttpAgent_OnSendBufferDrained(HP_HttpAgentListener pListener, HP_FN_HttpAgent_OnSendBufferDrained fn)
+{
+	((C_HP_HttpAgentListener*)pListener)->m_lsnAgent.m_fnOnSendBufferDrained = fn;
+}
+
 /**********************************************************************************/
 /*************************** HTTP Client 回调函数设置方法 **************************/
 
@@ -2833,6 +3368,11 @@ HPSOCKET_API BOOL __HP_CALL HP_HttpServer_SendLocalFile(HP_HttpServer pServer, H
 	return C_HP_Object::ToFirst<IHttpServer>(pServer)->SendLocalFile(dwConnID, lpszFileName, usStatusCode, lpszDesc, lpHeaders, iHeaderCount);
 }
 
+HPSOCKET_API BOOL __HP_CALL HP_HttpServer_SendRangeFile(HP_HttpServer pServer, HP_CONNID dwConnID, LPCSTR lpszFileName, LPCSTR lpszRange, const HP_THeader lpHeaders[], int iHeaderCount)
+{
+	return C_HP_Object::ToFirst<IHttpServer>(pServer)->SendRangeFile(dwConnID, lpszFileName, lpszRange, lpHeaders, iHeaderCount);
+}
+
 HPSOCKET_API BOOL __HP_CALL HP_HttpServer_SendChunkData(HP_HttpServer pServer, HP_CONNID dwConnID, const BYTE* pData, int iLength, LPCSTR lpszExtensions)
 {
 	return C_HP_Object::ToFirst<IHttpServer>(pServer)->SendChunkData(dwConnID, pData, iLength, lpszExtensions);
@@ -2843,6 +3383,11 @@ HPSOCKET_API BOOL __HP_CALL HP_HttpServer_SendWSMessage(HP_HttpServer pServer, H
 	return C_HP_Object::ToFirst<IHttpServer>(pServer)->SendWSMessage(dwConnID, bFinal, iReserved, iOperationCode, pData, iLength, ullBodyLen);
 }
 
+HPSOCKET_API BOOL __HP_CALL HP_HttpServer_BroadcastWSMessage(HP_HttpServer pServer, const HP_CONNID pIDs[], DWORD dwCount, BOOL bFinal, BYTE iReserved, BYTE iOperationCode, const BYTE* pData, int iLength, ULONGLONG ullBodyLen)
+{
+	return C_HP_Object::ToFirst<IHttpServer>(pServer)->BroadcastWSMessage(pIDs, dwCount, bFinal, iReserved, iOperationCode, pData, iLength, ullBodyLen);
+}
+
 HPSOCKET_API BOOL __HP_CALL HP_HttpServer_Release(HP_HttpServer pServer, HP_CONNID dwConnID)
 {
 	return C_HP_Object::ToFirst<IHttpServer>(pServer)->Release(dwConnID);
@@ -3620,6 +4165,21 @@ HPSOCKET_API En_HP_RejectedPolicy __HP_CALL HP_ThreadPool_GetRejectedPolicy(HP_T
 	return ((IHPThreadPool*)pThreadPool)->GetRejectedPolicy();
 }
 
+HPSOCKET_API void __HP_CALL HP_ThreadPool_SetCpuAffinity(HP_ThreadPool pThreadPool, En_HP_CpuAffinityPolicy enPolicy, LPCTSTR lpszCpuList)
+{
+	((IHPThreadPool*)pThreadPool)->SetCpuAffinity(enPolicy, lpszCpuList);
+}
+
+HPSOCKET_API En_HP_CpuAffinityPolicy __HP_CALL HP_ThreadPool_GetCpuAffinityPolicy(HP_ThreadPool pThreadPool)
+{
+	return ((IHPThreadPool*)pThreadPool)->GetCpuAffinityPolicy();
+}
+
+HPSOCKET_API LPCTSTR __HP_CALL HP_ThreadPool_GetCpuAffinityList(HP_ThreadPool pThreadPool)
+{
+	return ((IHPThreadPool*)pThreadPool)->GetCpuAffinityList();
+}
+
 /*****************************************************************************************************************************************************/
 /********************************************************* Compressor / Decompressor Exports *********************************************************/
 /*****************************************************************************************************************************************************/
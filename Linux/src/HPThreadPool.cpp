@@ -22,6 +22,7 @@
 */
  
 #include "HPThreadPool.h"
+#include "SocketHelper.h"
 #include "common/FuncHelper.h"
 
 #include <pthread.h>
@@ -74,6 +75,14 @@ BOOL CHPThreadPool::Start(DWORD dwThreadCount, DWORD dwMaxQueueSize, EnRejectedP
 	if(!CheckStarting())
 		return FALSE;
 
+	if(!::MakeCpuAffinityList(m_enCpuAffinityPolicy, m_strCpuAffinityList, m_vtCpus))
+	{
+		Reset();
+		::SetLastError(ERROR_INVALID_PARAMETER);
+
+		return FALSE;
+	}
+
 	m_dwStackSize		= dwStackSize;
 	m_dwMaxQueueSize	= dwMaxQueueSize;
 	m_enRejectedPolicy	= enRejectedPolicy;
@@ -370,6 +379,12 @@ PVOID CHPThreadPool::ThreadProc(LPVOID pv)
 
 	::SetSequenceThreadName(SELF_THREAD_ID, pThis->m_strPrefix, pThis->m_uiSeq);
 
+	if(!pThis->m_vtCpus.empty())
+	{
+		UINT uiSeq = ::InterlockedIncrement(&pThis->m_uiCpuSeq);
+		::SetCurrentThreadCpuAffinity(pThis->m_vtCpus[uiSeq % pThis->m_vtCpus.size()]);
+	}
+
 	pThis->FireWorkerThreadStart();
 	
 	PVOID rs = (PVOID)(UINT_PTR)(pThis->WorkerProc());
@@ -477,6 +492,7 @@ BOOL CHPThreadPool::CheckStoping()
 void CHPThreadPool::Reset(BOOL bSetWaitEvent)
 {
 	m_uiSeq				= MAXUINT;
+	m_uiCpuSeq			= MAXUINT;
 	m_dwStackSize		= 0;
 	m_dwTaskCount		= 0;
 	m_dwThreadCount		= 0;
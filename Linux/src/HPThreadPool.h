@@ -90,6 +90,11 @@ public:
 	virtual DWORD GetMaxQueueSize()					{return m_dwMaxQueueSize;}
 	virtual EnRejectedPolicy GetRejectedPolicy()	{return m_enRejectedPolicy;}
 
+	virtual void SetCpuAffinity(EnCpuAffinityPolicy enPolicy, LPCTSTR lpszCpuList = nullptr)
+		{ENSURE_HAS_STOPPED(); m_enCpuAffinityPolicy = enPolicy; m_strCpuAffinityList = (lpszCpuList ? lpszCpuList : _T(""));}
+	virtual EnCpuAffinityPolicy GetCpuAffinityPolicy()	{return m_enCpuAffinityPolicy;}
+	virtual LPCTSTR GetCpuAffinityList()				{return m_strCpuAffinityList;}
+
 private:
 	BOOL CheckStarting();
 	BOOL CheckStarted();
@@ -122,7 +127,8 @@ private:
 
 public:
 	CHPThreadPool(IHPThreadPoolListener* pListener = nullptr)
-	: m_pListener(pListener)
+	: m_pListener			(pListener)
+	, m_enCpuAffinityPolicy	(CAP_NONE)
 	{
 		MakePrefix();
 		Reset(FALSE);
@@ -164,5 +170,10 @@ private:
 	CTaskQueue				m_lsTasks;
 	unordered_set<THR_ID>	m_stThreads;
 
+	EnCpuAffinityPolicy		m_enCpuAffinityPolicy;
+	CString					m_strCpuAffinityList;
+	vector<int>				m_vtCpus;
+	volatile UINT			m_uiCpuSeq;
+
 	DECLARE_NO_COPY_CLASS(CHPThreadPool)
 };
@@ -466,4 +466,77 @@ BOOL ParseUrl(const CStringA& strUrl, BOOL& bHttps, CStringA& strHost, USHORT& u
 	return TRUE;
 }
 
+static LPCSTR ParseRangeValue(LPCSTR lpszValue, ULONGLONG& ullValue, BOOL& bExist)
+{
+	bExist = ::isdigit(*lpszValue);
+
+	if(!bExist)
+		return lpszValue;
+
+	char* lpszEnd = nullptr;
+	ullValue	  = ::strtoull(lpszValue, &lpszEnd, 10);
+
+	return lpszEnd;
+}
+
+USHORT ParseHttpRange(LPCSTR lpszRange, ULONGLONG ullSize, ULONGLONG& ullOffset, ULONGLONG& ullLength)
+{
+	ullOffset = 0;
+	ullLength = ullSize;
+
+	if(::IsStrEmptyA(lpszRange))
+		return HSC_OK;
+
+	int iUnitLength = (int)strlen(HTTP_RANGE_UNIT_BYTES);
+
+	while(::isspace(*lpszRange)) ++lpszRange;
+
+	if(strnicmp(lpszRange, HTTP_RANGE_UNIT_BYTES, iUnitLength) != 0 || lpszRange[iUnitLength] != '=')
+		return HSC_OK;
+
+	/* 不支持多个范围，忽略 Range 请求头并回复整个文件 */
+	if(strchr(lpszRange, ',') != nullptr)
+		return HSC_OK;
+
+	BOOL bFirst, bLast;
+	ULONGLONG ullFirst = 0, ullLast = 0;
+
+	LPCSTR lpszValue = lpszRange + iUnitLength + 1;
+	while(::isspace(*lpszValue)) ++lpszValue;
+
+	lpszValue = ParseRangeValue(lpszValue, ullFirst, bFirst);
+
+	if(*lpszValue++ != '-')
+		return HSC_OK;
+
+	lpszValue = ParseRangeValue(lpszValue, ullLast, bLast);
+	while(::isspace(*lpszValue)) ++lpszValue;
+
+	if(*lpszValue != 0 || (!bFirst && !bLast) || (bFirst && bLast && ullLast < ullFirst))
+		return HSC_OK;
+
+	if(!bFirst)
+	{
+		/* 后缀范围："bytes=-N" 表示最后 N 个字节 */
+		if(ullLast == 0 || ullSize == 0)
+			return HSC_REQUESTED_RANGE_NOT_SATISFIABLE;
+
+		ullOffset = (ullLast >= ullSize) ? 0 : ullSize - ullLast;
+	}
+	else
+	{
+		if(ullFirst >= ullSize)
+			return HSC_REQUESTED_RANGE_NOT_SATISFIABLE;
+
+		ullOffset = ullFirst;
+
+		if(bLast && ullLast < ullSize - 1)
+			ullSize = ullLast + 1;
+	}
+
+	ullLength = ullSize - ullOffset;
+
+	return HSC_PARTIAL_CONTENT;
+}
+
 #endif
\ No newline at end of file
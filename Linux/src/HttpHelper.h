@@ -66,10 +66,14 @@ typedef llhttp_settings_t	http_parser_settings;
 #define HTTP_HEADER_TRANSFER_ENCODING		"Transfer-Encoding"
 #define HTTP_HEADER_CONNECTION				"Connection"
 #define HTTP_HEADER_UPGRADE					"Upgrade"
+#define HTTP_HEADER_RANGE					"Range"
+#define HTTP_HEADER_CONTENT_RANGE			"Content-Range"
+#define HTTP_HEADER_ACCEPT_RANGES			"Accept-Ranges"
 #define HTTP_HEADER_VALUE_WEB_SOCKET		"WebSocket"
 
 #define HTTP_CONNECTION_CLOSE_VALUE			"close"
 #define HTTP_CONNECTION_KEEPALIVE_VALUE		"keep-alive"
+#define HTTP_RANGE_UNIT_BYTES				"bytes"
 
 #define HTTP_METHOD_POST					"POST"
 #define HTTP_METHOD_PUT						"PUT"
@@ -1381,5 +1385,6 @@ extern void MakeHttpPacket(const CStringA& strHeader, const BYTE* pBody, int iLe
 extern int MakeChunkPackage(const BYTE* pData, int iLength, LPCSTR lpszExtensions, char szLen[12], WSABUF bufs[5]);
 extern BOOL MakeWSPacket(BOOL bFinal, BYTE iReserved, BYTE iOperationCode, const BYTE lpszMask[4], BYTE* pData, int iLength, ULONGLONG ullBodyLen, BYTE szHeader[HTTP_MAX_WS_HEADER_LEN], WSABUF szBuffer[2]);
 extern BOOL ParseUrl(const CStringA& strUrl, BOOL& bHttps, CStringA& strHost, USHORT& usPort, CStringA& strPath);
+extern USHORT ParseHttpRange(LPCSTR lpszRange, ULONGLONG ullSize, ULONGLONG& ullOffset, ULONGLONG& ullLength);
 
 #endif
\ No newline at end of file
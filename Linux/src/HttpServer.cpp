@@ -70,11 +70,24 @@ template<class T, USHORT default_port> BOOL CHttpServerT<T, default_port>::SendR
 }
 
 template<class T, USHORT default_port> BOOL CHttpServerT<T, default_port>::SendLocalFile(CONNID dwConnID, LPCSTR lpszFileName, USHORT usStatusCode, LPCSTR lpszDesc, const THeader lpHeaders[], int iHeaderCount)
+{
+	return DoSendLocalFile(dwConnID, lpszFileName, FALSE, nullptr, usStatusCode, lpszDesc, lpHeaders, iHeaderCount);
+}
+
+template<class T, USHORT default_port> BOOL CHttpServerT<T, default_port>::SendRangeFile(CONNID dwConnID, LPCSTR lpszFileName, LPCSTR lpszRange, const THeader lpHeaders[], int iHeaderCount)
+{
+	if(lpszRange == nullptr && !GetHeader(dwConnID, HTTP_HEADER_RANGE, &lpszRange))
+		lpszRange = nullptr;
+
+	return DoSendLocalFile(dwConnID, lpszFileName, TRUE, lpszRange, HSC_OK, nullptr, lpHeaders, iHeaderCount);
+}
+
+template<class T, USHORT default_port> BOOL CHttpServerT<T, default_port>::DoSendLocalFile(CONNID dwConnID, LPCSTR lpszFileName, BOOL bRange, LPCSTR lpszRange, USHORT usStatusCode, LPCSTR lpszDesc, const THeader lpHeaders[], int iHeaderCount)
 {
 	CFile file;
-	CFileMapping fmap;
+	ULONGLONG ullSize = 0;
 
-	HRESULT hr = ::ReadSmallFile(CA2T(lpszFileName), file, fmap);
+	HRESULT hr = ::OpenSendFile(CA2T(lpszFileName), file, 0, ullSize);
 
 	if(FAILED(hr))
 	{
@@ -82,7 +95,47 @@ template<class T, USHORT default_port> BOOL CHttpServerT<T, default_port>::SendL
 		return FALSE;
 	}
 
-	return SendResponse(dwConnID, usStatusCode, lpszDesc, lpHeaders, iHeaderCount, (BYTE*)fmap, (int)fmap.Size());
+	ULONGLONG ullOffset = 0;
+	ULONGLONG ullLength = ullSize;
+
+	vector<THeader> vtHeaders(lpHeaders, lpHeaders + iHeaderCount);
+	CStringA strRange, strLength;
+
+	if(bRange)
+	{
+		usStatusCode = ::ParseHttpRange(lpszRange, ullSize, ullOffset, ullLength);
+
+		if(usStatusCode == HSC_PARTIAL_CONTENT)
+			strRange.Format(HTTP_RANGE_UNIT_BYTES " %llu-%llu/%llu", ullOffset, ullOffset + ullLength - 1, ullSize);
+		else if(usStatusCode == HSC_REQUESTED_RANGE_NOT_SATISFIABLE)
+		{
+			strRange.Format(HTTP_RANGE_UNIT_BYTES " */%llu", ullSize);
+			ullLength = 0;
+		}
+
+		vtHeaders.push_back({HTTP_HEADER_ACCEPT_RANGES, HTTP_RANGE_UNIT_BYTES});
+
+		if(!strRange.IsEmpty())
+			vtHeaders.push_back({HTTP_HEADER_CONTENT_RANGE, strRange});
+	}
+
+	auto HasHeader = [&vtHeaders](LPCSTR lpszName) {return find_if(vtHeaders.begin(), vtHeaders.end(), [lpszName](const THeader& header) {return header.name != nullptr && stricmp(header.name, lpszName) == 0;}) != vtHeaders.end();};
+
+	/* 文件长度可能超过 int 范围，由这里生成 Content-Length 头（调用者已指定 Content-Length 或 Transfer-Encoding 时不生成） */
+	if(!HasHeader(HTTP_HEADER_CONTENT_LENGTH) && !HasHeader(HTTP_HEADER_TRANSFER_ENCODING))
+	{
+		strLength.Format("%llu", ullLength);
+		vtHeaders.push_back({HTTP_HEADER_CONTENT_LENGTH, strLength});
+	}
+
+	CStringA strHeader;
+
+	::MakeStatusLine(m_enLocalVersion, usStatusCode, lpszDesc, strHeader);
+	::MakeHeaderLines(vtHeaders.data(), (int)vtHeaders.size(), nullptr, 0, FALSE, IsKeepAlive(dwConnID), nullptr, 0, strHeader);
+
+	WSABUF szHead[1] = {{(UINT)strHeader.GetLength(), (LPBYTE)(LPCSTR)strHeader}};
+
+	return __super::DoSendFile(dwConnID, file, ullOffset, ullLength, szHead, nullptr, nullptr, nullptr);
 }
 
 template<class T, USHORT default_port> BOOL CHttpServerT<T, default_port>::SendChunkData(CONNID dwConnID, const BYTE* pData, int iLength, LPCSTR lpszExtensions)
@@ -123,6 +176,18 @@ template<class T, USHORT default_port> BOOL CHttpServerT<T, default_port>::SendW
 	return SendPackets(dwConnID, szBuffer, 2);
 }
 
+template<class T, USHORT default_port> BOOL CHttpServerT<T, default_port>::BroadcastWSMessage(const CONNID pIDs[], DWORD dwCount, BOOL bFinal, BYTE iReserved, BYTE iOperationCode, const BYTE* pData, int iLength, ULONGLONG ullBodyLen)
+{
+	WSABUF szBuffer[2];
+	BYTE szHeader[HTTP_MAX_WS_HEADER_LEN];
+
+	/* 服务端发送的消息帧不带掩码，所有连接可以共享同一消息帧 */
+	if(!::MakeWSPacket(bFinal, iReserved, iOperationCode, nullptr, (BYTE*)pData, iLength, ullBodyLen, szHeader, szBuffer))
+		return FALSE;
+
+	return Broadcast(pIDs, dwCount, szBuffer, 2);
+}
+
 template<class T, USHORT default_port> UINT CHttpServerT<T, default_port>::CleanerThreadProc(PVOID pv)
 {
 	TRACE("---------------> Connection Cleaner Thread 0x%08X started <---------------", SELF_THREAD_ID);
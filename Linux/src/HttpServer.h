@@ -41,6 +41,7 @@ public:
 	using __super::Wait;
 	using __super::GetState;
 	using __super::SendPackets;
+	using __super::Broadcast;
 	using __super::Disconnect;
 	using __super::HasStarted;
 	using __super::GetFreeSocketObjLockTime;
@@ -71,11 +72,13 @@ public:
 
 	virtual BOOL SendResponse(CONNID dwConnID, USHORT usStatusCode, LPCSTR lpszDesc = nullptr, const THeader lpHeaders[] = nullptr, int iHeaderCount = 0, const BYTE* pData = nullptr, int iLength = 0);
 	virtual BOOL SendLocalFile(CONNID dwConnID, LPCSTR lpszFileName, USHORT usStatusCode = HSC_OK, LPCSTR lpszDesc = nullptr, const THeader lpHeaders[] = nullptr, int iHeaderCount = 0);
+	virtual BOOL SendRangeFile(CONNID dwConnID, LPCSTR lpszFileName, LPCSTR lpszRange = nullptr, const THeader lpHeaders[] = nullptr, int iHeaderCount = 0);
 	virtual BOOL SendChunkData(CONNID dwConnID, const BYTE* pData = nullptr, int iLength = 0, LPCSTR lpszExtensions = nullptr);
 
 	virtual BOOL Release(CONNID dwConnID);
 
 	virtual BOOL SendWSMessage(CONNID dwConnID, BOOL bFinal, BYTE iReserved, BYTE iOperationCode, const BYTE* pData = nullptr, int iLength = 0, ULONGLONG ullBodyLen = 0);
+	virtual BOOL BroadcastWSMessage(const CONNID pIDs[], DWORD dwCount, BOOL bFinal, BYTE iReserved, BYTE iOperationCode, const BYTE* pData = nullptr, int iLength = 0, ULONGLONG ullBodyLen = 0);
 
 	virtual BOOL StartHttp(CONNID dwConnID);
 
@@ -116,6 +119,7 @@ public:
 
 private:
 	BOOL StartHttp(TSocketObj* pSocketObj);
+	BOOL DoSendLocalFile(CONNID dwConnID, LPCSTR lpszFileName, BOOL bRange, LPCSTR lpszRange, USHORT usStatusCode, LPCSTR lpszDesc, const THeader lpHeaders[], int iHeaderCount);
 	THttpObj* DoStartHttp(TSocketObj* pSocketObj);
 
 private:
@@ -36,10 +36,16 @@
 #define MAX_SMALL_FILE_SIZE						0x3FFFFF
 /* ʱ */
 #define MAX_CONNECTION_PERIOD					(MAXINT / 2)
-/* ¼ʱȡ */
-#define MAX_CONTINUE_READS						100
 /* ¼ʱд */
 #define MAX_CONTINUE_WRITES						100
+/* ¼ʱÿξۼд󻺳 */
+#define MAX_SEND_IOV_COUNT						256
+/* ÷ʽʱֱӸƵݿ鳤 */
+#define MAX_REF_SEND_COPY_SIZE					256
+/* ŶӷʱֱӸƵͶеǰݿеݳȣݵװݿ */
+#define MAX_COMPACT_SEND_SIZE					1024
+/* ͨ sendfile() ļʱÿη͵ֽҲļݼݳȵֵ */
+#define MAX_SEND_FILE_CHUNK_SIZE				0x100000
 
 /* ĬϹеȴ¼ */
 #define DEFAULT_WORKER_MAX_EVENT_COUNT			CIODispatcher::DEF_WORKER_MAX_EVENTS
@@ -79,6 +85,12 @@
 #define DEFALUT_TCP_KEEPALIVE_INTERVAL			(20 * 1000)
 /* TCP Server Ĭ Listen дС */
 #define DEFAULT_TCP_SERVER_SOCKET_LISTEN_QUEUE	SOMAXCONN
+/* TCP Server Ĭÿλܵ */
+#define DEFAULT_TCP_SERVER_ACCEPT_BUDGET		64
+/* TCP Ĭÿδ¼ȡֽSocket Сı */
+#define DEFAULT_TCP_READ_BUDGET_BUFFERS			100
+/* TCP ĬϷͺϲӳ٣룩 */
+#define DEFAULT_TCP_COALESCE_DELAY				1
 
 /* UDP ݱ󳤶 */
 #define MAXIMUM_UDP_MAX_DATAGRAM_SIZE			(16 * DEFAULT_BUFFER_CACHE_CAPACITY)
@@ -103,6 +115,8 @@
 #define TCP_PACK_HEADER_FLAG_LIMIT				0x0003FF
 /* TCP Pack ͷĬϱʶֵ */
 #define TCP_PACK_DEFAULT_HEADER_FLAG			0x000000
+/* TCP Pack ÿཻ֪ͨݰ */
+#define TCP_PACK_MAX_BATCH_FRAMES				64
 
 /* Ĭѹ/ѹݻ */
 #define DEFAULT_COMPRESS_BUFFER_SIZE			(16 * 1024)
@@ -23,6 +23,13 @@
  
 #include "MiscHelper.h"
 
+TPullContext*& TPullContext::Current()
+{
+	static __thread TPullContext* s_pCurrent = nullptr;
+
+	return s_pCurrent;
+}
+
 BOOL AddPackHeader(const WSABUF * pBuffers, int iCount, unique_ptr<WSABUF[]>& buffers, DWORD dwMaxPackSize, USHORT usPackHeaderFlag, DWORD& dwHeader)
 {
 	ASSERT(pBuffers && iCount > 0);
@@ -58,6 +58,46 @@ template<typename B = void> struct TPackInfo
 
 typedef TPackInfo<TBuffer>	TBufferPackInfo;
 
+/* Pull Receive Context：OnReceive() 事件期间记录当前连接的接收缓冲区，在事件中抓取数据时无需查找缓冲区缓存 */
+struct TPullContext
+{
+public:
+	static TBuffer* Find(PVOID pOwner, CONNID dwConnID)
+	{
+		TPullContext* pContext = Current();
+
+		if(pContext == nullptr || pContext->owner != pOwner || pContext->connID != dwConnID)
+			return nullptr;
+
+		TBuffer* pBuffer = pContext->pBuffer;
+
+		return (pBuffer->IsValid() && pBuffer->ID() == dwConnID) ? pBuffer : nullptr;
+	}
+
+public:
+	TPullContext(PVOID pOwner, CONNID dwConnID, TBuffer* pBuf)
+	: owner(pOwner), connID(dwConnID), pBuffer(pBuf), prev(Current())
+	{
+		Current() = this;
+	}
+
+	~TPullContext()
+	{
+		Current() = prev;
+	}
+
+	DECLARE_NO_COPY_CLASS(TPullContext)
+
+private:
+	static TPullContext*& Current();
+
+private:
+	PVOID			owner;
+	CONNID			connID;
+	TBuffer*		pBuffer;
+	TPullContext*	prev;
+};
+
 BOOL AddPackHeader(const WSABUF * pBuffers, int iCount, unique_ptr<WSABUF[]>& buffers, DWORD dwMaxPackSize, USHORT usPackHeaderFlag, DWORD& dwHeader);
 
 template<class B> EnFetchResult FetchBuffer(B* pBuffer, BYTE* pData, int iLength)
@@ -90,10 +130,89 @@ template<class B> EnFetchResult PeekBuffer(B* pBuffer, BYTE* pData, int iLength)
 	return result;
 }
 
-template<class T, class B, class S> EnHandleResult ParsePack(T* pThis, TPackInfo<B>* pInfo, B* pBuffer, S* pSocket, DWORD dwMaxPackSize, USHORT usPackHeaderFlag)
+template<class B> EnFetchResult PeekBufferView(B* pBuffer, WSABUF pBuffers[], int& iCount, int iLength)
+{
+	ASSERT(iLength > 0);
+
+	if(pBuffer == nullptr)
+	{
+		iCount = 0;
+		return FR_DATA_NOT_FOUND;
+	}
+
+	if(pBuffer->Length() < iLength)
+	{
+		iCount = 0;
+		return FR_LENGTH_TOO_LONG;
+	}
+
+	int iViews			 = pBuffer->GetViews(pBuffers, iCount, iLength);
+	EnFetchResult result = (iViews <= iCount) ? FR_OK : FR_LENGTH_TOO_LONG;
+	iCount				 = iViews;
+
+	return result;
+}
+
+template<class B> EnFetchResult SkipBuffer(B* pBuffer, int iLength)
+{
+	ASSERT(iLength > 0);
+
+	if(pBuffer == nullptr)
+		return FR_DATA_NOT_FOUND;
+
+	if(pBuffer->Length() < iLength)
+		return FR_LENGTH_TOO_LONG;
+
+	pBuffer->Reduce(iLength);
+
+	return FR_OK;
+}
+
+/* 解析包头，返回包体长度；包头无效时返回 0 并设置错误码 */
+inline DWORD ParsePackHeader(DWORD header, DWORD dwMaxPackSize, USHORT usPackHeaderFlag)
+{
+	if(usPackHeaderFlag != 0)
+	{
+		USHORT flag = (USHORT)(header >> TCP_PACK_LENGTH_BITS);
+
+		if(flag != usPackHeaderFlag)
+		{
+			::SetLastError(ERROR_INVALID_DATA);
+			return 0;
+		}
+	}
+
+	DWORD len = header & TCP_PACK_LENGTH_MASK;
+
+	if(len == 0 || len > dwMaxPackSize)
+	{
+		::SetLastError(ERROR_BAD_LENGTH);
+		return 0;
+	}
+
+	return len;
+}
+
+/* 从缓冲区第 iOffset 字节开始复制 iLength 字节数据（不移除数据） */
+template<class B> void PeekPackData(const B* pBuffer, BYTE* pData, int iLength, int iOffset)
+{
+	for(WSABUF view; iLength > 0; pData += view.len, iOffset += view.len, iLength -= (int)view.len)
+	{
+		pBuffer->GetViews(&view, 1, iLength, iOffset);
+		memcpy(pData, view.buf, view.len);
+	}
+}
+
+/* 批量接收：包体仍在缓冲节点中时直接引用，攒满一批或数据解析完毕后一次性分发，分发后才从缓冲区移除已解析的数据；只有跨缓冲节点的包体才复制到临时缓冲区 */
+template<class T, class B, class S> EnHandleResult ParsePackBatch(T* pThis, TPackInfo<B>* pInfo, B* pBuffer, S* pSocket, DWORD dwMaxPackSize, USHORT usPackHeaderFlag)
 {
 	EnHandleResult rs = HR_OK;
 
+	WSABUF frames[TCP_PACK_MAX_BATCH_FRAMES];
+	CBufferPtr copies[TCP_PACK_MAX_BATCH_FRAMES];
+	int iFrames = 0;
+	int offset	= 0;
+
 	int required = pInfo->length;
 	int remain	 = pBuffer->Length();
 
@@ -102,39 +221,115 @@ template<class T, class B, class S> EnHandleResult ParsePack(T* pThis, TPackInfo
 		if(pSocket->IsPaused())
 			break;
 
-		remain -= required;
-		CBufferPtr buffer(required);
-
-		pBuffer->Fetch(buffer, (int)buffer.Size());
+		int parsed = required;
+		remain	  -= required;
 
 		if(pInfo->header)
 		{
-			DWORD header = ::HToLE32(*((DWORD*)(BYTE*)buffer));
+			DWORD header;
+			::PeekPackData(pBuffer, (BYTE*)&header, sizeof(DWORD), offset);
+
+			DWORD len = ::ParsePackHeader(::HToLE32(header), dwMaxPackSize, usPackHeaderFlag);
+
+			if(len == 0)
+				return HR_ERROR;
+
+			required = len;
+		}
+		else
+		{
+			WSABUF& frame = frames[iFrames];
 
-			if(usPackHeaderFlag != 0)
+			if(pBuffer->GetViews(&frame, 1, required, offset) != 1)
 			{
-				USHORT flag = (USHORT)(header >> TCP_PACK_LENGTH_BITS);
+				CBufferPtr& buffer = copies[iFrames];
 
-				if(flag != usPackHeaderFlag)
-				{
-					::SetLastError(ERROR_INVALID_DATA);
-					return HR_ERROR;
-				}
+				buffer.Malloc(required);
+				::PeekPackData(pBuffer, buffer, required, offset);
+
+				frame.len = (UINT)required;
+				frame.buf = (LPBYTE)(BYTE*)buffer;
 			}
 
-			DWORD len = header & TCP_PACK_LENGTH_MASK;
+			++iFrames;
+			required = sizeof(DWORD);
+		}
 
-			if(len == 0 || len > dwMaxPackSize)
-			{
-				::SetLastError(ERROR_BAD_LENGTH);
+		offset		 += parsed;
+		pInfo->header = !pInfo->header;
+		pInfo->length = required;
+
+		if(iFrames == TCP_PACK_MAX_BATCH_FRAMES)
+		{
+			rs = pThis->DoFireSuperReceiveBatch(pSocket, frames, iFrames);
+			pBuffer->Reduce(offset);
+
+			if(rs == HR_ERROR)
+				return rs;
+
+			iFrames	= 0;
+			offset	= 0;
+		}
+	}
+
+	if(iFrames > 0)
+		rs = pThis->DoFireSuperReceiveBatch(pSocket, frames, iFrames);
+
+	if(offset > 0)
+		pBuffer->Reduce(offset);
+
+	return rs;
+}
+
+template<class T, class B, class S> EnHandleResult ParsePack(T* pThis, TPackInfo<B>* pInfo, B* pBuffer, S* pSocket, DWORD dwMaxPackSize, USHORT usPackHeaderFlag)
+{
+	if(pThis->IsReceiveBatch())
+		return ::ParsePackBatch(pThis, pInfo, pBuffer, pSocket, dwMaxPackSize, usPackHeaderFlag);
+
+	EnHandleResult rs = HR_OK;
+
+	int required = pInfo->length;
+	int remain	 = pBuffer->Length();
+
+	while(remain >= required)
+	{
+		if(pSocket->IsPaused())
+			break;
+
+		remain -= required;
+
+		if(pInfo->header)
+		{
+			DWORD header;
+			pBuffer->Fetch((BYTE*)&header, sizeof(DWORD));
+
+			DWORD len = ::ParsePackHeader(::HToLE32(header), dwMaxPackSize, usPackHeaderFlag);
+
+			if(len == 0)
 				return HR_ERROR;
-			}
 
 			required = len;
 		}
 		else
 		{
-			rs = pThis->DoFireSuperReceive(pSocket, (const BYTE*)buffer, (int)buffer.Size());
+			/* 包体位于同一个缓冲节点中时直接在缓冲节点中分发，否则复制到临时缓冲区 */
+			WSABUF frame;
+			CBufferPtr buffer;
+			BOOL bInPlace = (pBuffer->GetViews(&frame, 1, required) == 1);
+
+			if(!bInPlace)
+			{
+				buffer.Malloc(required);
+				pBuffer->Fetch(buffer, required);
+
+				frame.len = (UINT)required;
+				frame.buf = (LPBYTE)(BYTE*)buffer;
+			}
+
+			rs = pThis->DoFireSuperReceive(pSocket, (const BYTE*)frame.buf, required);
+
+			if(bInPlace)
+				pBuffer->Reduce(required);
 
 			if(rs == HR_ERROR)
 				return rs;
@@ -149,9 +344,104 @@ template<class T, class B, class S> EnHandleResult ParsePack(T* pThis, TPackInfo
 	return rs;
 }
 
+/* 完整包含在接收数据中的包头和包体直接在接收缓冲区中解析和分发，只有不完整的部分才放入连接缓冲区 */
 template<class T, class B, class S> EnHandleResult ParsePack(T* pThis, TPackInfo<B>* pInfo, B* pBuffer, S* pSocket, DWORD dwMaxPackSize, USHORT usPackHeaderFlag, const BYTE* pData, int iLength)
 {
-	pBuffer->Cat(pData, iLength);
+	EnHandleResult rs = HR_OK;
+
+	if(pBuffer->Length() > 0)
+	{
+		int iNeed = (int)pInfo->length - pBuffer->Length();
+
+		/* 连接暂停接收时缓冲区中可能已有完整的包 */
+		if(iNeed <= 0 || iLength <= iNeed)
+		{
+			pBuffer->Cat(pData, iLength);
+			return ParsePack(pThis, pInfo, pBuffer, pSocket, dwMaxPackSize, usPackHeaderFlag);
+		}
+
+		pBuffer->Cat(pData, iNeed);
+
+		pData	+= iNeed;
+		iLength	-= iNeed;
+
+		rs = ParsePack(pThis, pInfo, pBuffer, pSocket, dwMaxPackSize, usPackHeaderFlag);
+
+		if(rs == HR_ERROR)
+			return rs;
 
-	return ParsePack(pThis, pInfo, pBuffer, pSocket, dwMaxPackSize, usPackHeaderFlag);
+		if(pBuffer->Length() > 0)
+		{
+			pBuffer->Cat(pData, iLength);
+			return rs;
+		}
+	}
+
+	BOOL bBatch = pThis->IsReceiveBatch();
+	WSABUF frames[TCP_PACK_MAX_BATCH_FRAMES];
+	int iFrames = 0;
+
+	while(iLength >= (int)pInfo->length)
+	{
+		if(pSocket->IsPaused())
+			break;
+
+		int required = pInfo->length;
+
+		if(pInfo->header)
+		{
+			DWORD header;
+			memcpy(&header, pData, sizeof(DWORD));
+
+			DWORD len = ::ParsePackHeader(::HToLE32(header), dwMaxPackSize, usPackHeaderFlag);
+
+			if(len == 0)
+				return HR_ERROR;
+
+			pInfo->length = len;
+		}
+		else if(bBatch)
+		{
+			/* 批量接收时先收集包体，攒满一批或数据解析完毕后一次性分发 */
+			frames[iFrames].len	= (UINT)required;
+			frames[iFrames].buf	= (LPBYTE)pData;
+
+			if(++iFrames == TCP_PACK_MAX_BATCH_FRAMES)
+			{
+				rs		= pThis->DoFireSuperReceiveBatch(pSocket, frames, iFrames);
+				iFrames	= 0;
+
+				if(rs == HR_ERROR)
+					return rs;
+			}
+
+			pInfo->length = sizeof(DWORD);
+		}
+		else
+		{
+			rs = pThis->DoFireSuperReceive(pSocket, pData, required);
+
+			if(rs == HR_ERROR)
+				return rs;
+
+			pInfo->length = sizeof(DWORD);
+		}
+
+		pInfo->header	 = !pInfo->header;
+		pData			+= required;
+		iLength			-= required;
+	}
+
+	if(iFrames > 0)
+	{
+		rs = pThis->DoFireSuperReceiveBatch(pSocket, frames, iFrames);
+
+		if(rs == HR_ERROR)
+			return rs;
+	}
+
+	if(iLength > 0)
+		pBuffer->Cat(pData, iLength);
+
+	return rs;
 }
@@ -87,6 +87,12 @@ BOOL CSSLAgent::SendPackets(CONNID dwConnID, const WSABUF pBuffers[], int iCount
 		return FALSE;
 	}
 
+	if(pSocketObj->highWater)
+	{
+		::SetLastError(ERROR_NOT_ENOUGH_QUOTA);
+		return FALSE;
+	}
+
 	CSSLSession* pSession = nullptr;
 	GetConnectionReserved2(pSocketObj, (PVOID*)&pSession);
 
@@ -99,6 +105,47 @@ BOOL CSSLAgent::SendPackets(CONNID dwConnID, const WSABUF pBuffers[], int iCount
 	return DoSendPackets(pSocketObj, pBuffers, iCount);
 }
 
+BOOL CSSLAgent::SendRefPackets(CONNID dwConnID, const WSABUF pBuffers[], int iCount, Fn_SendBufferRelease fnRelease, PVOID pvArg)
+{
+	ASSERT(pBuffers && iCount > 0);
+
+	TAgentSocketObj* pSocketObj = FindSocketObj(dwConnID);
+
+	if(!TAgentSocketObj::IsValid(pSocketObj))
+	{
+		::InvokeSendBufferRelease(fnRelease, pvArg);
+		::SetLastError(ERROR_OBJECT_NOT_FOUND);
+		return FALSE;
+	}
+
+	if(pSocketObj->highWater)
+	{
+		::InvokeSendBufferRelease(fnRelease, pvArg);
+		::SetLastError(ERROR_NOT_ENOUGH_QUOTA);
+		return FALSE;
+	}
+
+	CSSLSession* pSession = nullptr;
+	GetConnectionReserved2(pSocketObj, (PVOID*)&pSession);
+
+	if(pSession != nullptr)
+	{
+		BOOL isOK = FALSE;
+
+		{
+			CLocalSafeCounter localcounter(*pSession);
+			isOK = ::ProcessSend(this, pSocketObj, pSession, pBuffers, iCount);
+		}
+
+		/* SSL 连接的数据已加密复制到发送缓冲区 */
+		::InvokeSendBufferRelease(fnRelease, pvArg);
+
+		return isOK;
+	}
+
+	return DoSendPackets(pSocketObj, pBuffers, iCount, fnRelease, pvArg);
+}
+
 EnHandleResult CSSLAgent::FireConnect(TAgentSocketObj* pSocketObj)
 {
 	EnHandleResult result = DoFireConnect(pSocketObj);
@@ -74,6 +74,20 @@ BOOL CSSLClient::SendPackets(const WSABUF pBuffers[], int iCount)
 		return DoSendPackets(this, pBuffers, iCount);
 }
 
+BOOL CSSLClient::SendRefPackets(const WSABUF pBuffers[], int iCount, Fn_SendBufferRelease fnRelease, PVOID pvArg)
+{
+	ASSERT(pBuffers && iCount > 0);
+
+	if(!m_sslSession.IsValid())
+		return DoSendPackets(pBuffers, iCount, fnRelease, pvArg);
+
+	/* SSL 连接的数据已加密复制到发送缓冲区 */
+	BOOL isOK = ::ProcessSend(this, this, &m_sslSession, pBuffers, iCount);
+	::InvokeSendBufferRelease(fnRelease, pvArg);
+
+	return isOK;
+}
+
 EnHandleResult CSSLClient::FireConnect()
 {
 	EnHandleResult result = DoFireConnect(this);
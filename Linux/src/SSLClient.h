@@ -38,6 +38,7 @@ public:
 public:
 	virtual BOOL IsSecure() {return TRUE;}
 	virtual BOOL SendPackets(const WSABUF pBuffers[], int iCount);
+	virtual BOOL SendRefPackets(const WSABUF pBuffers[], int iCount, Fn_SendBufferRelease fnRelease, PVOID pvArg = nullptr);
 
 	virtual BOOL SetupSSLContext(int iVerifyMode = SSL_VM_NONE, LPCTSTR lpszPemCertFile = nullptr, LPCTSTR lpszPemKeyFile = nullptr, LPCTSTR lpszKeyPassword = nullptr, LPCTSTR lpszCAPemCertFileOrPath = nullptr)
 		{return m_sslCtx.Initialize(SSL_SM_CLIENT, iVerifyMode, FALSE, (LPVOID)lpszPemCertFile, (LPVOID)lpszPemKeyFile, (LPVOID)lpszKeyPassword, (LPVOID)lpszCAPemCertFileOrPath, nullptr);}
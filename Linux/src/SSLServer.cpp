@@ -87,6 +87,12 @@ BOOL CSSLServer::SendPackets(CONNID dwConnID, const WSABUF pBuffers[], int iCoun
 		return FALSE;
 	}
 
+	if(pSocketObj->highWater)
+	{
+		::SetLastError(ERROR_NOT_ENOUGH_QUOTA);
+		return FALSE;
+	}
+
 	CSSLSession* pSession = nullptr;
 	GetConnectionReserved2(pSocketObj, (PVOID*)&pSession);
 
@@ -99,6 +105,72 @@ BOOL CSSLServer::SendPackets(CONNID dwConnID, const WSABUF pBuffers[], int iCoun
 	return DoSendPackets(pSocketObj, pBuffers, iCount);
 }
 
+BOOL CSSLServer::SendRefPackets(CONNID dwConnID, const WSABUF pBuffers[], int iCount, Fn_SendBufferRelease fnRelease, PVOID pvArg)
+{
+	ASSERT(pBuffers && iCount > 0);
+
+	TSocketObj* pSocketObj = FindSocketObj(dwConnID);
+
+	if(!TSocketObj::IsValid(pSocketObj))
+	{
+		::InvokeSendBufferRelease(fnRelease, pvArg);
+		::SetLastError(ERROR_OBJECT_NOT_FOUND);
+		return FALSE;
+	}
+
+	if(pSocketObj->highWater)
+	{
+		::InvokeSendBufferRelease(fnRelease, pvArg);
+		::SetLastError(ERROR_NOT_ENOUGH_QUOTA);
+		return FALSE;
+	}
+
+	CSSLSession* pSession = nullptr;
+	GetConnectionReserved2(pSocketObj, (PVOID*)&pSession);
+
+	if(pSession != nullptr)
+	{
+		BOOL isOK = FALSE;
+
+		{
+			CLocalSafeCounter localcounter(*pSession);
+			isOK = ::ProcessSend(this, pSocketObj, pSession, pBuffers, iCount);
+		}
+
+		/* SSL 连接的数据已加密复制到发送缓冲区 */
+		::InvokeSendBufferRelease(fnRelease, pvArg);
+
+		return isOK;
+	}
+
+	return DoSendPackets(pSocketObj, pBuffers, iCount, fnRelease, pvArg);
+}
+
+BOOL CSSLServer::Broadcast(const CONNID pIDs[], DWORD dwCount, const WSABUF pBuffers[], int iCount)
+{
+	ASSERT(pIDs && dwCount > 0 && pBuffers && iCount > 0);
+
+	int result	 = ERROR_OBJECT_NOT_FOUND;
+	DWORD dwSent = 0;
+
+	/* 每个 SSL 连接的数据需要分别加密，不能共享发送缓冲区 */
+	for(DWORD i = 0; i < dwCount; i++)
+	{
+		if(CSSLServer::SendPackets(pIDs[i], pBuffers, iCount))
+			++dwSent;
+		else
+			result = ::GetLastError();
+	}
+
+	if(dwSent == 0)
+	{
+		::SetLastError(result);
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
 EnHandleResult CSSLServer::FireAccept(TSocketObj* pSocketObj)
 {
 	EnHandleResult result = DoFireAccept(pSocketObj);
@@ -38,6 +38,8 @@ public:
 public:
 	virtual BOOL IsSecure() {return TRUE;}
 	virtual BOOL SendPackets(CONNID dwConnID, const WSABUF pBuffers[], int iCount);
+	virtual BOOL SendRefPackets(CONNID dwConnID, const WSABUF pBuffers[], int iCount, Fn_SendBufferRelease fnRelease, PVOID pvArg = nullptr);
+	virtual BOOL Broadcast(const CONNID pIDs[], DWORD dwCount, const WSABUF pBuffers[], int iCount);
 
 	virtual BOOL SetupSSLContext(int iVerifyMode = SSL_VM_NONE, LPCTSTR lpszPemCertFile = nullptr, LPCTSTR lpszPemKeyFile = nullptr, LPCTSTR lpszKeyPassword = nullptr, LPCTSTR lpszCAPemCertFileOrPath = nullptr, Fn_SNI_ServerNameCallback fnServerNameCallback = nullptr)
 		{return m_sslCtx.Initialize(SSL_SM_SERVER, iVerifyMode, FALSE, (LPVOID)lpszPemCertFile, (LPVOID)lpszPemKeyFile, (LPVOID)lpszKeyPassword, (LPVOID)lpszCAPemCertFileOrPath, fnServerNameCallback);}
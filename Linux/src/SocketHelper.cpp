@@ -27,6 +27,8 @@
 #include <arpa/inet.h>
 #include <netinet/tcp.h>
 #include <netinet/udp.h>
+#include <sys/stat.h>
+#include <sys/sendfile.h>
 
 #ifdef _ICONV_SUPPORT
 #include <iconv.h>
@@ -563,6 +565,59 @@ HRESULT MakeSmallFilePackage(LPCTSTR lpszFileName, CFile& file, CFileMapping& fm
 	return hr;
 }
 
+HRESULT OpenSendFile(LPCTSTR lpszFileName, CFile& file, ULONGLONG ullOffset, ULONGLONG& ullLength)
+{
+	ASSERT(lpszFileName != nullptr);
+
+	if(file.Open(lpszFileName, O_RDONLY | O_CLOEXEC))
+	{
+		struct stat st;
+
+		if(file.Stat(st))
+		{
+			ULONGLONG ullSize = (ULONGLONG)st.st_size;
+
+			if(!S_ISREG(st.st_mode))
+				::SetLastError(ERROR_BAD_FILE_TYPE);
+			else if(ullOffset > ullSize || ullLength > ullSize - ullOffset)
+				::SetLastError(ERROR_OUT_OF_RANGE);
+			else
+			{
+				if(ullLength == 0)
+					ullLength = ullSize - ullOffset;
+
+				return NO_ERROR;
+			}
+		}
+	}
+
+	HRESULT rs = ::GetLastError();
+
+	return (!IS_NO_ERROR(rs) ? rs : ERROR_UNKNOWN);
+}
+
+HRESULT ReadSendFile(CFile& file, ULONGLONG ullOffset, ULONGLONG ullLength, CBufferPtr& buffer)
+{
+	if(ullLength > MAX_SMALL_FILE_SIZE)
+		return ERROR_FILE_TOO_LARGE;
+
+	buffer.Malloc((SIZE_T)ullLength);
+
+	for(SIZE_T dwRead = 0; dwRead < (SIZE_T)ullLength;)
+	{
+		SSIZE_T rc = file.PRead(buffer.Ptr() + dwRead, (SIZE_T)ullLength - dwRead, (SIZE_T)ullOffset + dwRead);
+
+		if(rc > 0)
+			dwRead += rc;
+		else if(rc == 0)
+			return ERROR_NO_DATA;
+		else if(!IS_INTR_ERROR())
+			return ::GetLastError();
+	}
+
+	return NO_ERROR;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 
 int SSO_SetSocketOption(SOCKET sock, int level, int name, LPVOID val, int len)
@@ -713,6 +768,281 @@ int SSO_GetError(SOCKET sock)
 	return SOCKET_ERROR;
 }
 
+int SSO_IncomingCpu(SOCKET sock, int iCpu)
+{
+#ifdef SO_INCOMING_CPU
+	return setsockopt(sock, SOL_SOCKET, SO_INCOMING_CPU, &iCpu, sizeof(int));
+#else
+	::WSASetLastError(ERROR_CALL_NOT_IMPLEMENTED);
+	return SOCKET_ERROR;
+#endif
+}
+
+int SSO_BusyPoll(SOCKET sock, int iMicroseconds, BOOL bPrefer)
+{
+#ifdef SO_BUSY_POLL
+	int rs = setsockopt(sock, SOL_SOCKET, SO_BUSY_POLL, &iMicroseconds, sizeof(int));
+
+#ifdef SO_PREFER_BUSY_POLL
+	int val = bPrefer ? 1 : 0;
+
+	if(IS_NO_ERROR(setsockopt(sock, SOL_SOCKET, SO_PREFER_BUSY_POLL, &val, sizeof(int))))
+		return rs;
+
+	return SOCKET_ERROR;
+#else
+	return rs;
+#endif
+#else
+	::WSASetLastError(ERROR_CALL_NOT_IMPLEMENTED);
+	return SOCKET_ERROR;
+#endif
+}
+
+int SSO_QuickAck(SOCKET sock, BOOL bQuickAck)
+{
+	int val = bQuickAck ? 1 : 0;
+	return setsockopt(sock, IPPROTO_TCP, TCP_QUICKACK, &val, sizeof(int));
+}
+
+int SSO_DeferAccept(SOCKET sock, DWORD dwTime)
+{
+	/* TCP_DEFER_ACCEPT 以秒为单位 */
+	int val = (int)((dwTime + 999) / 1000);
+	return setsockopt(sock, IPPROTO_TCP, TCP_DEFER_ACCEPT, &val, sizeof(int));
+}
+
+int SSO_ZeroCopy(SOCKET sock, BOOL bZeroCopy)
+{
+	int val = bZeroCopy ? 1 : 0;
+	return setsockopt(sock, SOL_SOCKET, SO_ZEROCOPY, &val, sizeof(int));
+}
+
+int SSO_NotSentLowat(SOCKET sock, DWORD dwLowat)
+{
+#ifdef TCP_NOTSENT_LOWAT
+	int val = (int)dwLowat;
+	return setsockopt(sock, IPPROTO_TCP, TCP_NOTSENT_LOWAT, &val, sizeof(int));
+#else
+	::WSASetLastError(ERROR_CALL_NOT_IMPLEMENTED);
+	return SOCKET_ERROR;
+#endif
+}
+
+int WriteItems(SOCKET sock, const TItemList& lsItem, int iBreakSize)
+{
+	iovec vecs[MAX_SEND_IOV_COUNT];
+	int iCount = lsItem.GetIoVecs(vecs, MAX_SEND_IOV_COUNT, iBreakSize);
+
+	if(iCount == 1)
+		return (int)write(sock, vecs[0].iov_base, vecs[0].iov_len);
+
+	return (int)writev(sock, vecs, iCount);
+}
+
+int ReadBuffer(SOCKET sock, TBuffer* pBuffer)
+{
+	iovec vecs[2];
+	TItem* pSpare = nullptr;
+	int iCount	  = pBuffer->ReserveTail(vecs, pSpare);
+	int rc		  = (iCount == 1)
+					? (int)read(sock, vecs[0].iov_base, vecs[0].iov_len)
+					: (int)readv(sock, vecs, iCount);
+
+	if(rc > 0)
+		pBuffer->CommitTail(rc, pSpare);
+	else
+	{
+		int iError = ::GetLastError();
+		pBuffer->CommitTail(0, pSpare);
+		::SetLastError(iError);
+	}
+
+	return rc;
+}
+
+int WriteBuffers(SOCKET sock, const WSABUF pBuffers[], int iCount)
+{
+	iovec vecs[MAX_SEND_IOV_COUNT];
+	iCount = MIN(iCount, MAX_SEND_IOV_COUNT);
+
+	for(int i = 0; i < iCount; i++)
+	{
+		vecs[i].iov_base = pBuffers[i].buf;
+		vecs[i].iov_len	 = pBuffers[i].len;
+	}
+
+	msghdr msg	   = {};
+	msg.msg_iov	   = vecs;
+	msg.msg_iovlen = iCount;
+
+	return (int)sendmsg(sock, &msg, MSG_NOSIGNAL);
+}
+
+int SendZeroCopy(SOCKET sock, const BYTE* pData, int iLength)
+{
+	return (int)send(sock, pData, iLength, MSG_ZEROCOPY | MSG_NOSIGNAL);
+}
+
+int ReadZeroCopyNotifications(SOCKET sock, UINT& uiDone)
+{
+	int iCount = 0;
+
+	while(TRUE)
+	{
+		char szCtrl[CMSG_SPACE(sizeof(sock_extended_err)) + CMSG_SPACE(sizeof(sockaddr_in6))];
+
+		msghdr msg		   = {};
+		msg.msg_control	   = szCtrl;
+		msg.msg_controllen = sizeof(szCtrl);
+
+		if(recvmsg(sock, &msg, MSG_ERRQUEUE) == SOCKET_ERROR)
+			return IS_WOULDBLOCK_ERROR() ? iCount : -1;
+
+		cmsghdr* pCmsg = CMSG_FIRSTHDR(&msg);
+
+		if(pCmsg == nullptr || !((pCmsg->cmsg_level == SOL_IP && pCmsg->cmsg_type == IP_RECVERR) || (pCmsg->cmsg_level == SOL_IPV6 && pCmsg->cmsg_type == IPV6_RECVERR)))
+			return -1;
+
+		sock_extended_err* pErr = (sock_extended_err*)CMSG_DATA(pCmsg);
+
+		if(pErr->ee_origin != SO_EE_ORIGIN_ZEROCOPY || pErr->ee_errno != 0)
+			return -1;
+
+		/* TCP 连接的完成通知按发送顺序到达，ee_data 为本次通知覆盖的最大发送序号 */
+		uiDone = pErr->ee_data;
+		++iCount;
+	}
+}
+
+void CatSendBuffers(TBufferObjList& lsBuff, const WSABUF pBuffers[], int iCount, int iSkip, Fn_SendBufferRelease fnRelease, PVOID pvArg)
+{
+	TItem* pMark = lsBuff.Back();
+	int iCopyMax = MIN(MAX_REF_SEND_COPY_SIZE, (int)lsBuff.GetItemPool().GetItemCapacity());
+
+	for(int i = 0; i < iCount; i++)
+	{
+		int iBufLen	  = pBuffers[i].len;
+		BYTE* pBuffer = (BYTE*)pBuffers[i].buf;
+
+		if(iSkip > 0)
+		{
+			int iCut = MIN(iSkip, iBufLen);
+
+			pBuffer	+= iCut;
+			iBufLen	-= iCut;
+			iSkip	-= iCut;
+		}
+
+		if(iBufLen <= 0)
+			continue;
+
+		ASSERT(pBuffer);
+
+		if(fnRelease == nullptr)
+			lsBuff.Cat(pBuffer, iBufLen);
+		else if(iBufLen > iCopyMax)
+			lsBuff.Attach(pBuffer, iBufLen);
+		else if(lsBuff.Back() == pMark)
+			lsBuff.PushTail(pBuffer, iBufLen);
+		else
+			lsBuff.Cat(pBuffer, iBufLen);
+	}
+
+	if(fnRelease == nullptr)
+		return;
+
+	/* 释放函数挂在本次加入的最后一个数据块上，该数据块被回收时前面的数据已全部发送或被丢弃（以 MSG_ZEROCOPY 发送的数据块由 RecycleSentItem() 等待其完成） */
+	if(lsBuff.Back() != pMark)
+		lsBuff.Back()->SetReleaser(fnRelease, pvArg);
+	else
+		::InvokeSendBufferRelease(fnRelease, pvArg);
+}
+
+TSharedBuffer* TSharedBuffer::Construct(const WSABUF pBuffers[], int iCount)
+{
+	ULONGLONG ullLength = 0;
+
+	for(int i = 0; i < iCount; i++)
+		ullLength += pBuffers[i].len;
+
+	/* 总长度超出 int 范围或内存分配失败时返回 nullptr */
+	if(ullLength > (ULONGLONG)MAXINT)
+		return nullptr;
+
+	TSharedBuffer* pShared = (TSharedBuffer*)malloc(sizeof(TSharedBuffer) + (size_t)ullLength);
+
+	if(pShared == nullptr)
+		return nullptr;
+
+	pShared->ref = 1;
+	pShared->len = 0;
+
+	for(int i = 0; i < iCount; i++)
+	{
+		if(pBuffers[i].len > 0)
+			memcpy(pShared->Ptr() + pShared->len, pBuffers[i].buf, pBuffers[i].len);
+
+		pShared->len += (int)pBuffers[i].len;
+	}
+
+	return pShared;
+}
+
+VOID __HP_CALL TSharedBuffer::Release(PVOID pv)
+{
+	TSharedBuffer* pShared = (TSharedBuffer*)pv;
+
+	if(::InterlockedDecrement(&pShared->ref) == 0)
+		free(pShared);
+}
+
+void CatSendFile(TBufferObjList& lsBuff, CFile& file, ULONGLONG ullOffset, ULONGLONG ullLength, const LPWSABUF pHead, const LPWSABUF pTail, Fn_SendBufferRelease fnComplete, PVOID pvArg)
+{
+	TItem* pMark = lsBuff.Back();
+
+	if(pHead != nullptr)
+		::CatSendBuffers(lsBuff, pHead, 1);
+
+	if(ullLength > 0)
+	{
+		TItem* pItem = lsBuff.GetItemPool().PickFreeItem();
+		pItem->AttachFile(file.Detach(), (LONGLONG)ullOffset, (LONGLONG)ullLength);
+
+		lsBuff.PushBack(pItem);
+		lsBuff.IncreaseLength(::GetFileItemPending(pItem));
+	}
+
+	if(pTail != nullptr)
+		::CatSendBuffers(lsBuff, pTail, 1);
+
+	if(fnComplete == nullptr)
+		return;
+
+	if(lsBuff.Back() != pMark)
+		lsBuff.Back()->SetReleaser(fnComplete, pvArg);
+	else
+		::InvokeSendBufferRelease(fnComplete, pvArg);
+}
+
+int SendFileItem(SOCKET sock, TItem* pItem, int& iPending)
+{
+	ASSERT(pItem->IsFile() && pItem->FileRemain() > 0);
+
+	off_t offset	= (off_t)pItem->FileOffset();
+	SIZE_T dwCount	= (SIZE_T)MIN(pItem->FileRemain(), (LONGLONG)MAX_SEND_FILE_CHUNK_SIZE);
+	SSIZE_T rc		= sendfile(sock, pItem->GetFile(), &offset, dwCount);
+
+	if(rc > 0)
+	{
+		iPending = ::GetFileItemPending(pItem);
+		pItem->ReduceFile(rc);
+		iPending -= ::GetFileItemPending(pItem);
+	}
+
+	return (int)rc;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 
 CONNID GenerateConnectionID()
@@ -754,6 +1084,141 @@ int ManualCloseSocket(SOCKET sock, int iShutdownFlag, BOOL bGraceful)
 	return closesocket(sock);
 }
 
+static BOOL ParseCpuList(LPCTSTR lpszCpuList, vector<int>& vtCpus)
+{
+	if(::IsStrEmpty(lpszCpuList))
+		return FALSE;
+
+	LPCTSTR p = lpszCpuList;
+
+	while(*p != 0)
+	{
+		LPTSTR lpszEnd;
+		long lBegin = strtol(p, &lpszEnd, 10);
+
+		if(lpszEnd == p || lBegin < 0 || lBegin >= CPU_SETSIZE)
+			return FALSE;
+
+		long lEnd = lBegin;
+		p		  = lpszEnd;
+
+		if(*p == '-')
+		{
+			lEnd = strtol(++p, &lpszEnd, 10);
+
+			if(lpszEnd == p || lEnd < lBegin || lEnd >= CPU_SETSIZE)
+				return FALSE;
+
+			p = lpszEnd;
+		}
+
+		for(long i = lBegin; i <= lEnd; i++)
+			vtCpus.push_back((int)i);
+
+		if(*p == ',')
+			++p;
+		else if(*p != 0)
+			return FALSE;
+	}
+
+	return !vtCpus.empty();
+}
+
+static int ReadCpuTopology(int iCpu, LPCSTR lpszItem)
+{
+	char szPath[128];
+	sprintf(szPath, "/sys/devices/system/cpu/cpu%d/topology/%s", iCpu, lpszItem);
+
+	FILE* pFile = fopen(szPath, "r");
+
+	if(pFile == nullptr)
+		return -1;
+
+	int iValue = -1;
+
+	if(fscanf(pFile, "%d", &iValue) != 1)
+		iValue = -1;
+
+	fclose(pFile);
+
+	return iValue;
+}
+
+BOOL MakeCpuAffinityList(EnCpuAffinityPolicy enPolicy, LPCTSTR lpszCpuList, vector<int>& vtCpus)
+{
+	vtCpus.clear();
+
+	if(enPolicy == CAP_NONE)
+		return TRUE;
+	if(enPolicy == CAP_LIST)
+		return ParseCpuList(lpszCpuList, vtCpus);
+	if(enPolicy != CAP_COMPACT && enPolicy != CAP_SCATTER)
+		return FALSE;
+
+	cpu_set_t cpus;
+
+	if(IS_HAS_ERROR(sched_getaffinity(0, sizeof(cpu_set_t), &cpus)))
+		return FALSE;
+
+	struct TCpuTopology
+	{
+		int cpu;
+		int package;
+		int core;
+		int coreRank;
+		int sibling;
+	};
+
+	vector<TCpuTopology> vtTopology;
+
+	for(int i = 0; i < CPU_SETSIZE; i++)
+	{
+		if(!CPU_ISSET(i, &cpus))
+			continue;
+
+		TCpuTopology cpu = {i, ReadCpuTopology(i, "physical_package_id"), ReadCpuTopology(i, "core_id"), 0, 0};
+
+		if(cpu.package < 0)	cpu.package	= 0;
+		if(cpu.core < 0)	cpu.core	= i;
+
+		for(const TCpuTopology& other : vtTopology)
+		{
+			if(other.package != cpu.package)
+				continue;
+
+			if(other.core == cpu.core)
+			{
+				cpu.coreRank = other.coreRank;
+				++cpu.sibling;
+			}
+			else if(other.sibling == 0 && cpu.sibling == 0)
+				++cpu.coreRank;
+		}
+
+		vtTopology.push_back(cpu);
+	}
+
+	if(enPolicy == CAP_COMPACT)
+	{
+		sort(vtTopology.begin(), vtTopology.end(), [](const TCpuTopology& a, const TCpuTopology& b)
+		{
+			return make_tuple(a.package, a.coreRank, a.sibling) < make_tuple(b.package, b.coreRank, b.sibling);
+		});
+	}
+	else
+	{
+		sort(vtTopology.begin(), vtTopology.end(), [](const TCpuTopology& a, const TCpuTopology& b)
+		{
+			return make_tuple(a.sibling, a.coreRank, a.package) < make_tuple(b.sibling, b.coreRank, b.package);
+		});
+	}
+
+	for(const TCpuTopology& cpu : vtTopology)
+		vtCpus.push_back(cpu.cpu);
+
+	return !vtCpus.empty();
+}
+
 DWORD GuessBase64EncodeBound(DWORD dwSrcLen)
 {
 	return 4 * ((dwSrcLen + 2) / 3);
@@ -31,12 +31,14 @@
 #include "common/BufferPool.h"
 #include "common/RingBuffer.h"
 #include "common/FileHelper.h"
+#include "common/IODispatcher.h"
 #include "InternalDef.h"
 
 #include <netdb.h>
 #include <sys/un.h>
 #include <sys/socket.h>
 #include <arpa/inet.h>
+#include <linux/errqueue.h>
 
 #ifdef _ZLIB_SUPPORT
 #include <zlib.h>
@@ -324,6 +326,43 @@ enum EnDispCmdType
 	DISP_CMD_UNPAUSE	= 0x03,	// 恢复接收数据
 	DISP_CMD_DISCONNECT	= 0x04,	// 断开连接
 	DISP_CMD_TIMEOUT	= 0x05,	// 保活超时
+	DISP_CMD_MIGRATE	= 0x06,	// 迁入连接
+	DISP_CMD_POST		= 0x07,	// 连接任务
+	DISP_CMD_HIGH_WATER	= 0x08,	// 发送缓冲区达到高水位
+	DISP_CMD_SEND_BATCH	= 0x09,	// 批量发送数据
+};
+
+/* 连接任务（DISP_CMD_POST 命令参数） */
+struct TConnTask
+{
+	Fn_ConnTaskProc	fn;
+	PVOID			arg;
+
+	static TConnTask* Construct(Fn_ConnTaskProc fn, PVOID arg)
+		{return new TConnTask {fn, arg};}
+
+	static VOID Destruct(TConnTask* p)
+		{if(p) delete p;}
+
+	static VOID Execute(TConnTask* p, CONNID dwConnID, BOOL bValid)
+		{p->fn(dwConnID, p->arg, bValid); Destruct(p);}
+};
+
+/* 连接 ID 列表（DISP_CMD_SEND_BATCH 命令参数） */
+typedef vector<CONNID>	TConnIDList;
+
+/* 共享发送缓冲区（广播时由多个连接的发送缓冲区引用，最后一个引用释放时回收） */
+struct TSharedBuffer
+{
+	volatile int	ref;
+	int				len;
+
+	BYTE* Ptr()		{return (BYTE*)(this + 1);}
+	VOID AddRef()	{::InterlockedIncrement(&ref);}
+
+	/* 复制 pBuffers 的数据（总长度超出 int 范围或内存不足时返回 nullptr） */
+	static TSharedBuffer* Construct(const WSABUF pBuffers[], int iCount);
+	static VOID __HP_CALL Release(PVOID pv);
 };
 
 /* 关闭连接标识 */
@@ -362,6 +401,8 @@ struct TSocketObjBase : public CSafeCounter
 	CPrivateHeap&		heap;
 	CReentrantCriSec	csSend;
 	TBufferObjList		sndBuff;
+	/* 以 MSG_ZEROCOPY 发送完毕、等待内核完成通知的数据块（仅由所属工作线程访问） */
+	TItemList			zcBuff;
 
 
 	CONNID		connID;
@@ -371,6 +412,11 @@ struct TSocketObjBase : public CSafeCounter
 	PVOID		reserved2;
 	DWORD		activeTime;
 
+	/* 所属工作线程（仅由所属工作线程在 csSend 保护下修改） */
+	atomic<int> index;
+	/* 已投递到所属工作线程、尚未执行的命令数量（在 csSend 保护下增加，有未执行的命令时连接不迁移） */
+	atomic<int> commands;
+
 	union
 	{
 		DWORD	freeTime;
@@ -381,7 +427,11 @@ struct TSocketObjBase : public CSafeCounter
 	volatile BOOL connected;
 	volatile BOOL paused;
 
-	TSocketObjBase(CPrivateHeap& hp, CBufferObjPool& bfPool) : heap(hp), sndBuff(bfPool) {}
+	/* 是否启用 SO_ZEROCOPY，以及下一次 MSG_ZEROCOPY 发送的序号 */
+	BOOL zerocopy;
+	UINT zcSeq;
+
+	TSocketObjBase(CPrivateHeap& hp, CBufferObjPool& bfPool) : heap(hp), sndBuff(bfPool), zcBuff(bfPool) {}
 
 	static BOOL IsExist(TSocketObjBase* pSocketObj)
 		{return pSocketObj != nullptr;}
@@ -398,6 +448,9 @@ struct TSocketObjBase : public CSafeCounter
 		
 		pSocketObj->freeTime = ::TimeGetTime();
 		pSocketObj->sndBuff.Release();
+
+		/* 套接字已关闭，不会再收到 MSG_ZEROCOPY 完成通知，立即释放等待通知的数据块并调用其释放函数 */
+		pSocketObj->zcBuff.Release();
 	}
 
 	static BOOL InvalidSocketObj(TSocketObjBase* pSocketObj)
@@ -432,14 +485,46 @@ struct TSocketObjBase : public CSafeCounter
 	BOOL IsConnecting()							{return connected == CST_CONNECTING;}
 	void SetConnected(BOOL bConnected = TRUE)	{connected = bConnected;}
 
+	void ReleaseZeroCopy(UINT uiDone)
+	{
+		while(!zcBuff.IsEmpty() && (int)(zcBuff.Front()->GetSeq() - uiDone) <= 0)
+			zcBuff.GetItemPool().PutFreeItem(zcBuff.PopFront());
+	}
+
+	/* 回收发送完毕的数据块：以 MSG_ZEROCOPY 发送过的数据块等待内核完成通知；其它数据块的释放函数
+	   挂到 zcBuff 末尾的标记数据块上，在之前以 MSG_ZEROCOPY 发送的数据全部完成后才调用 */
+	void RecycleSentItem(TItem* pItem)
+	{
+		if(pItem->IsPinned())
+		{
+			zcBuff.PushBack(pItem);
+			return;
+		}
+
+		if(pItem->HasReleaser() && !zcBuff.IsEmpty())
+		{
+			TItem* pMark = zcBuff.GetItemPool().PickFreeItem();
+
+			pItem->MoveReleaser(pMark);
+			pMark->Pin(zcBuff.Back()->GetSeq());
+			zcBuff.PushBack(pMark);
+		}
+
+		zcBuff.GetItemPool().PutFreeItem(pItem);
+	}
+
 	void Reset(CONNID dwConnID)
 	{
 		ResetCount();
 
 		connID		= dwConnID;
+		index		= -1;
+		commands	= 0;
 		connected	= FALSE;
 		valid		= TRUE;
 		paused		= FALSE;
+		zerocopy	= FALSE;
+		zcSeq		= 0;
 		extra		= nullptr;
 		reserved	= nullptr;
 		reserved2	= nullptr;
@@ -452,6 +537,31 @@ struct TSocketObj : public TSocketObjBase
 	using __super = TSocketObjBase;
 
 	SOCKET socket;
+	UINT   armed;
+	/* 所属工作线程正在处理该连接的 IO 事件，以及是否有已提交、尚未完成的 io_uring 发送请求（仅由所属工作线程读写） */
+	BOOL   processing;
+	BOOL   sending;
+
+	PVOID		pHolder;
+	TDispTimer	timer;
+	/* 空闲超时定时器（仅在设置了空闲连接超时时间时启用） */
+	TDispTimer	idleTimer;
+
+	/* 合并发送阈值（0 表示不合并），以及 sndBuff 中的数据是否正被暂存等待合并（受 csSend 保护） */
+	DWORD coalesce;
+	BOOL  held;
+
+	/* 待发送数据是否达到高水位（受 csSend 保护），以及是否已触发 OnSendBufferHigh()（仅由所属工作线程访问） */
+	BOOL highWater;
+	BOOL highNotified;
+
+	/* 生产者压入的待发送数据（生产者以 CAS 预留数据块空间或接入数据块链，所属工作线程不加锁取出） */
+	TItemQueue sndQueue;
+	/* 工作线程从 sndQueue 取出、尚未发送完毕的数据块（仅由所属工作线程访问） */
+	TItemList sndItems;
+	/* 待发送数据总长度，包括 sndQueue 和 sndItems 中的数据（原子更新，生产者压入数据后增加、工作线程发送后减少，
+	   工作线程可能先于生产者增加长度就把数据发送完毕，因此可能短暂为负数） */
+	volatile int pending;
 
 	static TSocketObj* Construct(CPrivateHeap& hp, CBufferObjPool& bfPool)
 	{
@@ -471,17 +581,80 @@ struct TSocketObj : public TSocketObjBase
 	}
 	
 	TSocketObj(CPrivateHeap& hp, CBufferObjPool& bfPool)
-	: __super(hp, bfPool)
+	: __super(hp, bfPool), sndQueue(bfPool), sndItems(bfPool)
+	{
+
+	}
+
+	static void Release(TSocketObj* pSocketObj)
 	{
+		__super::Release(pSocketObj);
 
+		pSocketObj->sndQueue.Close();
+		pSocketObj->sndItems.Release();
+		pSocketObj->pending = 0;
 	}
 
 	void Reset(CONNID dwConnID, SOCKET soClient)
 	{
 		__super::Reset(dwConnID);
 		
-		socket = soClient;
+		socket	 = soClient;
+		armed	 = 0;
+		processing = FALSE;
+		sending	 = FALSE;
+		coalesce = 0;
+		held	 = FALSE;
+
+		highWater	 = FALSE;
+		highNotified = FALSE;
+		pending		 = 0;
+
+		sndQueue.Reset();
 	}
+
+	int Pending			()	const	{int iPending = pending; return iPending > 0 ? iPending : 0;}
+	BOOL IsPending		()	const	{return Pending() > 0;}
+
+	void ReducePending	(int iLength)	{::InterlockedSub(&pending, iLength);}
+
+	/* 把生产者在本地组装好的数据块链压入 sndQueue 并增加待发送长度（lsBuff 随后为空），返回是否无需通知工作线程：
+	   待发送长度在压入之后增加，使待发送长度从无到有的生产者负责通知工作线程；
+	   连接已关闭时 lsBuff 保持不变，由调用者检查连接状态 */
+	BOOL PushSendItems(TBufferObjList& lsBuff)
+	{
+		int iLength = lsBuff.Length();
+
+		if(iLength == 0 || !sndQueue.Push(lsBuff))
+			return IsPending();
+
+		lsBuff.ReduceLength(iLength);
+
+		return (::InterlockedExchangeAdd(&pending, iLength) > 0);
+	}
+
+	/* 复制小数据压入 sndQueue（iLength 为跳过 iSkip 字节后的数据长度，须满足 sndQueue.CanCopy()），返回值同上；
+	   工作线程正在等待本次提交的数据时也由本生产者通知工作线程 */
+	BOOL PushSendCopy(const WSABUF pBuffers[], int iCount, int iSkip, int iLength)
+	{
+		BOOL bWait = FALSE;
+
+		if(!sndQueue.PushCopy(pBuffers, iCount, iSkip, iLength, bWait))
+			return IsPending();
+
+		return (::InterlockedExchangeAdd(&pending, iLength) > 0 && !bWait);
+	}
+
+	/* 把生产者压入 sndQueue 的数据整体移入 sndItems（仅由所属工作线程调用，无需加锁） */
+	BOOL DetachSendBuffer()
+	{
+		sndQueue.Pop(sndItems);
+
+		return !sndItems.IsEmpty();
+	}
+
+	/* 有需要工作线程发送的数据（暂存等待合并的数据及等待生产者提交的数据除外，仅由所属工作线程调用） */
+	BOOL IsSendPending() const {return IsPending() && !held && !sndQueue.IsWaiting();}
 };
 
 /* Agent 数据缓冲区结构 */
@@ -537,9 +710,9 @@ struct TUdpSocketObj : public TSocketObjBase
 {
 	using __super = TSocketObjBase;
 
-	int		index;
 	PVOID	pHolder;
-	FD		fdTimer;
+
+	TDispTimer		timer;
 
 	volatile DWORD	detectFails;
 
@@ -570,9 +743,7 @@ struct TUdpSocketObj : public TSocketObjBase
 	{
 		__super::Reset(dwConnID);
 
-		index		= -1;
 		detectFails	= 0;
-		fdTimer		= INVALID_FD;
 		pHolder		= nullptr;
 	}
 };
@@ -650,6 +821,33 @@ struct TClientCloseContext
 
 };
 
+/* 单次 I/O 事件处理的读写预算（字节数 / 时间），超出预算后让出工作线程，由下一轮事件循环继续处理该连接 */
+struct TIoBudget
+{
+	int iBytes;
+	ULLONG ullDeadline;
+
+	/* dwBytes：字节预算（0 则不限制）；dwTime：时间预算（微秒，0 则不限制）；bUnlimited：是否忽略预算 */
+	TIoBudget(DWORD dwBytes, DWORD dwTime, BOOL bUnlimited = FALSE)
+	{
+		iBytes		= (bUnlimited || dwBytes == 0) ? -1 : (int)MIN(dwBytes, (DWORD)MAXINT);
+		ullDeadline	= (bUnlimited || dwTime == 0) ? 0 : ::TimeGetMicroTime64() + dwTime;
+	}
+
+	/* 扣减已处理的字节数，返回预算是否已经用完 */
+	BOOL Consume(int iSize)
+	{
+		if(iBytes >= 0 && (iBytes -= MIN(iSize, iBytes)) == 0)
+			return TRUE;
+
+		return (ullDeadline != 0 && ::TimeGetMicroTime64() >= ullDeadline);
+	}
+};
+
+/* 未设置读取预算时的默认值（Socket 缓冲区大小的 DEFAULT_TCP_READ_BUDGET_BUFFERS 倍） */
+inline DWORD GetDefaultReadBudget(DWORD dwSocketBufferSize)
+	{return (DWORD)MIN((ULONGLONG)DEFAULT_TCP_READ_BUDGET_BUFFERS * dwSocketBufferSize, (ULONGLONG)MAXINT);}
+
 /*****************************************************************************************************/
 /******************************************** 公共帮助方法 ********************************************/
 /*****************************************************************************************************/
@@ -725,6 +923,10 @@ DWORD HToBE32(DWORD value);
 
 HRESULT ReadSmallFile(LPCTSTR lpszFileName, CFile& file, CFileMapping& fmap, DWORD dwMaxFileSize = MAX_SMALL_FILE_SIZE);
 HRESULT MakeSmallFilePackage(LPCTSTR lpszFileName, CFile& file, CFileMapping& fmap, WSABUF szBuf[3], const LPWSABUF pHead = nullptr, const LPWSABUF pTail = nullptr);
+/* 打开待发送的文件并检查发送范围（ullLength 为 0 则发送到文件末尾） */
+HRESULT OpenSendFile(LPCTSTR lpszFileName, CFile& file, ULONGLONG ullOffset, ULONGLONG& ullLength);
+/* 把文件发送范围的数据读取到内存，用于需要对发送数据进行处理的组件 */
+HRESULT ReadSendFile(CFile& file, ULONGLONG ullOffset, ULONGLONG ullLength, CBufferPtr& buffer);
 
 /************************************************************************
 名称：setsockopt() 帮助方法
@@ -747,6 +949,43 @@ int SSO_SendBuffSize		(SOCKET sock, int size);
 int SSO_RecvTimeOut			(SOCKET sock, int ms);
 int SSO_SendTimeOut			(SOCKET sock, int ms);
 int SSO_GetError			(SOCKET sock);
+int SSO_IncomingCpu			(SOCKET sock, int iCpu);
+int SSO_BusyPoll			(SOCKET sock, int iMicroseconds, BOOL bPrefer = TRUE);
+int SSO_QuickAck			(SOCKET sock, BOOL bQuickAck = TRUE);
+int SSO_DeferAccept			(SOCKET sock, DWORD dwTime);
+int SSO_ZeroCopy			(SOCKET sock, BOOL bZeroCopy = TRUE);
+int SSO_NotSentLowat		(SOCKET sock, DWORD dwLowat);
+
+/* 通过一次 writev() 聚集写入缓冲区链表头部的数据（最多 MAX_SEND_IOV_COUNT 个缓冲区） */
+int WriteItems(SOCKET sock, const TItemList& lsItem, int iBreakSize = 0);
+/* 通过一次 readv() 把数据直接读取到连接接收缓冲区尾部（尾节点剩余空间和一个新节点） */
+int ReadBuffer(SOCKET sock, TBuffer* pBuffer);
+/* 以 MSG_ZEROCOPY 方式发送数据，发送成功后数据必须保持有效直到收到内核完成通知 */
+int SendZeroCopy(SOCKET sock, const BYTE* pData, int iLength);
+/* 读取错误队列中的 MSG_ZEROCOPY 完成通知，返回读取的通知数目（-1：错误队列中有其它错误），uiDone 返回已完成的最大发送序号 */
+int ReadZeroCopyNotifications(SOCKET sock, UINT& uiDone);
+/* 通过一次 sendmsg() 聚集写入用户缓冲区数组（MSG_NOSIGNAL，可在任意线程中调用） */
+int WriteBuffers(SOCKET sock, const WSABUF pBuffers[], int iCount);
+/* 把用户缓冲区数组（跳过前 iSkip 字节）加入发送缓冲区，fnRelease 不为空时以引用方式加入较大的数据块 */
+void CatSendBuffers(TBufferObjList& lsBuff, const WSABUF pBuffers[], int iCount, int iSkip = 0, Fn_SendBufferRelease fnRelease = nullptr, PVOID pvArg = nullptr);
+
+/* 把头部数据、文件和尾部数据加入发送缓冲区，文件描述符转由发送缓冲区管理，fnComplete 在全部数据发送完毕或被丢弃时调用 */
+void CatSendFile(TBufferObjList& lsBuff, CFile& file, ULONGLONG ullOffset, ULONGLONG ullLength, const LPWSABUF pHead = nullptr, const LPWSABUF pTail = nullptr, Fn_SendBufferRelease fnComplete = nullptr, PVOID pvArg = nullptr);
+/* 通过 sendfile() 发送文件数据块（最多 MAX_SEND_FILE_CHUNK_SIZE 字节），iPending 返回数据块减少的待发送数据长度 */
+int SendFileItem(SOCKET sock, TItem* pItem, int& iPending);
+/* 文件数据块计入待发送数据长度的值 */
+inline int GetFileItemPending(const TItem* pItem) {return (int)MIN(pItem->FileRemain(), (LONGLONG)MAX_SEND_FILE_CHUNK_SIZE);}
+
+/* 调用发送缓冲区释放函数（保留当前错误代码） */
+inline void InvokeSendBufferRelease(Fn_SendBufferRelease fnRelease, PVOID pvArg)
+{
+	if(fnRelease != nullptr)
+	{
+		int iError = ::GetLastError();
+		fnRelease(pvArg);
+		::SetLastError(iError);
+	}
+}
 
 /* 生成 Connection ID */
 CONNID GenerateConnectionID();
@@ -758,6 +997,8 @@ int SendUdpCloseNotify(SOCKET sock);
 int SendUdpCloseNotify(SOCKET sock, const HP_SOCKADDR& remoteAddr);
 /* 关闭 Socket */
 int ManualCloseSocket(SOCKET sock, int iShutdownFlag = 0xFF, BOOL bGraceful = TRUE);
+/* 根据 CPU 亲和策略生成工作线程依次绑定的 CPU 列表（CAP_NONE 策略返回空列表） */
+BOOL MakeCpuAffinityList(EnCpuAffinityPolicy enPolicy, LPCTSTR lpszCpuList, vector<int>& vtCpus);
 
 #ifdef _ICONV_SUPPORT
 
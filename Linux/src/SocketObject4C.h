@@ -114,6 +114,34 @@ public:
 				: HR_IGNORE;
 	}
 
+	virtual EnHandleResult OnReceiveBatch(T* pSender, CONNID dwConnID, const WSABUF pFrames[], int iCount)
+	{
+		if(m_fnOnReceiveBatch)
+			return m_fnOnReceiveBatch(C_HP_Object::FromSecond<offset>(pSender), dwConnID, pFrames, iCount);
+
+		for(int i = 0; i < iCount; i++)
+		{
+			if(OnReceive(pSender, dwConnID, (const BYTE*)pFrames[i].buf, (int)pFrames[i].len) == HR_ERROR)
+				return HR_ERROR;
+		}
+
+		return HR_OK;
+	}
+
+	virtual EnHandleResult OnSendBufferHigh(T* pSender, CONNID dwConnID, int iPending)
+	{
+		return	(m_fnOnSendBufferHigh)
+				? m_fnOnSendBufferHigh(C_HP_Object::FromSecond<offset>(pSender), dwConnID, iPending)
+				: HR_IGNORE;
+	}
+
+	virtual EnHandleResult OnSendBufferDrained(T* pSender, CONNID dwConnID, int iPending)
+	{
+		return	(m_fnOnSendBufferDrained)
+				? m_fnOnSendBufferDrained(C_HP_Object::FromSecond<offset>(pSender), dwConnID, iPending)
+				: HR_IGNORE;
+	}
+
 	virtual EnHandleResult OnClose(T* pSender, CONNID dwConnID, EnSocketOperation enOperation, int iErrorCode)
 	{
 		ASSERT(m_fnOnClose);
@@ -138,6 +166,9 @@ public:
 	, m_fnOnSend			(nullptr)
 	, m_fnOnReceive			(nullptr)
 	, m_fnOnPullReceive		(nullptr)
+	, m_fnOnReceiveBatch	(nullptr)
+	, m_fnOnSendBufferHigh	(nullptr)
+	, m_fnOnSendBufferDrained(nullptr)
 	, m_fnOnClose			(nullptr)
 	, m_fnOnShutdown		(nullptr)
 	{
@@ -150,6 +181,9 @@ public:
 	HP_FN_Server_OnSend				m_fnOnSend			;
 	HP_FN_Server_OnReceive			m_fnOnReceive		;
 	HP_FN_Server_OnPullReceive		m_fnOnPullReceive	;
+	HP_FN_Server_OnReceiveBatch		m_fnOnReceiveBatch	;
+	HP_FN_Server_OnSendBufferHigh		m_fnOnSendBufferHigh;
+	HP_FN_Server_OnSendBufferDrained	m_fnOnSendBufferDrained;
 	HP_FN_Server_OnClose			m_fnOnClose			;
 	HP_FN_Server_OnShutdown			m_fnOnShutdown		;
 };
@@ -203,6 +237,34 @@ public:
 				: HR_IGNORE;
 	}
 
+	virtual EnHandleResult OnReceiveBatch(T* pSender, CONNID dwConnID, const WSABUF pFrames[], int iCount)
+	{
+		if(m_fnOnReceiveBatch)
+			return m_fnOnReceiveBatch(C_HP_Object::FromSecond<offset>(pSender), dwConnID, pFrames, iCount);
+
+		for(int i = 0; i < iCount; i++)
+		{
+			if(OnReceive(pSender, dwConnID, (const BYTE*)pFrames[i].buf, (int)pFrames[i].len) == HR_ERROR)
+				return HR_ERROR;
+		}
+
+		return HR_OK;
+	}
+
+	virtual EnHandleResult OnSendBufferHigh(T* pSender, CONNID dwConnID, int iPending)
+	{
+		return	(m_fnOnSendBufferHigh)
+				? m_fnOnSendBufferHigh(C_HP_Object::FromSecond<offset>(pSender), dwConnID, iPending)
+				: HR_IGNORE;
+	}
+
+	virtual EnHandleResult OnSendBufferDrained(T* pSender, CONNID dwConnID, int iPending)
+	{
+		return	(m_fnOnSendBufferDrained)
+				? m_fnOnSendBufferDrained(C_HP_Object::FromSecond<offset>(pSender), dwConnID, iPending)
+				: HR_IGNORE;
+	}
+
 	virtual EnHandleResult OnClose(T* pSender, CONNID dwConnID, EnSocketOperation enOperation, int iErrorCode)
 	{
 		ASSERT(m_fnOnClose);
@@ -227,6 +289,9 @@ public:
 	, m_fnOnSend			(nullptr)
 	, m_fnOnReceive			(nullptr)
 	, m_fnOnPullReceive		(nullptr)
+	, m_fnOnReceiveBatch	(nullptr)
+	, m_fnOnSendBufferHigh	(nullptr)
+	, m_fnOnSendBufferDrained(nullptr)
 	, m_fnOnClose			(nullptr)
 	, m_fnOnShutdown		(nullptr)
 	{
@@ -239,6 +304,9 @@ public:
 	HP_FN_Agent_OnSend				m_fnOnSend			;
 	HP_FN_Agent_OnReceive			m_fnOnReceive		;
 	HP_FN_Agent_OnPullReceive		m_fnOnPullReceive	;
+	HP_FN_Agent_OnReceiveBatch		m_fnOnReceiveBatch	;
+	HP_FN_Agent_OnSendBufferHigh		m_fnOnSendBufferHigh;
+	HP_FN_Agent_OnSendBufferDrained	m_fnOnSendBufferDrained;
 	HP_FN_Agent_OnClose				m_fnOnClose			;
 	HP_FN_Agent_OnShutdown			m_fnOnShutdown		;
 };
@@ -292,6 +360,20 @@ public:
 				: HR_IGNORE;
 	}
 
+	virtual EnHandleResult OnReceiveBatch(T* pSender, CONNID dwConnID, const WSABUF pFrames[], int iCount)
+	{
+		if(m_fnOnReceiveBatch)
+			return m_fnOnReceiveBatch(C_HP_Object::FromSecond<offset>(pSender), dwConnID, pFrames, iCount);
+
+		for(int i = 0; i < iCount; i++)
+		{
+			if(OnReceive(pSender, dwConnID, (const BYTE*)pFrames[i].buf, (int)pFrames[i].len) == HR_ERROR)
+				return HR_ERROR;
+		}
+
+		return HR_OK;
+	}
+
 	virtual EnHandleResult OnClose(T* pSender, CONNID dwConnID, EnSocketOperation enOperation, int iErrorCode)
 	{
 		ASSERT(m_fnOnClose);
@@ -309,6 +391,7 @@ public:
 	, m_fnOnSend			(nullptr)
 	, m_fnOnReceive			(nullptr)
 	, m_fnOnPullReceive		(nullptr)
+	, m_fnOnReceiveBatch	(nullptr)
 	, m_fnOnClose			(nullptr)
 	{
 	}
@@ -320,6 +403,7 @@ public:
 	HP_FN_Client_OnSend				m_fnOnSend			;
 	HP_FN_Client_OnReceive			m_fnOnReceive		;
 	HP_FN_Client_OnPullReceive		m_fnOnPullReceive	;
+	HP_FN_Client_OnReceiveBatch		m_fnOnReceiveBatch	;
 	HP_FN_Client_OnClose			m_fnOnClose			;
 };
 
@@ -607,6 +691,12 @@ public:
 		{return m_lsnServer.OnReceive(pSender, dwConnID, pData, iLength);}
 	virtual EnHandleResult OnReceive(ITcpServer* pSender, CONNID dwConnID, int iLength)
 		{return m_lsnServer.OnReceive(pSender, dwConnID, iLength);}
+	virtual EnHandleResult OnReceiveBatch(ITcpServer* pSender, CONNID dwConnID, const WSABUF pFrames[], int iCount)
+		{return m_lsnServer.OnReceiveBatch(pSender, dwConnID, pFrames, iCount);}
+	virtual EnHandleResult OnSendBufferHigh(ITcpServer* pSender, CONNID dwConnID, int iPending)
+		{return m_lsnServer.OnSendBufferHigh(pSender, dwConnID, iPending);}
+	virtual EnHandleResult OnSendBufferDrained(ITcpServer* pSender, CONNID dwConnID, int iPending)
+		{return m_lsnServer.OnSendBufferDrained(pSender, dwConnID, iPending);}
 	virtual EnHandleResult OnClose(ITcpServer* pSender, CONNID dwConnID, EnSocketOperation enOperation, int iErrorCode)
 		{return m_lsnServer.OnClose(pSender, dwConnID, enOperation, iErrorCode);}
 	virtual EnHandleResult OnShutdown(ITcpServer* pSender)
@@ -662,6 +752,12 @@ public:
 		{return m_lsnAgent.OnReceive(pSender, dwConnID, pData, iLength);}
 	virtual EnHandleResult OnReceive(ITcpAgent* pSender, CONNID dwConnID, int iLength)
 		{return m_lsnAgent.OnReceive(pSender, dwConnID, iLength);}
+	virtual EnHandleResult OnReceiveBatch(ITcpAgent* pSender, CONNID dwConnID, const WSABUF pFrames[], int iCount)
+		{return m_lsnAgent.OnReceiveBatch(pSender, dwConnID, pFrames, iCount);}
+	virtual EnHandleResult OnSendBufferHigh(ITcpAgent* pSender, CONNID dwConnID, int iPending)
+		{return m_lsnAgent.OnSendBufferHigh(pSender, dwConnID, iPending);}
+	virtual EnHandleResult OnSendBufferDrained(ITcpAgent* pSender, CONNID dwConnID, int iPending)
+		{return m_lsnAgent.OnSendBufferDrained(pSender, dwConnID, iPending);}
 	virtual EnHandleResult OnClose(ITcpAgent* pSender, CONNID dwConnID, EnSocketOperation enOperation, int iErrorCode)
 		{return m_lsnAgent.OnClose(pSender, dwConnID, enOperation, iErrorCode);}
 	virtual EnHandleResult OnShutdown(ITcpAgent* pSender)
@@ -717,6 +813,8 @@ public:
 		{return m_lsnClient.OnReceive(pSender, dwConnID, pData, iLength);}
 	virtual EnHandleResult OnReceive(ITcpClient* pSender, CONNID dwConnID, int iLength)
 		{return m_lsnClient.OnReceive(pSender, dwConnID, iLength);}
+	virtual EnHandleResult OnReceiveBatch(ITcpClient* pSender, CONNID dwConnID, const WSABUF pFrames[], int iCount)
+		{return m_lsnClient.OnReceiveBatch(pSender, dwConnID, pFrames, iCount);}
 	virtual EnHandleResult OnClose(ITcpClient* pSender, CONNID dwConnID, EnSocketOperation enOperation, int iErrorCode)
 		{return m_lsnClient.OnClose(pSender, dwConnID, enOperation, iErrorCode);}
 
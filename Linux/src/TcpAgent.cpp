@@ -66,7 +66,11 @@ BOOL CTcpAgent::CheckParams()
 		((int)m_dwFreeSocketObjHold >= 0)														&&
 		((int)m_dwFreeBufferObjHold >= 0)														&&
 		((int)m_dwKeepAliveTime >= 1000 || m_dwKeepAliveTime == 0)								&&
-		((int)m_dwKeepAliveInterval >= 1000 || m_dwKeepAliveInterval == 0)						)
+		((int)m_dwKeepAliveInterval >= 1000 || m_dwKeepAliveInterval == 0)						&&
+		((int)m_dwBusyPollTime >= 0)															&&
+		((int)m_dwRebalanceThreshold >= 0 && m_dwRebalanceThreshold <= 100)						&&
+		(m_dwSendHighWatermark == 0 || m_dwSendLowWatermark < m_dwSendHighWatermark)			&&
+		(::MakeCpuAffinityList(m_enCpuAffinityPolicy, m_strCpuAffinityList, m_vtCpus))			)
 		return TRUE;
 
 	SetLastError(SE_INVALID_PARAM, __FUNCTION__, ERROR_INVALID_PARAMETER);
@@ -84,8 +88,14 @@ void CTcpAgent::PrepareStart()
 
 	m_bfObjPool.Prepare();
 
-	m_rcBuffers = make_unique<CBufferPtr[]>(m_dwWorkerThreadCount);
-	for_each(m_rcBuffers.get(), m_rcBuffers.get() + m_dwWorkerThreadCount, [this](CBufferPtr& buff) {buff.Malloc(m_dwSocketBufferSize);});
+	DWORD dwWorkerThreadCount = m_dwWorkerThreadCount
+#ifdef USE_EXTERNAL_GC
+														+ 1
+#endif
+														;
+
+	m_rcBuffers = make_unique<CBufferPtr[]>(dwWorkerThreadCount);
+	for_each(m_rcBuffers.get(), m_rcBuffers.get() + dwWorkerThreadCount, [this](CBufferPtr& buff) {buff.Malloc(m_dwSocketBufferSize);});
 }
 
 BOOL CTcpAgent::CheckStarting()
@@ -161,7 +171,13 @@ BOOL CTcpAgent::CreateWorkerThreads()
 #endif
 														;
 
-	if(!m_ioDispatcher.Start(this, DEFAULT_WORKER_MAX_EVENT_COUNT, dwWorkerThreadCount))
+	if(!m_ioDispatcher.Start(this, DEFAULT_WORKER_MAX_EVENT_COUNT, dwWorkerThreadCount, m_bUseIOUring, m_vtCpus, m_dwBusyPollTime, m_dwSocketBufferSize))
+	{
+		SetLastError(SE_WORKER_THREAD_CREATE, __FUNCTION__, ::WSAGetLastError());
+		return FALSE;
+	}
+
+	if(m_dwRebalanceThreshold > 0 && !m_ioDispatcher.StartRebalance(m_dwRebalanceThreshold))
 	{
 		SetLastError(SE_WORKER_THREAD_CREATE, __FUNCTION__, ::WSAGetLastError());
 		return FALSE;
@@ -332,6 +348,16 @@ int CTcpAgent::CreateClientSocket(LPCTSTR lpszRemoteAddress, USHORT usPort, LPCT
 		VERIFY(IS_NO_ERROR(::SSO_ReuseAddress(soClient, m_enReusePolicy)));
 		VERIFY(IS_NO_ERROR(::SSO_NoDelay(soClient, m_bNoDelay)));
 
+		if(m_dwBusyPollTime > 0)
+		{
+			::SSO_BusyPoll(soClient, (int)m_dwBusyPollTime);
+			::SSO_QuickAck(soClient);
+		}
+
+		/* 内核未发送数据达到该值后写操作返回 EAGAIN，其余数据保留在发送缓冲区中直到 EPOLLOUT 再次就绪 */
+		if(m_dwNotSentLowat > 0)
+			VERIFY(IS_NO_ERROR(::SSO_NotSentLowat(soClient, m_dwNotSentLowat)));
+
 		if(bBind && usLocalPort == 0)
 		{
 			if(::bind(soClient, lpBindAddr->Addr(), lpBindAddr->AddrSize()) == SOCKET_ERROR)
@@ -380,7 +406,7 @@ int CTcpAgent::ConnectToServer(CONNID dwConnID, LPCTSTR lpszRemoteHostName, SOCK
 	{
 		if(m_bAsyncConnect)
 		{
-			if(m_ioDispatcher.AddFD(pSocketObj->socket, EPOLLOUT, pSocketObj))
+			if(m_ioDispatcher.AddFD(pSocketObj->index, pSocketObj->socket, EPOLLOUT, pSocketObj, pSocketObj->armed))
 				result = NO_ERROR;
 		}
 		else
@@ -396,9 +422,9 @@ int CTcpAgent::ConnectToServer(CONNID dwConnID, LPCTSTR lpszRemoteHostName, SOCK
 					result = ENSURE_ERROR_CANCELLED;
 				else
 				{
-					UINT evts = (pSocketObj->IsPending() ? EPOLLOUT : 0) | (pSocketObj->IsPaused() ? 0 : EPOLLIN);
+					UINT evts = (pSocketObj->IsSendPending() ? EPOLLOUT : 0) | (pSocketObj->IsPaused() ? 0 : EPOLLIN);
 
-					if(!m_ioDispatcher.AddFD(pSocketObj->socket, evts | EPOLLRDHUP, pSocketObj))
+					if(!m_ioDispatcher.AddFD(pSocketObj->index, pSocketObj->socket, evts | EPOLLRDHUP, pSocketObj, pSocketObj->armed))
 						result = HAS_ERROR;
 				}
 			}
@@ -456,6 +482,8 @@ void CTcpAgent::AddFreeSocketObj(TAgentSocketObj* pSocketObj, EnSocketCloseFlag
 	CloseClientSocketObj(pSocketObj, enFlag, enOperation, iErrorCode);
 
 	m_bfActiveSockets.Remove(pSocketObj->connID);
+
+	m_ioDispatcher.KillTimer(&pSocketObj->timer);
 	TAgentSocketObj::Release(pSocketObj);
 
 #ifndef USE_EXTERNAL_GC
@@ -482,8 +510,14 @@ void CTcpAgent::AddClientSocketObj(CONNID dwConnID, TAgentSocketObj* pSocketObj,
 
 	pSocketObj->connTime	= ::TimeGetTime();
 	pSocketObj->activeTime	= pSocketObj->connTime;
+	pSocketObj->index		= m_ioDispatcher.GetContextRefByFD(pSocketObj->socket).GetIndex();
 	pSocketObj->host		= lpszRemoteHostName;
 	pSocketObj->extra		= pExtra;
+	pSocketObj->zerocopy	= (m_dwZeroCopyThreshold > 0 && !m_ioDispatcher.IsCompletionIo() && IS_NO_ERROR(::SSO_ZeroCopy(pSocketObj->socket)));
+	pSocketObj->coalesce	= m_dwCoalesceSize;
+	pSocketObj->pHolder		= this;
+	pSocketObj->timer.fn	= FlushCoalesced;
+	pSocketObj->timer.pv	= pSocketObj;
 
 	pSocketObj->SetConnected(CST_CONNECTING);
 	remoteAddr.Copy(pSocketObj->remoteAddr);
@@ -513,6 +547,7 @@ void CTcpAgent::CloseClientSocketObj(TAgentSocketObj* pSocketObj, EnSocketCloseF
 	SOCKET socket = pSocketObj->socket;
 	pSocketObj->socket = INVALID_SOCKET;
 
+	m_ioDispatcher.DetachFD(pSocketObj->index, socket);
 	::ManualCloseSocket(socket, iShutdownFlag);
 }
 
@@ -632,6 +667,27 @@ BOOL CTcpAgent::GetConnectionExtra(TAgentSocketObj* pSocketObj, PVOID* ppExtra)
 	return FALSE;
 }
 
+BOOL CTcpAgent::SetConnectionCoalesceSize(CONNID dwConnID, DWORD dwCoalesceSize)
+{
+	TAgentSocketObj* pSocketObj = FindSocketObj(dwConnID);
+
+	if(!TAgentSocketObj::IsValid(pSocketObj))
+	{
+		::SetLastError(ERROR_OBJECT_NOT_FOUND);
+		return FALSE;
+	}
+
+	CReentrantCriSecLock locallock(pSocketObj->csSend);
+
+	pSocketObj->coalesce = dwCoalesceSize;
+
+	/* 关闭合并或调小阈值后立即发送已暂存的数据 */
+	if(pSocketObj->held && pSocketObj->Pending() >= (int)dwCoalesceSize)
+		RequestSend(pSocketObj, FALSE);
+
+	return TRUE;
+}
+
 BOOL CTcpAgent::SetConnectionReserved(CONNID dwConnID, PVOID pReserved)
 {
 	TAgentSocketObj* pSocketObj = FindSocketObj(dwConnID);
@@ -810,7 +866,7 @@ BOOL CTcpAgent::Disconnect(CONNID dwConnID, BOOL bForce)
 		return FALSE;
 	}
 
-	return m_ioDispatcher.SendCommandByFD(pSocketObj->socket, DISP_CMD_DISCONNECT, dwConnID, bForce);
+	return SendCommand(pSocketObj, DISP_CMD_DISCONNECT, bForce);
 }
 
 BOOL CTcpAgent::DisconnectLongConnections(DWORD dwPeriod, BOOL bForce)
@@ -885,11 +941,69 @@ BOOL CTcpAgent::PauseReceive(CONNID dwConnID, BOOL bPause)
 	pSocketObj->paused = bPause;
 
 	if(!bPause)
-		return m_ioDispatcher.SendCommandByFD(pSocketObj->socket, DISP_CMD_UNPAUSE, pSocketObj->connID);
+		return SendCommand(pSocketObj, DISP_CMD_UNPAUSE);
 
 	return TRUE;
 }
 
+BOOL CTcpAgent::Flush(CONNID dwConnID)
+{
+	TAgentSocketObj* pSocketObj = FindSocketObj(dwConnID);
+
+	if(!TAgentSocketObj::IsValid(pSocketObj))
+	{
+		::SetLastError(ERROR_OBJECT_NOT_FOUND);
+		return FALSE;
+	}
+
+	return FlushInternal(pSocketObj);
+}
+
+BOOL CTcpAgent::FlushInternal(TAgentSocketObj* pSocketObj)
+{
+	int result = NO_ERROR;
+
+	{
+		CLocalSafeCounter localcounter(*pSocketObj);
+		CReentrantCriSecLock locallock(pSocketObj->csSend);
+
+		if(!TAgentSocketObj::IsValid(pSocketObj))
+			result = ERROR_OBJECT_NOT_FOUND;
+		else if(pSocketObj->held)
+			result = RequestSend(pSocketObj, FALSE);
+	}
+
+	if(result != NO_ERROR)
+		::SetLastError(result);
+
+	return (result == NO_ERROR);
+}
+
+void CTcpAgent::FlushCoalesced(PVOID pv)
+{
+	TAgentSocketObj* pSocketObj = (TAgentSocketObj*)pv;
+	((CTcpAgent*)pSocketObj->pHolder)->FlushInternal(pSocketObj);
+}
+
+BOOL CTcpAgent::Post(CONNID dwConnID, Fn_ConnTaskProc fnProc, PVOID pvArg)
+{
+	if(fnProc == nullptr)
+	{
+		::SetLastError(ERROR_INVALID_PARAMETER);
+		return FALSE;
+	}
+
+	TAgentSocketObj* pSocketObj = FindSocketObj(dwConnID);
+
+	if(!TAgentSocketObj::IsValid(pSocketObj))
+	{
+		::SetLastError(ERROR_OBJECT_NOT_FOUND);
+		return FALSE;
+	}
+
+	return SendCommand(pSocketObj, DISP_CMD_POST, (UINT_PTR)TConnTask::Construct(fnProc, pvArg));
+}
+
 BOOL CTcpAgent::OnBeforeProcessIo(const TDispContext* pContext, PVOID pv, UINT events)
 {
 	if(pv == this)
@@ -905,7 +1019,7 @@ BOOL CTcpAgent::OnBeforeProcessIo(const TDispContext* pContext, PVOID pv, UINT e
 	if(!TAgentSocketObj::IsValid(pSocketObj))
 		return FALSE;
 
-	if(events & _EPOLL_ALL_ERROR_EVENTS)
+	if((events & _EPOLL_HUNGUP_EVENTS) || ((events & _EPOLL_ERROR_EVENTS) && !(pSocketObj->zerocopy && pSocketObj->HasConnected())))
 		pSocketObj->SetConnected(FALSE);
 
 	pSocketObj->Increment();
@@ -924,6 +1038,8 @@ BOOL CTcpAgent::OnBeforeProcessIo(const TDispContext* pContext, PVOID pv, UINT e
 		return FALSE;
 	}
 
+	pSocketObj->processing = TRUE;
+
 	return TRUE;
 }
 
@@ -931,19 +1047,58 @@ VOID CTcpAgent::OnAfterProcessIo(const TDispContext* pContext, PVOID pv, UINT ev
 {
 	TAgentSocketObj* pSocketObj = (TAgentSocketObj*)(pv);
 
+	pSocketObj->processing = FALSE;
+
+	/* 事件处理期间在本线程中发送的数据直接发送，仍未发送完毕时才注册写事件 */
+	if(TAgentSocketObj::IsValid(pSocketObj) && !(events & EPOLLOUT) && pSocketObj->IsSendPending())
+		HandleSend(pContext, pSocketObj, RETRIVE_EVENT_FLAG_H(events));
+
 	if(TAgentSocketObj::IsValid(pSocketObj))
 	{
-		ASSERT(rs && !(events & (EPOLLERR | EPOLLHUP | EPOLLRDHUP)));
+		ASSERT(rs && !(events & (EPOLLHUP | EPOLLRDHUP)) && (!(events & EPOLLERR) || pSocketObj->zerocopy));
 
-		UINT evts = (pSocketObj->IsPending() ? EPOLLOUT : 0) | (pSocketObj->IsPaused() ? 0 : EPOLLIN);
-		m_ioDispatcher.ModFD(pSocketObj->socket, evts | EPOLLRDHUP, pSocketObj);
+		UINT evts = ((pSocketObj->IsSendPending() && !pSocketObj->sending) ? EPOLLOUT : 0) | (pSocketObj->IsPaused() ? 0 : EPOLLIN);
+		m_ioDispatcher.ModFD(pSocketObj->index, pSocketObj->socket, evts | EPOLLRDHUP, pSocketObj, pSocketObj->armed);
 	}
 
 	pSocketObj->Decrement();
 }
 
+BOOL CTcpAgent::OnMigrate(const TDispContext* pContext, PVOID pv, int iTarget)
+{
+	if(pv == this)
+		return FALSE;
+
+	TAgentSocketObj* pSocketObj = (TAgentSocketObj*)(pv);
+
+	if(!TAgentSocketObj::IsValid(pSocketObj) || !pSocketObj->HasConnected() || pSocketObj->index != pContext->GetIndex())
+		return FALSE;
+
+	CReentrantCriSecLock locallock(pSocketObj->csSend);
+
+	/* 当前工作线程中还有该连接的命令未执行时暂不迁移，保证连接的命令按投递顺序执行 */
+	if(pSocketObj->commands > 0)
+		return FALSE;
+
+	if(!m_ioDispatcher.DelFD(pSocketObj->index, pSocketObj->socket))
+		return FALSE;
+
+	pSocketObj->armed = 0;
+	pSocketObj->index = iTarget;
+
+	/* 切换所属工作线程与投递迁入命令在同一临界区内完成，此后投递到目标工作线程的命令都在迁入命令之后执行 */
+	VERIFY(SendCommand(pSocketObj, DISP_CMD_MIGRATE));
+
+	return TRUE;
+}
+
 VOID CTcpAgent::OnCommand(const TDispContext* pContext, TDispCommand* pCmd)
 {
+	TAgentSocketObj* pSocketObj = FindSocketObj((CONNID)(pCmd->wParam));
+
+	if(TAgentSocketObj::IsExist(pSocketObj))
+		--pSocketObj->commands;
+
 	switch(pCmd->type)
 	{
 	case DISP_CMD_SEND:
@@ -955,9 +1110,24 @@ VOID CTcpAgent::OnCommand(const TDispContext* pContext, TDispCommand* pCmd)
 	case DISP_CMD_DISCONNECT:
 		HandleCmdDisconnect(pContext, (CONNID)(pCmd->wParam), (BOOL)pCmd->lParam);
 		break;
+	case DISP_CMD_MIGRATE:
+		HandleCmdMigrate(pContext, (CONNID)(pCmd->wParam));
+		break;
+	case DISP_CMD_POST:
+		HandleCmdPost(pContext, (CONNID)(pCmd->wParam), (TConnTask*)(pCmd->lParam));
+		break;
+	case DISP_CMD_HIGH_WATER:
+		HandleCmdHighWater(pContext, (CONNID)(pCmd->wParam));
+		break;
 	}
 }
 
+VOID CTcpAgent::OnDropCommand(TDispCommand* pCmd)
+{
+	if(pCmd->type == DISP_CMD_POST)
+		TConnTask::Execute((TConnTask*)(pCmd->lParam), (CONNID)(pCmd->wParam), FALSE);
+}
+
 VOID CTcpAgent::HandleCmdSend(const TDispContext* pContext, CONNID dwConnID)
 {
 	TAgentSocketObj* pSocketObj = FindSocketObj(dwConnID);
@@ -973,8 +1143,9 @@ VOID CTcpAgent::HandleCmdUnpause(const TDispContext* pContext, CONNID dwConnID)
 	if(!TAgentSocketObj::IsValid(pSocketObj))
 		return;
 
+	/* 完成模式下重新注册接收即可，暂停期间保留的数据由事件环重新投递 */
 	if(BeforeUnpause(pSocketObj))
-		m_ioDispatcher.ProcessIo(pContext, pSocketObj, EPOLLIN);
+		m_ioDispatcher.ProcessIo(pContext, pSocketObj, m_ioDispatcher.IsCompletionIo() ? 0 : EPOLLIN);
 	else
 		AddFreeSocketObj(pSocketObj, SCF_ERROR, SO_RECEIVE, ENSURE_ERROR_CANCELLED);
 }
@@ -987,6 +1158,45 @@ VOID CTcpAgent::HandleCmdDisconnect(const TDispContext* pContext, CONNID dwConnI
 		m_ioDispatcher.ProcessIo(pContext, pSocketObj, EPOLLHUP);
 }
 
+VOID CTcpAgent::HandleCmdMigrate(const TDispContext* pContext, CONNID dwConnID)
+{
+	TAgentSocketObj* pSocketObj = FindSocketObj(dwConnID);
+
+	if(!TAgentSocketObj::IsValid(pSocketObj) || pSocketObj->index != pContext->GetIndex())
+		return;
+
+	UINT evts = ((pSocketObj->IsSendPending() && !pSocketObj->sending) ? EPOLLOUT : 0) | (pSocketObj->IsPaused() ? 0 : EPOLLIN);
+
+	if(!m_ioDispatcher.AddFD(pSocketObj->index, pSocketObj->socket, evts | EPOLLRDHUP, pSocketObj, pSocketObj->armed))
+		AddFreeSocketObj(pSocketObj, SCF_ERROR, SO_RECEIVE, ::WSAGetLastError());
+}
+
+VOID CTcpAgent::HandleCmdPost(const TDispContext* pContext, CONNID dwConnID, TConnTask* pTask)
+{
+	TConnTask::Execute(pTask, dwConnID, TAgentSocketObj::IsValid(FindSocketObj(dwConnID)));
+}
+
+VOID CTcpAgent::HandleCmdHighWater(const TDispContext* pContext, CONNID dwConnID)
+{
+	TAgentSocketObj* pSocketObj = FindSocketObj(dwConnID);
+
+	if(!TAgentSocketObj::IsValid(pSocketObj) || !pSocketObj->highWater || pSocketObj->highNotified)
+		return;
+
+	pSocketObj->highNotified = TRUE;
+
+	if(TRIGGER(FireSendBufferHigh(pSocketObj, pSocketObj->Pending())) == HR_ERROR)
+	{
+		TRACE("<C-CNNID: %zu> OnSendBufferHigh() event return 'HR_ERROR', connection will be closed !", dwConnID);
+
+		AddFreeSocketObj(pSocketObj, SCF_ERROR, SO_SEND, ENSURE_ERROR_CANCELLED);
+		return;
+	}
+
+	/* 通知送达前发送缓冲区可能已经排空 */
+	CheckDrained(pSocketObj);
+}
+
 BOOL CTcpAgent::OnReadyRead(const TDispContext* pContext, PVOID pv, UINT events)
 {
 	return HandleReceive(pContext, (TAgentSocketObj*)pv, RETRIVE_EVENT_FLAG_H(events));
@@ -997,6 +1207,33 @@ BOOL CTcpAgent::OnReadyWrite(const TDispContext* pContext, PVOID pv, UINT events
 	return HandleSend(pContext, (TAgentSocketObj*)pv, RETRIVE_EVENT_FLAG_H(events));
 }
 
+EnHandleResult CTcpAgent::OnReceiveComplete(const TDispContext* pContext, PVOID pv, const BYTE* pData, int iResult)
+{
+	return HandleReceived(pContext, (TAgentSocketObj*)pv, pData, iResult);
+}
+
+BOOL CTcpAgent::OnSendComplete(const TDispContext* pContext, PVOID pv, int iResult)
+{
+	TAgentSocketObj* pSocketObj = (TAgentSocketObj*)(pv);
+
+	pSocketObj->sending = FALSE;
+
+	/* 发送请求被取消时重新提交未发送的数据 */
+	if(iResult == -ERROR_CANCELLED)
+		iResult = 0;
+	else if(iResult < 0)
+	{
+		AddFreeSocketObj(pSocketObj, SCF_ERROR, SO_SEND, -iResult);
+		return FALSE;
+	}
+
+	if(iResult > 0)
+		ReduceSentItems(pSocketObj, pSocketObj->sndItems, iResult);
+
+	/* 本次完成可能已发送完所有数据，HandleSend() 直接返回，需要检查是否低于低水位 */
+	return HandleSend(pContext, pSocketObj, 0) && CheckDrained(pSocketObj);
+}
+
 BOOL CTcpAgent::OnHungUp(const TDispContext* pContext, PVOID pv, UINT events)
 {
 	return HandleClose(pContext, (TAgentSocketObj*)pv, SCF_CLOSE, events);
@@ -1007,6 +1244,23 @@ BOOL CTcpAgent::OnError(const TDispContext* pContext, PVOID pv, UINT events)
 	return HandleClose(pContext, (TAgentSocketObj*)pv, SCF_ERROR, events);
 }
 
+BOOL CTcpAgent::OnErrorQueue(const TDispContext* pContext, PVOID pv, UINT events)
+{
+	TAgentSocketObj* pSocketObj = (TAgentSocketObj*)(pv);
+
+	if(!pSocketObj->zerocopy || !pSocketObj->HasConnected())
+		return FALSE;
+
+	UINT uiDone = 0;
+
+	if(::ReadZeroCopyNotifications(pSocketObj->socket, uiDone) <= 0)
+		return FALSE;
+
+	pSocketObj->ReleaseZeroCopy(uiDone);
+
+	return TRUE;
+}
+
 VOID CTcpAgent::OnDispatchThreadStart(THR_ID tid)
 {
 	OnWorkerThreadStart(tid);
@@ -1062,9 +1316,9 @@ BOOL CTcpAgent::HandleConnect(const TDispContext* pContext, TAgentSocketObj* pSo
 		return FALSE;
 	}
 
-	UINT evts = (pSocketObj->IsPending() ? EPOLLOUT : 0) | (pSocketObj->IsPaused() ? 0 : EPOLLIN);
+	UINT evts = (pSocketObj->IsSendPending() ? EPOLLOUT : 0) | (pSocketObj->IsPaused() ? 0 : EPOLLIN);
 	
-	if(!m_ioDispatcher.ModFD(pSocketObj->socket, evts | EPOLLRDHUP, pSocketObj))
+	if(!m_ioDispatcher.ModFD(pSocketObj->index, pSocketObj->socket, evts | EPOLLRDHUP, pSocketObj, pSocketObj->armed))
 	{
 		AddFreeSocketObj(pSocketObj, SCF_ERROR, SO_CONNECT, ::WSAGetLastError());
 		return FALSE;
@@ -1080,25 +1334,36 @@ BOOL CTcpAgent::HandleReceive(const TDispContext* pContext, TAgentSocketObj* pSo
 	if(m_bMarkSilence) pSocketObj->activeTime = ::TimeGetTime();
 
 	CBufferPtr& buffer = m_rcBuffers[pContext->GetIndex()];
+	TBuffer* pDirect   = GetDirectReceiveBuffer(pSocketObj);
 
-	int reads = flag ? -1 : MAX_CONTINUE_READS;
+	TIoBudget budget(GetReadBudget(), m_dwIoTimeBudget, flag);
 
-	for(int i = 0; i < reads || reads < 0; i++)
+	while(TRUE)
 	{
 		if(pSocketObj->paused)
 			break;
 
-		int rc = (int)read(pSocketObj->socket, buffer.Ptr(), buffer.Size());
+		int rc = (pDirect != nullptr)
+				? ::ReadBuffer(pSocketObj->socket, pDirect)
+				: (int)read(pSocketObj->socket, buffer.Ptr(), buffer.Size());
 
 		if(rc > 0)
 		{
-			if(TRIGGER(FireReceive(pSocketObj, buffer.Ptr(), rc)) == HR_ERROR)
+			EnHandleResult rs = (pDirect != nullptr)
+								? TRIGGER(FireDirectReceive(pSocketObj, pDirect, rc))
+								: TRIGGER(FireReceive(pSocketObj, buffer.Ptr(), rc));
+
+			if(rs == HR_ERROR)
 			{
 				TRACE("<C-CNNID: %zu> OnReceive() event return 'HR_ERROR', connection will be closed !", pSocketObj->connID);
 
 				AddFreeSocketObj(pSocketObj, SCF_ERROR, SO_RECEIVE, ENSURE_ERROR_CANCELLED);
 				return FALSE;
 			}
+
+			/* 读取预算用完后让出工作线程，连接仍处于可读状态，下一轮事件循环继续读取 */
+			if(budget.Consume(rc))
+				break;
 		}
 		else if(rc == 0)
 		{
@@ -1119,66 +1384,172 @@ BOOL CTcpAgent::HandleReceive(const TDispContext* pContext, TAgentSocketObj* pSo
 		}
 	}
 
+	if(m_dwBusyPollTime > 0)
+		::SSO_QuickAck(pSocketObj->socket);
+
 	return TRUE;
 }
 
+EnHandleResult CTcpAgent::HandleReceived(const TDispContext* pContext, TAgentSocketObj* pSocketObj, const BYTE* pData, int iResult)
+{
+	ASSERT(TAgentSocketObj::IsValid(pSocketObj));
+
+	if(iResult == 0)
+	{
+		AddFreeSocketObj(pSocketObj, SCF_CLOSE, SO_RECEIVE, SE_OK);
+		return HR_ERROR;
+	}
+	else if(iResult < 0)
+	{
+		AddFreeSocketObj(pSocketObj, SCF_ERROR, SO_RECEIVE, -iResult);
+		return HR_ERROR;
+	}
+
+	/* 暂停接收期间由事件环保留数据，恢复接收后重新投递 */
+	if(pSocketObj->paused)
+		return HR_IGNORE;
+
+	if(m_bMarkSilence) pSocketObj->activeTime = ::TimeGetTime();
+
+	if(TRIGGER(FireReceive(pSocketObj, pData, iResult)) == HR_ERROR)
+	{
+		TRACE("<C-CNNID: %zu> OnReceive() event return 'HR_ERROR', connection will be closed !", pSocketObj->connID);
+
+		AddFreeSocketObj(pSocketObj, SCF_ERROR, SO_RECEIVE, ENSURE_ERROR_CANCELLED);
+		return HR_ERROR;
+	}
+
+	if(m_dwBusyPollTime > 0)
+		::SSO_QuickAck(pSocketObj->socket);
+
+	return HR_OK;
+}
+
 BOOL CTcpAgent::HandleSend(const TDispContext* pContext, TAgentSocketObj* pSocketObj, int flag)
 {
 	ASSERT(TAgentSocketObj::IsValid(pSocketObj));
 
-	if(!pSocketObj->IsPending())
+	/* 已提交的发送请求完成后再继续发送 */
+	if(pSocketObj->sending || !pSocketObj->IsPending())
 		return TRUE;
 
-	BOOL bBlocked	= FALSE;
-	int writes		= flag ? -1 : MAX_CONTINUE_WRITES;
+	BOOL bBlocked = FALSE;
+	TIoBudget budget(m_dwWriteBudget, m_dwIoTimeBudget, flag);
 
-	TBufferObjList& sndBuff = pSocketObj->sndBuff;
-	TItemPtr itPtr(sndBuff);
+	TItemList& lsItem = pSocketObj->sndItems;
 
-	for(int i = 0; i < writes || writes < 0; i++)
+	/* 发送到 Socket 阻塞、数据发送完毕或写入预算用完为止 */
+	while(TRUE)
 	{
-		{
-			CReentrantCriSecLock locallock(pSocketObj->csSend);
-			itPtr = sndBuff.PopFront();
-		}
+		/* 每轮不加锁取走生产者压入的全部数据；未发送完的数据留在 sndItems 中 */
+		if(!pSocketObj->DetachSendBuffer())
+			break;
 
-		if(!itPtr.IsValid())
+		if(!SendItems(pSocketObj, lsItem, bBlocked, budget))
+			return FALSE;
+
+		if(bBlocked)
 			break;
+	}
+
+	return CheckDrained(pSocketObj);
+}
+
+BOOL CTcpAgent::SendItems(TAgentSocketObj* pSocketObj, TItemList& lsItem, BOOL& bBlocked, TIoBudget& budget)
+{
+	int iZeroCopy = pSocketObj->zerocopy ? (int)m_dwZeroCopyThreshold : 0;
+
+	while(!lsItem.IsEmpty())
+	{
+		TItem* pFront = lsItem.Front();
+
+		if(pFront->IsFile())
+		{
+			int iPending = 0;
+			int rc		 = ::SendFileItem(pSocketObj->socket, pFront, iPending);
+
+			if(rc > 0)
+			{
+				pSocketObj->ReducePending(iPending);
+
+				if(pFront->IsEmpty())
+				{
+					pSocketObj->RecycleSentItem(lsItem.PopFront());
+
+					if(budget.Consume(iPending))
+					{
+						bBlocked = TRUE;
+						break;
+					}
+
+					continue;
+				}
 
-		ASSERT(!itPtr->IsEmpty());
+				/* 每次最多发送 MAX_SEND_FILE_CHUNK_SIZE 字节文件数据，然后让出工作线程处理其它连接 */
+				bBlocked = TRUE;
+				break;
+			}
 
-		if(!SendItem(pSocketObj, itPtr, bBlocked))
+			/* 文件长度小于发送范围（文件被截断） */
+			int code = (rc == 0) ? ERROR_NO_DATA : ::WSAGetLastError();
+
+			if(code == ERROR_WOULDBLOCK)
+			{
+				bBlocked = TRUE;
+				break;
+			}
+
+			AddFreeSocketObj(pSocketObj, SCF_ERROR, SO_SEND, code);
 			return FALSE;
+		}
 
-		if(bBlocked)
+		/* 完成模式：以 SQE 提交发送，数据块在发送完成前留在 sndItems 中 */
+		if(m_ioDispatcher.IsCompletionIo())
 		{
-			ASSERT(!itPtr->IsEmpty());
+			iovec vecs[MAX_SEND_IOV_COUNT];
+			int iCount = lsItem.GetIoVecs(vecs, MAX_SEND_IOV_COUNT);
 
-			CReentrantCriSecLock locallock(pSocketObj->csSend);
-			sndBuff.PushFront(itPtr.Detach());
+			if(!m_ioDispatcher.SubmitSend(pSocketObj->index, pSocketObj->socket, vecs, iCount))
+			{
+				AddFreeSocketObj(pSocketObj, SCF_ERROR, SO_SEND, ::WSAGetLastError());
+				return FALSE;
+			}
+
+			pSocketObj->sending = TRUE;
+			bBlocked			= TRUE;
 
 			break;
 		}
-	}
 
-	return TRUE;
-}
+		BOOL bZeroCopy	= (iZeroCopy > 0 && pFront->Size() >= iZeroCopy);
+		int rc			= SOCKET_ERROR;
 
-BOOL CTcpAgent::SendItem(TAgentSocketObj* pSocketObj, TItem* pItem, BOOL& bBlocked)
-{
-	while(!pItem->IsEmpty())
-	{
-		int rc = (int)write(pSocketObj->socket, pItem->Ptr(), pItem->Size());
+		if(bZeroCopy)
+		{
+			rc = ::SendZeroCopy(pSocketObj->socket, pFront->Ptr(), pFront->Size());
+
+			/* 超出 optmem 限制时退化为普通发送 */
+			if(rc == SOCKET_ERROR && ::WSAGetLastError() == ENOBUFS)
+				bZeroCopy = FALSE;
+			else if(rc > 0)
+				pFront->Pin(pSocketObj->zcSeq++);
+		}
+
+		if(!bZeroCopy)
+			rc = ::WriteItems(pSocketObj->socket, lsItem, iZeroCopy);
 
 		if(rc > 0)
 		{
-			if(TRIGGER(FireSend(pSocketObj, pItem->Ptr(), rc)) == HR_ERROR)
+			BOOL bExhausted = budget.Consume(rc);
+
+			ReduceSentItems(pSocketObj, lsItem, rc);
+
+			/* 写入预算用完后让出工作线程，剩余数据在下一轮事件循环中继续发送 */
+			if(bExhausted)
 			{
-				TRACE("<C-CNNID: %zu> OnSend() event should not return 'HR_ERROR' !!", pSocketObj->connID);
-				ASSERT(FALSE);
+				bBlocked = TRUE;
+				break;
 			}
-
-			pItem->Reduce(rc);
 		}
 		else if(rc == SOCKET_ERROR)
 		{
@@ -1202,6 +1573,31 @@ BOOL CTcpAgent::SendItem(TAgentSocketObj* pSocketObj, TItem* pItem, BOOL& bBlock
 	return TRUE;
 }
 
+VOID CTcpAgent::ReduceSentItems(TAgentSocketObj* pSocketObj, TItemList& lsItem, int iLength)
+{
+	pSocketObj->ReducePending(iLength);
+
+	while(iLength > 0)
+	{
+		TItem* pItem = lsItem.Front();
+		int iSent	 = MIN(iLength, pItem->Size());
+
+		if(TRIGGER(FireSend(pSocketObj, pItem->Ptr(), iSent)) == HR_ERROR)
+		{
+			TRACE("<C-CNNID: %zu> OnSend() event should not return 'HR_ERROR' !!", pSocketObj->connID);
+			ASSERT(FALSE);
+		}
+
+		iLength -= pItem->Reduce(iSent);
+
+		if(!pItem->IsEmpty())
+			continue;
+
+		/* 以 MSG_ZEROCOPY 发送过的数据块需等待内核完成通知后才能回收 */
+		pSocketObj->RecycleSentItem(lsItem.PopFront());
+	}
+}
+
 BOOL CTcpAgent::Send(CONNID dwConnID, const BYTE* pBuffer, int iLength, int iOffset)
 {
 	ASSERT(pBuffer && iLength > 0);
@@ -1215,7 +1611,7 @@ BOOL CTcpAgent::Send(CONNID dwConnID, const BYTE* pBuffer, int iLength, int iOff
 	return SendPackets(dwConnID, &buffer, 1);
 }
 
-BOOL CTcpAgent::DoSendPackets(CONNID dwConnID, const WSABUF pBuffers[], int iCount)
+BOOL CTcpAgent::DoSendPackets(CONNID dwConnID, const WSABUF pBuffers[], int iCount, Fn_SendBufferRelease fnRelease, PVOID pvArg)
 {
 	ASSERT(pBuffers && iCount > 0);
 
@@ -1223,14 +1619,22 @@ BOOL CTcpAgent::DoSendPackets(CONNID dwConnID, const WSABUF pBuffers[], int iCou
 
 	if(!TAgentSocketObj::IsValid(pSocketObj))
 	{
+		::InvokeSendBufferRelease(fnRelease, pvArg);
 		::SetLastError(ERROR_OBJECT_NOT_FOUND);
 		return FALSE;
 	}
 
-	return DoSendPackets(pSocketObj, pBuffers, iCount);
+	if(pSocketObj->highWater)
+	{
+		::InvokeSendBufferRelease(fnRelease, pvArg);
+		::SetLastError(ERROR_NOT_ENOUGH_QUOTA);
+		return FALSE;
+	}
+
+	return DoSendPackets(pSocketObj, pBuffers, iCount, fnRelease, pvArg);
 }
 
-BOOL CTcpAgent::DoSendPackets(TAgentSocketObj* pSocketObj, const WSABUF pBuffers[], int iCount)
+BOOL CTcpAgent::DoSendPackets(TAgentSocketObj* pSocketObj, const WSABUF pBuffers[], int iCount, Fn_SendBufferRelease fnRelease, PVOID pvArg)
 {
 	ASSERT(pSocketObj && pBuffers && iCount > 0);
 
@@ -1238,6 +1642,7 @@ BOOL CTcpAgent::DoSendPackets(TAgentSocketObj* pSocketObj, const WSABUF pBuffers
 
 	if(!pSocketObj->HasConnected())
 	{
+		::InvokeSendBufferRelease(fnRelease, pvArg);
 		::SetLastError(ERROR_INVALID_STATE);
 		return FALSE;
 	}
@@ -1245,15 +1650,21 @@ BOOL CTcpAgent::DoSendPackets(TAgentSocketObj* pSocketObj, const WSABUF pBuffers
 	if(pBuffers && iCount > 0)
 	{
 		CLocalSafeCounter localcounter(*pSocketObj);
-		CReentrantCriSecLock locallock(pSocketObj->csSend);
 
-		if(TAgentSocketObj::IsValid(pSocketObj))
-			result = SendInternal(pSocketObj, pBuffers, iCount);
+		/* 直接发送和合并发送需要在 csSend 保护下判断连接的发送状态；其它情况下生产者不加锁，把数据压入 sndQueue */
+		if(m_enSendPolicy == SP_DIRECT || pSocketObj->coalesce > 0)
+		{
+			CReentrantCriSecLock locallock(pSocketObj->csSend);
+			result = SendInternal(pSocketObj, pBuffers, iCount, fnRelease, pvArg);
+		}
 		else
-			result = ERROR_OBJECT_NOT_FOUND;
+			result = SendInternal(pSocketObj, pBuffers, iCount, fnRelease, pvArg);
 	}
 	else
+	{
 		result = ERROR_INVALID_PARAMETER;
+		::InvokeSendBufferRelease(fnRelease, pvArg);
+	}
 
 	if(result != NO_ERROR)
 		::SetLastError(result);
@@ -1261,33 +1672,206 @@ BOOL CTcpAgent::DoSendPackets(TAgentSocketObj* pSocketObj, const WSABUF pBuffers
 	return (result == NO_ERROR);
 }
 
-int CTcpAgent::SendInternal(TAgentSocketObj* pSocketObj, const WSABUF pBuffers[], int iCount)
+int CTcpAgent::SendInternal(TAgentSocketObj* pSocketObj, const WSABUF pBuffers[], int iCount, Fn_SendBufferRelease fnRelease, PVOID pvArg)
 {
-	BOOL bPending = pSocketObj->IsPending();
+	if(!TAgentSocketObj::IsValid(pSocketObj))
+	{
+		::InvokeSendBufferRelease(fnRelease, pvArg);
+		return ERROR_OBJECT_NOT_FOUND;
+	}
+
+	int iSent = 0;
+
+	/* 调用者持有 csSend 时才会直接发送 */
+	if(m_enSendPolicy == SP_DIRECT && !pSocketObj->IsPending() && pSocketObj->coalesce == 0)
+		iSent = SendDirect(pSocketObj, pBuffers, iCount);
+
+	BOOL bPending = PushSendBuffers(pSocketObj, pBuffers, iCount, iSent, fnRelease, pvArg);
+
+	return CommitSend(pSocketObj, bPending);
+}
+
+int CTcpAgent::SendFileInternal(TAgentSocketObj* pSocketObj, CFile& file, ULONGLONG ullOffset, ULONGLONG ullLength, const LPWSABUF pHead, const LPWSABUF pTail, Fn_SendBufferRelease fnComplete, PVOID pvArg)
+{
+	TBufferObjList lsBuff(m_bfObjPool);
+	::CatSendFile(lsBuff, file, ullOffset, ullLength, pHead, pTail, fnComplete, pvArg);
+
+	return CommitSend(pSocketObj, pSocketObj->PushSendItems(lsBuff), FALSE);
+}
+
+BOOL CTcpAgent::PushSendBuffers(TAgentSocketObj* pSocketObj, const WSABUF pBuffers[], int iCount, int iSkip, Fn_SendBufferRelease fnRelease, PVOID pvArg)
+{
+	int iLength = -iSkip;
 
 	for(int i = 0; i < iCount; i++)
+		iLength += (int)pBuffers[i].len;
+
+	/* 不需要释放函数的小数据直接复制到 sndQueue 当前的数据块中，多个生产者的小数据共用数据块 */
+	if(fnRelease == nullptr && iLength <= MAX_COMPACT_SEND_SIZE && pSocketObj->sndQueue.CanCopy(iLength))
+		return pSocketObj->PushSendCopy(pBuffers, iCount, iSkip, iLength);
+
+	TBufferObjList lsBuff(m_bfObjPool);
+	::CatSendBuffers(lsBuff, pBuffers, iCount, iSkip, fnRelease, pvArg);
+
+	return pSocketObj->PushSendItems(lsBuff);
+}
+
+int CTcpAgent::CommitSend(TAgentSocketObj* pSocketObj, BOOL bPending, BOOL bCoalesce)
+{
+	/* 连接已被关闭（关闭后 sndQueue 拒绝压入，已压入的数据由关闭时释放） */
+	if(!TAgentSocketObj::IsValid(pSocketObj))
+		return ERROR_OBJECT_NOT_FOUND;
+
+	CheckHighWater(pSocketObj);
+
+	/* 工作线程有待发送的数据时会取出新压入的数据一并发送，只有待发送数据从无到有或需要合并发送时才加锁通知工作线程 */
+	if(bPending && pSocketObj->coalesce == 0)
+		return NO_ERROR;
+
+	CReentrantCriSecLock locallock(pSocketObj->csSend);
+
+	if(bCoalesce && pSocketObj->coalesce > 0)
+		return CoalesceSend(pSocketObj, bPending);
+
+	return RequestSend(pSocketObj, bPending);
+}
+
+int CTcpAgent::RequestSend(TAgentSocketObj* pSocketObj, BOOL bPending)
+{
+	/* 暂存等待合并的数据尚未注册写事件 */
+	if(pSocketObj->held)
 	{
-		int iBufLen = pBuffers[i].len;
+		pSocketObj->held = FALSE;
+		bPending		 = FALSE;
+	}
 
-		if(iBufLen > 0)
+	if(!bPending && pSocketObj->IsPending())
+	{
+		/* 在连接所属的工作线程中调用时直接注册写事件，无需投递命令（刚迁入、尚未注册句柄的连接仍然投递命令）；
+		   正在处理该连接的 IO 事件时不注册写事件，由 OnAfterProcessIo() 直接发送 */
+		if(m_ioDispatcher.GetContextRefByIndex(pSocketObj->index).GetThreadId() == SELF_THREAD_ID && pSocketObj->armed != 0)
 		{
-			BYTE* pBuffer = (BYTE*)pBuffers[i].buf;
-			ASSERT(pBuffer);
+			if(pSocketObj->processing || pSocketObj->sending)
+				return NO_ERROR;
 
-			pSocketObj->sndBuff.Cat(pBuffer, iBufLen);
-			ASSERT(pSocketObj->sndBuff.Length() > 0);
+			UINT evts = EPOLLOUT | (pSocketObj->IsPaused() ? 0 : EPOLLIN);
+			m_ioDispatcher.ModFD(pSocketObj->index, pSocketObj->socket, evts | EPOLLRDHUP, pSocketObj, pSocketObj->armed);
 		}
+		else if(!SendCommand(pSocketObj, DISP_CMD_SEND))
+			return ::GetLastError();
 	}
 
-	if(!bPending && pSocketObj->IsPending())
+	return NO_ERROR;
+}
+
+int CTcpAgent::CoalesceSend(TAgentSocketObj* pSocketObj, BOOL bPending)
+{
+	/* 工作线程正在发送时，新数据随之发送 */
+	if(!pSocketObj->held && bPending)
+		return NO_ERROR;
+
+	if(pSocketObj->Pending() >= (int)pSocketObj->coalesce)
+		return RequestSend(pSocketObj, FALSE);
+
+	if(!pSocketObj->held)
 	{
-		if(!m_ioDispatcher.SendCommandByFD(pSocketObj->socket, DISP_CMD_SEND, pSocketObj->connID))
-			return ::GetLastError();
+		/* 延迟为 0 时只在达到阈值或调用 Flush() 时发送 */
+		if(m_dwCoalesceDelay > 0 && !m_ioDispatcher.SetTimer(pSocketObj->index, &pSocketObj->timer, m_dwCoalesceDelay))
+			return RequestSend(pSocketObj, FALSE);
+
+		pSocketObj->held = TRUE;
 	}
 
 	return NO_ERROR;
 }
 
+void CTcpAgent::CheckHighWater(TAgentSocketObj* pSocketObj)
+{
+	if(m_dwSendHighWatermark == 0 || pSocketObj->highWater || pSocketObj->Pending() < (int)m_dwSendHighWatermark)
+		return;
+
+	/* 达到高水位时才加锁，保证只投递一次命令 */
+	CReentrantCriSecLock locallock(pSocketObj->csSend);
+
+	if(pSocketObj->highWater)
+		return;
+
+	/* 由工作线程触发 OnSendBufferHigh 事件，此后的发送请求均失败，直到缓冲区回落到低水位 */
+	pSocketObj->highWater = TRUE;
+
+	VERIFY(SendCommand(pSocketObj, DISP_CMD_HIGH_WATER));
+}
+
+BOOL CTcpAgent::SendCommand(TAgentSocketObj* pSocketObj, USHORT usType, UINT_PTR lParam)
+{
+	/* 在 csSend 保护下读取连接所属工作线程并投递命令，避免与连接迁移交错（迁移前须等待已投递的命令执行完毕） */
+	CReentrantCriSecLock locallock(pSocketObj->csSend);
+
+	++pSocketObj->commands;
+
+	if(m_ioDispatcher.SendCommandByIndex(pSocketObj->index, usType, pSocketObj->connID, lParam))
+		return TRUE;
+
+	--pSocketObj->commands;
+
+	return FALSE;
+}
+
+BOOL CTcpAgent::CheckDrained(TAgentSocketObj* pSocketObj)
+{
+	if(!pSocketObj->highNotified)
+		return TRUE;
+
+	int iPending = 0;
+
+	{
+		CReentrantCriSecLock locallock(pSocketObj->csSend);
+
+		iPending = pSocketObj->Pending();
+
+		if(iPending > (int)m_dwSendLowWatermark)
+			return TRUE;
+
+		pSocketObj->highWater	 = FALSE;
+		pSocketObj->highNotified = FALSE;
+	}
+
+	if(TRIGGER(FireSendBufferDrained(pSocketObj, iPending)) == HR_ERROR)
+	{
+		TRACE("<C-CNNID: %zu> OnSendBufferDrained() event return 'HR_ERROR', connection will be closed !", pSocketObj->connID);
+
+		AddFreeSocketObj(pSocketObj, SCF_ERROR, SO_SEND, ENSURE_ERROR_CANCELLED);
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+int CTcpAgent::SendDirect(TAgentSocketObj* pSocketObj, const WSABUF pBuffers[], int iCount)
+{
+	int rc = ::WriteBuffers(pSocketObj->socket, pBuffers, iCount);
+
+	/* 发送失败时缓存全部数据，由工作线程继续发送或处理错误 */
+	if(rc <= 0)
+		return 0;
+
+	/* 直接发送的数据在调用线程中触发 OnSend 事件（调用者持有 csSend） */
+	for(int i = 0, remain = rc; remain > 0; i++)
+	{
+		int iSent = MIN(remain, (int)pBuffers[i].len);
+
+		if(iSent > 0 && TRIGGER(FireSend(pSocketObj, (BYTE*)pBuffers[i].buf, iSent)) == HR_ERROR)
+		{
+			TRACE("<C-CNNID: %zu> OnSend() event should not return 'HR_ERROR' !!", pSocketObj->connID);
+			ASSERT(FALSE);
+		}
+
+		remain -= iSent;
+	}
+
+	return rc;
+}
+
 BOOL CTcpAgent::SendSmallFile(CONNID dwConnID, LPCTSTR lpszFileName, const LPWSABUF pHead, const LPWSABUF pTail)
 {
 	CFile file;
@@ -1304,3 +1888,89 @@ BOOL CTcpAgent::SendSmallFile(CONNID dwConnID, LPCTSTR lpszFileName, const LPWSA
 
 	return SendPackets(dwConnID, szBuf, 3);
 }
+
+BOOL CTcpAgent::SendFile(CONNID dwConnID, LPCTSTR lpszFileName, ULONGLONG ullOffset, ULONGLONG ullLength, const LPWSABUF pHead, const LPWSABUF pTail, Fn_SendBufferRelease fnComplete, PVOID pvArg)
+{
+	CFile file;
+	HRESULT hr = ::OpenSendFile(lpszFileName, file, ullOffset, ullLength);
+
+	if(FAILED(hr))
+	{
+		::InvokeSendBufferRelease(fnComplete, pvArg);
+		::SetLastError(hr);
+
+		return FALSE;
+	}
+
+	return DoSendFile(dwConnID, file, ullOffset, ullLength, pHead, pTail, fnComplete, pvArg);
+}
+
+BOOL CTcpAgent::DoSendFile(CONNID dwConnID, CFile& file, ULONGLONG ullOffset, ULONGLONG ullLength, const LPWSABUF pHead, const LPWSABUF pTail, Fn_SendBufferRelease fnComplete, PVOID pvArg)
+{
+	/* 需要对发送数据进行加密的连接不能通过 sendfile() 直接发送文件 */
+	if(IsSecure())
+		return SendFileByPackets(dwConnID, file, ullOffset, ullLength, pHead, pTail, fnComplete, pvArg);
+
+	int result = NO_ERROR;
+	TAgentSocketObj* pSocketObj = FindSocketObj(dwConnID);
+
+	if(!TAgentSocketObj::IsValid(pSocketObj))
+		result = ERROR_OBJECT_NOT_FOUND;
+	else if(!pSocketObj->HasConnected())
+		result = ERROR_INVALID_STATE;
+	else if(pSocketObj->highWater)
+		result = ERROR_NOT_ENOUGH_QUOTA;
+	else
+	{
+		CLocalSafeCounter localcounter(*pSocketObj);
+
+		if(m_enSendPolicy == SP_DIRECT || pSocketObj->coalesce > 0)
+		{
+			CReentrantCriSecLock locallock(pSocketObj->csSend);
+			result = SendFileInternal(pSocketObj, file, ullOffset, ullLength, pHead, pTail, fnComplete, pvArg);
+		}
+		else
+			result = SendFileInternal(pSocketObj, file, ullOffset, ullLength, pHead, pTail, fnComplete, pvArg);
+
+		if(result != NO_ERROR)
+			::SetLastError(result);
+
+		return (result == NO_ERROR);
+	}
+
+	::InvokeSendBufferRelease(fnComplete, pvArg);
+	::SetLastError(result);
+
+	return FALSE;
+}
+
+BOOL CTcpAgent::SendFileByPackets(CONNID dwConnID, CFile& file, ULONGLONG ullOffset, ULONGLONG ullLength, const LPWSABUF pHead, const LPWSABUF pTail, Fn_SendBufferRelease fnComplete, PVOID pvArg)
+{
+	CBufferPtr buffer;
+	HRESULT hr = ::ReadSendFile(file, ullOffset, ullLength, buffer);
+	BOOL isOK  = FALSE;
+
+	if(SUCCEEDED(hr))
+	{
+		WSABUF szBuf[3];
+
+		szBuf[1].len = (UINT)buffer.Size();
+		szBuf[1].buf = buffer.Ptr();
+
+		if(pHead) memcpy(&szBuf[0], pHead, sizeof(WSABUF));
+		else	  memset(&szBuf[0], 0, sizeof(WSABUF));
+
+		if(pTail) memcpy(&szBuf[2], pTail, sizeof(WSABUF));
+		else	  memset(&szBuf[2], 0, sizeof(WSABUF));
+
+		isOK = SendPackets(dwConnID, szBuf, 3);
+	}
+
+	/* 文件数据已复制到发送缓冲区 */
+	::InvokeSendBufferRelease(fnComplete, pvArg);
+
+	if(FAILED(hr))
+		::SetLastError(hr);
+
+	return isOK;
+}
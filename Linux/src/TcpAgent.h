@@ -35,8 +35,13 @@ public:
 	virtual BOOL Connect(LPCTSTR lpszRemoteAddress, USHORT usPort, CONNID* pdwConnID = nullptr, PVOID pExtra = nullptr, USHORT usLocalPort = 0, LPCTSTR lpszLocalAddress = nullptr);
 	virtual BOOL Send	(CONNID dwConnID, const BYTE* pBuffer, int iLength, int iOffset = 0);
 	virtual BOOL SendSmallFile	(CONNID dwConnID, LPCTSTR lpszFileName, const LPWSABUF pHead = nullptr, const LPWSABUF pTail = nullptr);
+	virtual BOOL SendFile		(CONNID dwConnID, LPCTSTR lpszFileName, ULONGLONG ullOffset = 0, ULONGLONG ullLength = 0, const LPWSABUF pHead = nullptr, const LPWSABUF pTail = nullptr, Fn_SendBufferRelease fnComplete = nullptr, PVOID pvArg = nullptr);
 	virtual BOOL SendPackets	(CONNID dwConnID, const WSABUF pBuffers[], int iCount)	{return DoSendPackets(dwConnID, pBuffers, iCount);}
+	virtual BOOL SendRefPackets	(CONNID dwConnID, const WSABUF pBuffers[], int iCount, Fn_SendBufferRelease fnRelease, PVOID pvArg = nullptr)
+		{return DoSendPackets(dwConnID, pBuffers, iCount, fnRelease, pvArg);}
+	virtual BOOL Flush			(CONNID dwConnID);
 	virtual BOOL PauseReceive	(CONNID dwConnID, BOOL bPause = TRUE);
+	virtual BOOL Post			(CONNID dwConnID, Fn_ConnTaskProc fnProc, PVOID pvArg);
 	virtual BOOL Wait			(DWORD dwMilliseconds = INFINITE) {return m_evWait.WaitFor(dwMilliseconds, WAIT_FOR_STOP_PREDICATE);}
 	virtual BOOL			HasStarted					()	{return m_enState == SS_STARTED || m_enState == SS_STARTING;}
 	virtual EnServiceState	GetState					()	{return m_enState;}
@@ -52,6 +57,7 @@ public:
 	virtual BOOL GetPendingDataLength	(CONNID dwConnID, int& iPending);
 	virtual DWORD GetConnectionCount	();
 	virtual BOOL GetAllConnectionIDs	(CONNID pIDs[], DWORD& dwCount);
+	virtual BOOL GetWorkerStats			(TWorkerStats pStats[], DWORD& dwCount)	{return m_ioDispatcher.GetStats(pStats, dwCount);}
 	virtual BOOL GetConnectPeriod		(CONNID dwConnID, DWORD& dwPeriod);
 	virtual BOOL GetSilencePeriod		(CONNID dwConnID, DWORD& dwPeriod);
 	virtual EnSocketError GetLastError	()	{return m_enLastError;}
@@ -77,10 +83,15 @@ private:
 	virtual BOOL OnBeforeProcessIo(const TDispContext* pContext, PVOID pv, UINT events)			override;
 	virtual VOID OnAfterProcessIo(const TDispContext* pContext, PVOID pv, UINT events, BOOL rs)	override;
 	virtual VOID OnCommand(const TDispContext* pContext, TDispCommand* pCmd)					override;
+	virtual VOID OnDropCommand(TDispCommand* pCmd)												override;
+	virtual BOOL OnMigrate(const TDispContext* pContext, PVOID pv, int iTarget)					override;
 	virtual BOOL OnReadyRead(const TDispContext* pContext, PVOID pv, UINT events)				override;
 	virtual BOOL OnReadyWrite(const TDispContext* pContext, PVOID pv, UINT events)				override;
+	virtual EnHandleResult OnReceiveComplete(const TDispContext* pContext, PVOID pv, const BYTE* pData, int iResult)	override;
+	virtual BOOL OnSendComplete(const TDispContext* pContext, PVOID pv, int iResult)			override;
 	virtual BOOL OnHungUp(const TDispContext* pContext, PVOID pv, UINT events)					override;
 	virtual BOOL OnError(const TDispContext* pContext, PVOID pv, UINT events)					override;
+	virtual BOOL OnErrorQueue(const TDispContext* pContext, PVOID pv, UINT events)				override;
 	virtual VOID OnDispatchThreadStart(THR_ID tid)												override;
 	virtual VOID OnDispatchThreadEnd(THR_ID tid)												override;
 
@@ -89,9 +100,10 @@ public:
 
 	virtual BOOL SetConnectionExtra(CONNID dwConnID, PVOID pExtra);
 	virtual BOOL GetConnectionExtra(CONNID dwConnID, PVOID* ppExtra);
+	virtual BOOL SetConnectionCoalesceSize(CONNID dwConnID, DWORD dwCoalesceSize);
 
 	virtual void SetReuseAddressPolicy		(EnReuseAddressPolicy enReusePolicy)	{ENSURE_HAS_STOPPED(); m_enReusePolicy		= enReusePolicy;}
-	virtual void SetSendPolicy				(EnSendPolicy enSendPolicy)				{ENSURE_HAS_STOPPED(); ASSERT(m_enSendPolicy == enSendPolicy);}
+	virtual void SetSendPolicy				(EnSendPolicy enSendPolicy)				{ENSURE_HAS_STOPPED(); m_enSendPolicy				= enSendPolicy;}
 	virtual void SetOnSendSyncPolicy		(EnOnSendSyncPolicy enOnSendSyncPolicy)	{ENSURE_HAS_STOPPED(); ASSERT(m_enOnSendSyncPolicy == enOnSendSyncPolicy);}
 	virtual void SetSyncConnectTimeout		(DWORD dwSyncConnectTimeout)	{ENSURE_HAS_STOPPED(); m_dwSyncConnectTimeout		= dwSyncConnectTimeout;}
 	virtual void SetMaxConnectionCount		(DWORD dwMaxConnectionCount)	{ENSURE_HAS_STOPPED(); m_dwMaxConnectionCount		= dwMaxConnectionCount;}
@@ -105,7 +117,20 @@ public:
 	virtual void SetKeepAliveTime			(DWORD dwKeepAliveTime)			{ENSURE_HAS_STOPPED(); m_dwKeepAliveTime			= dwKeepAliveTime;}
 	virtual void SetKeepAliveInterval		(DWORD dwKeepAliveInterval)		{ENSURE_HAS_STOPPED(); m_dwKeepAliveInterval		= dwKeepAliveInterval;}
 	virtual void SetMarkSilence				(BOOL bMarkSilence)				{ENSURE_HAS_STOPPED(); m_bMarkSilence				= bMarkSilence;}
+	virtual void SetCpuAffinity				(EnCpuAffinityPolicy enPolicy, LPCTSTR lpszCpuList = nullptr)	{ENSURE_HAS_STOPPED(); m_enCpuAffinityPolicy = enPolicy; m_strCpuAffinityList = (lpszCpuList ? lpszCpuList : _T(""));}
 	virtual void SetNoDelay					(BOOL bNoDelay)					{ENSURE_HAS_STOPPED(); m_bNoDelay					= bNoDelay;}
+	virtual void SetUseIOUring				(BOOL bUseIOUring)				{ENSURE_HAS_STOPPED(); m_bUseIOUring				= bUseIOUring;}
+	virtual void SetBusyPollTime			(DWORD dwBusyPollTime)			{ENSURE_HAS_STOPPED(); m_dwBusyPollTime				= dwBusyPollTime;}
+	virtual void SetRebalanceThreshold		(DWORD dwRebalanceThreshold)	{ENSURE_HAS_STOPPED(); m_dwRebalanceThreshold		= dwRebalanceThreshold;}
+	virtual void SetZeroCopyThreshold		(DWORD dwZeroCopyThreshold)		{ENSURE_HAS_STOPPED(); m_dwZeroCopyThreshold		= dwZeroCopyThreshold;}
+	virtual void SetCoalesceSize			(DWORD dwCoalesceSize)			{ENSURE_HAS_STOPPED(); m_dwCoalesceSize				= dwCoalesceSize;}
+	virtual void SetCoalesceDelay			(DWORD dwCoalesceDelay)			{ENSURE_HAS_STOPPED(); m_dwCoalesceDelay			= dwCoalesceDelay;}
+	virtual void SetSendHighWatermark		(DWORD dwSendHighWatermark)		{ENSURE_HAS_STOPPED(); m_dwSendHighWatermark		= dwSendHighWatermark;}
+	virtual void SetSendLowWatermark		(DWORD dwSendLowWatermark)		{ENSURE_HAS_STOPPED(); m_dwSendLowWatermark			= dwSendLowWatermark;}
+	virtual void SetNotSentLowat			(DWORD dwNotSentLowat)			{ENSURE_HAS_STOPPED(); m_dwNotSentLowat				= dwNotSentLowat;}
+	virtual void SetReadBudget				(DWORD dwReadBudget)			{ENSURE_HAS_STOPPED(); m_dwReadBudget				= dwReadBudget; m_bReadBudgetSet = TRUE;}
+	virtual void SetWriteBudget				(DWORD dwWriteBudget)			{ENSURE_HAS_STOPPED(); m_dwWriteBudget				= dwWriteBudget;}
+	virtual void SetIoTimeBudget			(DWORD dwIoTimeBudget)			{ENSURE_HAS_STOPPED(); m_dwIoTimeBudget				= dwIoTimeBudget;}
 
 	virtual EnReuseAddressPolicy GetReuseAddressPolicy	()	{return m_enReusePolicy;}
 	virtual EnSendPolicy GetSendPolicy					()	{return m_enSendPolicy;}
@@ -122,7 +147,21 @@ public:
 	virtual DWORD GetKeepAliveTime			()	{return m_dwKeepAliveTime;}
 	virtual DWORD GetKeepAliveInterval		()	{return m_dwKeepAliveInterval;}
 	virtual BOOL  IsMarkSilence				()	{return m_bMarkSilence;}
+	virtual EnCpuAffinityPolicy GetCpuAffinityPolicy	()	{return m_enCpuAffinityPolicy;}
+	virtual LPCTSTR GetCpuAffinityList					()	{return m_strCpuAffinityList;}
 	virtual BOOL  IsNoDelay					()	{return m_bNoDelay;}
+	virtual BOOL  IsUseIOUring				()	{return m_bUseIOUring;}
+	virtual DWORD GetBusyPollTime			()	{return m_dwBusyPollTime;}
+	virtual DWORD GetRebalanceThreshold		()	{return m_dwRebalanceThreshold;}
+	virtual DWORD GetZeroCopyThreshold		()	{return m_dwZeroCopyThreshold;}
+	virtual DWORD GetCoalesceSize			()	{return m_dwCoalesceSize;}
+	virtual DWORD GetCoalesceDelay			()	{return m_dwCoalesceDelay;}
+	virtual DWORD GetSendHighWatermark		()	{return m_dwSendHighWatermark;}
+	virtual DWORD GetSendLowWatermark		()	{return m_dwSendLowWatermark;}
+	virtual DWORD GetNotSentLowat			()	{return m_dwNotSentLowat;}
+	virtual DWORD GetReadBudget				()	{return m_bReadBudgetSet ? m_dwReadBudget : ::GetDefaultReadBudget(m_dwSocketBufferSize);}
+	virtual DWORD GetWriteBudget			()	{return m_dwWriteBudget;}
+	virtual DWORD GetIoTimeBudget			()	{return m_dwIoTimeBudget;}
 
 protected:
 	virtual EnHandleResult FirePrepareConnect(CONNID dwConnID, SOCKET socket)
@@ -139,8 +178,14 @@ protected:
 		{return DoFireReceive(pSocketObj, pData, iLength);}
 	virtual EnHandleResult FireReceive(TAgentSocketObj* pSocketObj, int iLength)
 		{return DoFireReceive(pSocketObj, iLength);}
+	virtual EnHandleResult FireDirectReceive(TAgentSocketObj* pSocketObj, TBuffer* pBuffer, int iLength)
+		{return DoFireDirectReceive(pSocketObj, pBuffer, iLength);}
 	virtual EnHandleResult FireSend(TAgentSocketObj* pSocketObj, const BYTE* pData, int iLength)
 		{return DoFireSend(pSocketObj, pData, iLength);}
+	virtual EnHandleResult FireSendBufferHigh(TAgentSocketObj* pSocketObj, int iPending)
+		{return DoFireSendBufferHigh(pSocketObj, iPending);}
+	virtual EnHandleResult FireSendBufferDrained(TAgentSocketObj* pSocketObj, int iPending)
+		{return DoFireSendBufferDrained(pSocketObj, iPending);}
 	virtual EnHandleResult FireClose(TAgentSocketObj* pSocketObj, EnSocketOperation enOperation, int iErrorCode)
 		{return DoFireClose(pSocketObj, enOperation, iErrorCode);}
 	virtual EnHandleResult FireShutdown()
@@ -156,8 +201,16 @@ protected:
 		{return m_pListener->OnReceive(this, pSocketObj->connID, pData, iLength);}
 	virtual EnHandleResult DoFireReceive(TAgentSocketObj* pSocketObj, int iLength)
 		{return m_pListener->OnReceive(this, pSocketObj->connID, iLength);}
+	virtual EnHandleResult DoFireReceiveBatch(TAgentSocketObj* pSocketObj, const WSABUF pFrames[], int iCount)
+		{return m_pListener->OnReceiveBatch(this, pSocketObj->connID, pFrames, iCount);}
+	virtual EnHandleResult DoFireDirectReceive(TAgentSocketObj* pSocketObj, TBuffer* pBuffer, int iLength)
+		{return DoFireReceive(pSocketObj, pBuffer->Length());}
 	virtual EnHandleResult DoFireSend(TAgentSocketObj* pSocketObj, const BYTE* pData, int iLength)
 		{return m_pListener->OnSend(this, pSocketObj->connID, pData, iLength);}
+	virtual EnHandleResult DoFireSendBufferHigh(TAgentSocketObj* pSocketObj, int iPending)
+		{return m_pListener->OnSendBufferHigh(this, pSocketObj->connID, iPending);}
+	virtual EnHandleResult DoFireSendBufferDrained(TAgentSocketObj* pSocketObj, int iPending)
+		{return m_pListener->OnSendBufferDrained(this, pSocketObj->connID, iPending);}
 	virtual EnHandleResult DoFireClose(TAgentSocketObj* pSocketObj, EnSocketOperation enOperation, int iErrorCode)
 		{return m_pListener->OnClose(this, pSocketObj->connID, enOperation, iErrorCode);}
 	virtual EnHandleResult DoFireShutdown()
@@ -169,14 +222,18 @@ protected:
 	virtual void Reset();
 
 	virtual BOOL BeforeUnpause(TAgentSocketObj* pSocketObj) {return TRUE;}
+	/* 返回连接的接收缓冲区则把数据直接读取到该缓冲区并触发 FireDirectReceive()，返回 nullptr 则读取到工作线程接收缓冲区 */
+	virtual TBuffer* GetDirectReceiveBuffer(TAgentSocketObj* pSocketObj) {return nullptr;}
 
 	virtual void OnWorkerThreadStart(THR_ID tid) {}
 	virtual void OnWorkerThreadEnd(THR_ID tid) {}
 
 	virtual void ReleaseGCSocketObj(BOOL bForce = FALSE);
 
-	BOOL DoSendPackets(CONNID dwConnID, const WSABUF pBuffers[], int iCount);
-	BOOL DoSendPackets(TAgentSocketObj* pSocketObj, const WSABUF pBuffers[], int iCount);
+	BOOL DoSendPackets(CONNID dwConnID, const WSABUF pBuffers[], int iCount, Fn_SendBufferRelease fnRelease = nullptr, PVOID pvArg = nullptr);
+	BOOL DoSendPackets(TAgentSocketObj* pSocketObj, const WSABUF pBuffers[], int iCount, Fn_SendBufferRelease fnRelease = nullptr, PVOID pvArg = nullptr);
+	virtual BOOL DoSendFile(CONNID dwConnID, CFile& file, ULONGLONG ullOffset, ULONGLONG ullLength, const LPWSABUF pHead, const LPWSABUF pTail, Fn_SendBufferRelease fnComplete, PVOID pvArg);
+	BOOL SendFileByPackets(CONNID dwConnID, CFile& file, ULONGLONG ullOffset, ULONGLONG ullLength, const LPWSABUF pHead, const LPWSABUF pTail, Fn_SendBufferRelease fnComplete, PVOID pvArg);
 	TAgentSocketObj* FindSocketObj(CONNID dwConnID);
 	BOOL GetRemoteHost(CONNID dwConnID, LPCSTR* lpszHost, USHORT* pusPort = nullptr);
 
@@ -220,13 +277,30 @@ private:
 	VOID HandleCmdSend		(const TDispContext* pContext, CONNID dwConnID);
 	VOID HandleCmdUnpause	(const TDispContext* pContext, CONNID dwConnID);
 	VOID HandleCmdDisconnect(const TDispContext* pContext, CONNID dwConnID, BOOL bForce);
+	VOID HandleCmdMigrate	(const TDispContext* pContext, CONNID dwConnID);
+	VOID HandleCmdPost		(const TDispContext* pContext, CONNID dwConnID, TConnTask* pTask);
+	VOID HandleCmdHighWater	(const TDispContext* pContext, CONNID dwConnID);
 	BOOL HandleConnect		(const TDispContext* pContext, TAgentSocketObj* pSocketObj, UINT events);
 	BOOL HandleReceive		(const TDispContext* pContext, TAgentSocketObj* pSocketObj, int flag);
+	EnHandleResult HandleReceived(const TDispContext* pContext, TAgentSocketObj* pSocketObj, const BYTE* pData, int iResult);
 	BOOL HandleSend			(const TDispContext* pContext, TAgentSocketObj* pSocketObj, int flag);
 	BOOL HandleClose		(const TDispContext* pContext, TAgentSocketObj* pSocketObj, EnSocketCloseFlag enFlag, UINT events);
 
-	int SendInternal	(TAgentSocketObj* pSocketObj, const WSABUF pBuffers[], int iCount);
-	BOOL SendItem		(TAgentSocketObj* pSocketObj, TItem* pItem, BOOL& bBlocked);
+	int SendInternal	(TAgentSocketObj* pSocketObj, const WSABUF pBuffers[], int iCount, Fn_SendBufferRelease fnRelease, PVOID pvArg);
+	int SendDirect		(TAgentSocketObj* pSocketObj, const WSABUF pBuffers[], int iCount);
+	int SendFileInternal(TAgentSocketObj* pSocketObj, CFile& file, ULONGLONG ullOffset, ULONGLONG ullLength, const LPWSABUF pHead, const LPWSABUF pTail, Fn_SendBufferRelease fnComplete, PVOID pvArg);
+	BOOL PushSendBuffers(TAgentSocketObj* pSocketObj, const WSABUF pBuffers[], int iCount, int iSkip, Fn_SendBufferRelease fnRelease, PVOID pvArg);
+	int CommitSend		(TAgentSocketObj* pSocketObj, BOOL bPending, BOOL bCoalesce = TRUE);
+	int RequestSend		(TAgentSocketObj* pSocketObj, BOOL bPending);
+	int CoalesceSend	(TAgentSocketObj* pSocketObj, BOOL bPending);
+	BOOL FlushInternal	(TAgentSocketObj* pSocketObj);
+	void CheckHighWater	(TAgentSocketObj* pSocketObj);
+	BOOL SendCommand	(TAgentSocketObj* pSocketObj, USHORT usType, UINT_PTR lParam = 0);
+	BOOL CheckDrained	(TAgentSocketObj* pSocketObj);
+	BOOL SendItems		(TAgentSocketObj* pSocketObj, TItemList& lsItem, BOOL& bBlocked, TIoBudget& budget);
+	VOID ReduceSentItems(TAgentSocketObj* pSocketObj, TItemList& lsItem, int iLength);
+
+	static void FlushCoalesced(PVOID pv);
 
 public:
 	CTcpAgent(ITcpAgentListener* pListener)
@@ -250,7 +324,21 @@ public:
 	, m_dwKeepAliveTime			(DEFALUT_TCP_KEEPALIVE_TIME)
 	, m_dwKeepAliveInterval		(DEFALUT_TCP_KEEPALIVE_INTERVAL)
 	, m_bMarkSilence			(TRUE)
+	, m_enCpuAffinityPolicy		(CAP_NONE)
 	, m_bNoDelay				(FALSE)
+	, m_bUseIOUring				(FALSE)
+	, m_dwBusyPollTime			(0)
+	, m_dwRebalanceThreshold	(0)
+	, m_dwZeroCopyThreshold		(0)
+	, m_dwCoalesceSize			(0)
+	, m_dwCoalesceDelay			(DEFAULT_TCP_COALESCE_DELAY)
+	, m_dwSendHighWatermark		(0)
+	, m_dwSendLowWatermark		(0)
+	, m_dwNotSentLowat			(0)
+	, m_dwReadBudget			(0)
+	, m_bReadBudgetSet			(FALSE)
+	, m_dwWriteBudget			(0)
+	, m_dwIoTimeBudget			(0)
 	, m_soAddr					(AF_UNSPEC, TRUE)
 	{
 		ASSERT(m_pListener);
@@ -277,7 +365,23 @@ private:
 	DWORD m_dwKeepAliveTime;
 	DWORD m_dwKeepAliveInterval;
 	BOOL  m_bMarkSilence;
+	EnCpuAffinityPolicy m_enCpuAffinityPolicy;
+	CString m_strCpuAffinityList;
+	vector<int> m_vtCpus;
 	BOOL  m_bNoDelay;
+	BOOL  m_bUseIOUring;
+	DWORD m_dwBusyPollTime;
+	DWORD m_dwRebalanceThreshold;
+	DWORD m_dwZeroCopyThreshold;
+	DWORD m_dwCoalesceSize;
+	DWORD m_dwCoalesceDelay;
+	DWORD m_dwSendHighWatermark;
+	DWORD m_dwSendLowWatermark;
+	DWORD m_dwNotSentLowat;
+	DWORD m_dwReadBudget;
+	BOOL  m_bReadBudgetSet;
+	DWORD m_dwWriteBudget;
+	DWORD m_dwIoTimeBudget;
 
 private:
 	CSEM					m_evWait;
@@ -516,30 +516,35 @@ BOOL CTcpClient::PauseReceive(BOOL bPause)
 BOOL CTcpClient::SendData()
 {
 	BOOL bBlocked = FALSE;
+	TItemList lsItem(m_itPool);
 
 	while(m_lsSend.Length() > 0)
 	{
-		TItemPtr itPtr(m_itPool);
-
 		{
 			CCriSecLock locallock(m_csSend);
-			itPtr = m_lsSend.PopFront();
+
+			while(lsItem.Size() < MAX_SEND_IOV_COUNT && !m_lsSend.IsEmpty())
+				lsItem.PushBack(m_lsSend.PopFront());
 		}
 
-		if(!itPtr.IsValid())
+		if(lsItem.IsEmpty())
 			break;
 
-		ASSERT(!itPtr->IsEmpty());
-
-		if(!DoSendData(itPtr, bBlocked))
+		if(!DoSendData(lsItem, bBlocked))
+		{
+			lsItem.Release();
 			return FALSE;
+		}
 
 		if(bBlocked)
 		{
-			ASSERT(!itPtr->IsEmpty());
+			ASSERT(!lsItem.IsEmpty());
 
 			CCriSecLock locallock(m_csSend);
-			m_lsSend.PushFront(itPtr.Detach());
+
+			while(!lsItem.IsEmpty())
+				m_lsSend.PushFront(lsItem.PopBack());
+
 			break;
 		}
 	}
@@ -547,21 +552,30 @@ BOOL CTcpClient::SendData()
 	return TRUE;
 }
 
-BOOL CTcpClient::DoSendData(TItem* pItem, BOOL& bBlocked)
+BOOL CTcpClient::DoSendData(TItemList& lsItem, BOOL& bBlocked)
 {
-	while(!pItem->IsEmpty())
+	while(!lsItem.IsEmpty())
 	{
-		int rc = (int)write(m_soClient, (char*)pItem->Ptr(), pItem->Size());
+		int rc = ::WriteItems(m_soClient, lsItem);
 
 		if(rc > 0)
 		{
-			if(TRIGGER(FireSend(pItem->Ptr(), rc)) == HR_ERROR)
+			while(rc > 0)
 			{
-				TRACE("<C-CNNID: %zu> OnSend() event should not return 'HR_ERROR' !!", m_dwConnID);
-				ASSERT(FALSE);
-			}
+				TItem* pItem = lsItem.Front();
+				int iSent	 = MIN(rc, pItem->Size());
+
+				if(TRIGGER(FireSend(pItem->Ptr(), iSent)) == HR_ERROR)
+				{
+					TRACE("<C-CNNID: %zu> OnSend() event should not return 'HR_ERROR' !!", m_dwConnID);
+					ASSERT(FALSE);
+				}
 
-			pItem->Reduce(rc);
+				rc -= pItem->Reduce(iSent);
+
+				if(pItem->IsEmpty())
+					m_itPool.PutFreeItem(lsItem.PopFront());
+			}
 		}
 		else if(rc == SOCKET_ERROR)
 		{
@@ -598,7 +612,7 @@ BOOL CTcpClient::Send(const BYTE* pBuffer, int iLength, int iOffset)
 	return SendPackets(&buffer, 1);
 }
 
-BOOL CTcpClient::DoSendPackets(const WSABUF pBuffers[], int iCount)
+BOOL CTcpClient::DoSendPackets(const WSABUF pBuffers[], int iCount, Fn_SendBufferRelease fnRelease, PVOID pvArg)
 {
 	ASSERT(pBuffers && iCount > 0);
 
@@ -611,7 +625,7 @@ BOOL CTcpClient::DoSendPackets(const WSABUF pBuffers[], int iCount)
 			CCriSecLock locallock(m_csSend);
 
 			if(IsConnected())
-				result = SendInternal(pBuffers, iCount);
+				result = SendInternal(pBuffers, iCount, fnRelease, pvArg);
 			else
 				result = ERROR_INVALID_STATE;
 		}
@@ -622,30 +636,21 @@ BOOL CTcpClient::DoSendPackets(const WSABUF pBuffers[], int iCount)
 		result = ERROR_INVALID_PARAMETER;
 
 	if(result != NO_ERROR)
+	{
+		::InvokeSendBufferRelease(fnRelease, pvArg);
 		::SetLastError(result);
+	}
 
 	return (result == NO_ERROR);
 }
 
-int CTcpClient::SendInternal(const WSABUF pBuffers[], int iCount)
+int CTcpClient::SendInternal(const WSABUF pBuffers[], int iCount, Fn_SendBufferRelease fnRelease, PVOID pvArg)
 {
 	ASSERT(m_lsSend.Length() >= 0);
 
 	int iPending = m_lsSend.Length();
 
-	for(int i = 0; i < iCount; i++)
-	{
-		int iBufLen = pBuffers[i].len;
-
-		if(iBufLen > 0)
-		{
-			BYTE* pBuffer = (BYTE*)pBuffers[i].buf;
-			ASSERT(pBuffer);
-
-			m_lsSend.Cat(pBuffer, iBufLen);
-			ASSERT(m_lsSend.Length() > 0);
-		}
-	}
+	::CatSendBuffers(m_lsSend, pBuffers, iCount, 0, fnRelease, pvArg);
 
 	if(iPending == 0 && m_lsSend.Length() > 0) m_evSend.Set();
 
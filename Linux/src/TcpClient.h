@@ -34,6 +34,8 @@ public:
 	virtual BOOL Send	(const BYTE* pBuffer, int iLength, int iOffset = 0);
 	virtual BOOL SendSmallFile	(LPCTSTR lpszFileName, const LPWSABUF pHead = nullptr, const LPWSABUF pTail = nullptr);
 	virtual BOOL SendPackets	(const WSABUF pBuffers[], int iCount)	{return DoSendPackets(pBuffers, iCount);}
+	virtual BOOL SendRefPackets	(const WSABUF pBuffers[], int iCount, Fn_SendBufferRelease fnRelease, PVOID pvArg = nullptr)
+		{return DoSendPackets(pBuffers, iCount, fnRelease, pvArg);}
 	virtual BOOL PauseReceive	(BOOL bPause = TRUE);
 	virtual BOOL Wait			(DWORD dwMilliseconds = INFINITE) {return m_evWait.WaitFor(dwMilliseconds, WAIT_FOR_STOP_PREDICATE);}
 	virtual BOOL			HasStarted			()	{return m_enState == SS_STARTED || m_enState == SS_STARTING;}
@@ -119,6 +121,8 @@ protected:
 		{return m_pListener->OnReceive(pSender, pSender->GetConnectionID(), pData, iLength);}
 	virtual EnHandleResult DoFireReceive(ITcpClient* pSender, int iLength)
 		{return m_pListener->OnReceive(pSender, pSender->GetConnectionID(), iLength);}
+	virtual EnHandleResult DoFireReceiveBatch(ITcpClient* pSender, const WSABUF pFrames[], int iCount)
+		{return m_pListener->OnReceiveBatch(pSender, pSender->GetConnectionID(), pFrames, iCount);}
 	virtual EnHandleResult DoFireClose(ITcpClient* pSender, EnSocketOperation enOperation, int iErrorCode)
 		{return m_pListener->OnClose(pSender, pSender->GetConnectionID(), enOperation, iErrorCode);}
 
@@ -132,7 +136,7 @@ protected:
 	virtual void OnWorkerThreadStart(THR_ID tid) {}
 	virtual void OnWorkerThreadEnd(THR_ID tid) {}
 
-	BOOL DoSendPackets(const WSABUF pBuffers[], int iCount);
+	BOOL DoSendPackets(const WSABUF pBuffers[], int iCount, Fn_SendBufferRelease fnRelease = nullptr, PVOID pvArg = nullptr);
 
 	static BOOL DoSendPackets(CTcpClient* pClient, const WSABUF pBuffers[], int iCount)
 		{return pClient->DoSendPackets(pBuffers, iCount);}
@@ -156,8 +160,8 @@ private:
 	BOOL ProcessNetworkEvent(SHORT events);
 	BOOL ReadData();
 	BOOL SendData();
-	BOOL DoSendData(TItem* pItem, BOOL& bBlocked);
-	int SendInternal(const WSABUF pBuffers[], int iCount);
+	BOOL DoSendData(TItemList& lsItem, BOOL& bBlocked);
+	int SendInternal(const WSABUF pBuffers[], int iCount, Fn_SendBufferRelease fnRelease, PVOID pvArg);
 	void WaitForWorkerThreadEnd();
 
 	BOOL HandleConnect	(SHORT events);
@@ -58,7 +58,28 @@ public:
 		return __super::SendPackets(dwConnID, buffers.get(), iNewCount);
 	}
 
+	virtual BOOL SendRefPackets(CONNID dwConnID, const WSABUF pBuffers[], int iCount, Fn_SendBufferRelease fnRelease, PVOID pvArg = nullptr)
+	{
+		int iNewCount = iCount + 1;
+		unique_ptr<WSABUF[]> buffers(new WSABUF[iNewCount]);
+
+		DWORD dwHeader;
+		if(!::AddPackHeader(pBuffers, iCount, buffers, m_dwMaxPackSize, m_usHeaderFlag, dwHeader))
+		{
+			::InvokeSendBufferRelease(fnRelease, pvArg);
+			return FALSE;
+		}
+
+		return __super::SendRefPackets(dwConnID, buffers.get(), iNewCount, fnRelease, pvArg);
+	}
+
 protected:
+	virtual BOOL DoSendFile(CONNID dwConnID, CFile& file, ULONGLONG ullOffset, ULONGLONG ullLength, const LPWSABUF pHead, const LPWSABUF pTail, Fn_SendBufferRelease fnComplete, PVOID pvArg)
+	{
+		/* 文件数据需要添加包头，读取后作为一个数据包发送 */
+		return __super::SendFileByPackets(dwConnID, file, ullOffset, ullLength, pHead, pTail, fnComplete, pvArg);
+	}
+
 	virtual EnHandleResult DoFireConnect(TAgentSocketObj* pSocketObj)
 	{
 		EnHandleResult result = __super::DoFireConnect(pSocketObj);
@@ -94,6 +115,30 @@ protected:
 		return ParsePack(this, pInfo, pBuffer, pSocketObj, m_dwMaxPackSize, m_usHeaderFlag, pData, iLength);
 	}
 
+	virtual EnHandleResult DoFireDirectReceive(TAgentSocketObj* pSocketObj, TBuffer* pBuffer, int iLength)
+	{
+		TBufferPackInfo* pInfo = nullptr;
+		GetConnectionReserved(pSocketObj, (PVOID*)&pInfo);
+		ASSERT(pInfo && pInfo->pBuffer == pBuffer);
+
+		return ParsePack(this, pInfo, pBuffer, pSocketObj, m_dwMaxPackSize, m_usHeaderFlag);
+	}
+
+	virtual TBuffer* GetDirectReceiveBuffer(TAgentSocketObj* pSocketObj)
+	{
+		if(!m_bDirectReceive || __super::IsSecure())
+			return nullptr;
+
+		TBufferPackInfo* pInfo = nullptr;
+		GetConnectionReserved(pSocketObj, (PVOID*)&pInfo);
+		ASSERT(pInfo);
+
+		TBuffer* pBuffer = (TBuffer*)pInfo->pBuffer;
+		ASSERT(pBuffer && pBuffer->IsValid());
+
+		return pBuffer;
+	}
+
 	virtual EnHandleResult DoFireClose(TAgentSocketObj* pSocketObj, EnSocketOperation enOperation, int iErrorCode)
 	{
 		EnHandleResult result = __super::DoFireClose(pSocketObj, enOperation, iErrorCode);
@@ -167,8 +212,12 @@ protected:
 public:
 	virtual void SetMaxPackSize		(DWORD dwMaxPackSize)		{ENSURE_HAS_STOPPED(); m_dwMaxPackSize = dwMaxPackSize;}
 	virtual void SetPackHeaderFlag	(USHORT usPackHeaderFlag)	{ENSURE_HAS_STOPPED(); m_usHeaderFlag  = usPackHeaderFlag;}
+	virtual void SetReceiveBatch	(BOOL bReceiveBatch)		{ENSURE_HAS_STOPPED(); m_bReceiveBatch = bReceiveBatch;}
+	virtual void SetDirectReceive	(BOOL bDirectReceive)		{ENSURE_HAS_STOPPED(); m_bDirectReceive = bDirectReceive;}
 	virtual DWORD GetMaxPackSize	()							{return m_dwMaxPackSize;}
 	virtual USHORT GetPackHeaderFlag()							{return m_usHeaderFlag;}
+	virtual BOOL IsReceiveBatch		()							{return m_bReceiveBatch;}
+	virtual BOOL IsDirectReceive	()							{return m_bDirectReceive;}
 
 private:
 	void ReleaseConnectionExtra(TAgentSocketObj* pSocketObj)
@@ -187,14 +236,20 @@ private:
 
 	EnHandleResult DoFireSuperReceive(TAgentSocketObj* pSocketObj, const BYTE* pData, int iLength)
 		{return __super::DoFireReceive(pSocketObj, pData, iLength);}
+	EnHandleResult DoFireSuperReceiveBatch(TAgentSocketObj* pSocketObj, const WSABUF pFrames[], int iCount)
+		{return __super::DoFireReceiveBatch(pSocketObj, pFrames, iCount);}
 
 	friend EnHandleResult ParsePack<>(CTcpPackAgentT* pThis, TBufferPackInfo* pInfo, TBuffer* pBuffer, TAgentSocketObj* pSocket, DWORD dwMaxPackSize, USHORT usPackHeaderFlag);
+	friend EnHandleResult ParsePack<>(CTcpPackAgentT* pThis, TBufferPackInfo* pInfo, TBuffer* pBuffer, TAgentSocketObj* pSocket, DWORD dwMaxPackSize, USHORT usPackHeaderFlag, const BYTE* pData, int iLength);
+	friend EnHandleResult ParsePackBatch<>(CTcpPackAgentT* pThis, TBufferPackInfo* pInfo, TBuffer* pBuffer, TAgentSocketObj* pSocket, DWORD dwMaxPackSize, USHORT usPackHeaderFlag);
 
 public:
 	CTcpPackAgentT(ITcpAgentListener* pListener)
 	: T					(pListener)
 	, m_dwMaxPackSize	(TCP_PACK_DEFAULT_MAX_SIZE)
 	, m_usHeaderFlag	(TCP_PACK_DEFAULT_HEADER_FLAG)
+	, m_bReceiveBatch	(FALSE)
+	, m_bDirectReceive	(FALSE)
 	{
 
 	}
@@ -207,6 +262,8 @@ public:
 private:
 	DWORD	m_dwMaxPackSize;
 	USHORT	m_usHeaderFlag;
+	BOOL	m_bReceiveBatch;
+	BOOL	m_bDirectReceive;
 
 	CBufferPool m_bfPool;
 };
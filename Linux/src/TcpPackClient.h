@@ -50,6 +50,21 @@ public:
 		return __super::SendPackets(buffers.get(), iNewCount);
 	}
 
+	virtual BOOL SendRefPackets(const WSABUF pBuffers[], int iCount, Fn_SendBufferRelease fnRelease, PVOID pvArg = nullptr)
+	{
+		int iNewCount = iCount + 1;
+		unique_ptr<WSABUF[]> buffers(new WSABUF[iNewCount]);
+
+		DWORD dwHeader;
+		if(!::AddPackHeader(pBuffers, iCount, buffers, m_dwMaxPackSize, m_usHeaderFlag, dwHeader))
+		{
+			::InvokeSendBufferRelease(fnRelease, pvArg);
+			return FALSE;
+		}
+
+		return __super::SendRefPackets(buffers.get(), iNewCount, fnRelease, pvArg);
+	}
+
 protected:
 	virtual EnHandleResult DoFireReceive(ITcpClient* pSender, const BYTE* pData, int iLength)
 	{
@@ -82,21 +97,30 @@ protected:
 public:
 	virtual void SetMaxPackSize		(DWORD dwMaxPackSize)		{ENSURE_HAS_STOPPED(); m_dwMaxPackSize = dwMaxPackSize;}
 	virtual void SetPackHeaderFlag	(USHORT usPackHeaderFlag)	{ENSURE_HAS_STOPPED(); m_usHeaderFlag  = usPackHeaderFlag;}
+	virtual void SetReceiveBatch	(BOOL bReceiveBatch)		{ENSURE_HAS_STOPPED(); m_bReceiveBatch = bReceiveBatch;}
 	virtual DWORD GetMaxPackSize	()							{return m_dwMaxPackSize;}
 	virtual USHORT GetPackHeaderFlag()							{return m_usHeaderFlag;}
+	virtual BOOL IsReceiveBatch		()							{return m_bReceiveBatch;}
 
 private:
 	EnHandleResult DoFireSuperReceive(ITcpClient* pSender, const BYTE* pData, int iLength)
 		{return __super::DoFireReceive(pSender, pData, iLength);}
+	EnHandleResult DoFireSuperReceiveBatch(ITcpClient* pSender, const WSABUF pFrames[], int iCount)
+		{return __super::DoFireReceiveBatch(pSender, pFrames, iCount);}
 
 	friend EnHandleResult ParsePack<>	(CTcpPackClientT* pThis, TPackInfo<TItemListEx>* pInfo, TItemListEx* pBuffer, CTcpPackClientT* pSocket,
 										DWORD dwMaxPackSize, USHORT usPackHeaderFlag);
+	friend EnHandleResult ParsePack<>	(CTcpPackClientT* pThis, TPackInfo<TItemListEx>* pInfo, TItemListEx* pBuffer, CTcpPackClientT* pSocket,
+										DWORD dwMaxPackSize, USHORT usPackHeaderFlag, const BYTE* pData, int iLength);
+	friend EnHandleResult ParsePackBatch<>	(CTcpPackClientT* pThis, TPackInfo<TItemListEx>* pInfo, TItemListEx* pBuffer, CTcpPackClientT* pSocket,
+										DWORD dwMaxPackSize, USHORT usPackHeaderFlag);
 
 public:
 	CTcpPackClientT(ITcpClientListener* pListener)
 	: T					(pListener)
 	, m_dwMaxPackSize	(TCP_PACK_DEFAULT_MAX_SIZE)
 	, m_usHeaderFlag	(TCP_PACK_DEFAULT_HEADER_FLAG)
+	, m_bReceiveBatch	(FALSE)
 	, m_pkInfo			(nullptr)
 	, m_lsBuffer		(m_itPool)
 	{
@@ -111,6 +135,7 @@ public:
 private:
 	DWORD	m_dwMaxPackSize;
 	USHORT	m_usHeaderFlag;
+	BOOL	m_bReceiveBatch;
 
 	TPackInfo<TItemListEx>	m_pkInfo;
 	TItemListEx				m_lsBuffer;
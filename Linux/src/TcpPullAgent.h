@@ -47,16 +47,31 @@ public:
 public:
 	virtual EnFetchResult Fetch(CONNID dwConnID, BYTE* pData, int iLength)
 	{
-		TBuffer* pBuffer = m_bfPool[dwConnID];
+		TBuffer* pBuffer = FindBuffer(dwConnID);
 		return ::FetchBuffer(pBuffer, pData, iLength);
 	}
 
 	virtual EnFetchResult Peek(CONNID dwConnID, BYTE* pData, int iLength)
 	{
-		TBuffer* pBuffer = m_bfPool[dwConnID];
+		TBuffer* pBuffer = FindBuffer(dwConnID);
 		return ::PeekBuffer(pBuffer, pData, iLength);
 	}
 
+	virtual EnFetchResult PeekView(CONNID dwConnID, WSABUF pBuffers[], int& iCount, int iLength)
+	{
+		TBuffer* pBuffer = FindBuffer(dwConnID);
+		return ::PeekBufferView(pBuffer, pBuffers, iCount, iLength);
+	}
+
+	virtual EnFetchResult Skip(CONNID dwConnID, int iLength)
+	{
+		TBuffer* pBuffer = FindBuffer(dwConnID);
+		return ::SkipBuffer(pBuffer, iLength);
+	}
+
+	virtual void SetDirectReceive	(BOOL bDirectReceive)	{ENSURE_HAS_STOPPED(); m_bDirectReceive = bDirectReceive;}
+	virtual BOOL IsDirectReceive	()						{return m_bDirectReceive;}
+
 protected:
 	virtual EnHandleResult DoFireConnect(TAgentSocketObj* pSocketObj)
 	{
@@ -89,9 +104,30 @@ protected:
 
 		pBuffer->Cat(pData, iLength);
 
+		TPullContext ctx(this, pSocketObj->connID, pBuffer);
+
+		return __super::DoFireReceive(pSocketObj, pBuffer->Length());
+	}
+
+	virtual EnHandleResult DoFireDirectReceive(TAgentSocketObj* pSocketObj, TBuffer* pBuffer, int iLength)
+	{
+		TPullContext ctx(this, pSocketObj->connID, pBuffer);
+
 		return __super::DoFireReceive(pSocketObj, pBuffer->Length());
 	}
 
+	virtual TBuffer* GetDirectReceiveBuffer(TAgentSocketObj* pSocketObj)
+	{
+		if(!m_bDirectReceive || __super::IsSecure())
+			return nullptr;
+
+		TBuffer* pBuffer = nullptr;
+		GetConnectionReserved(pSocketObj, (PVOID*)&pBuffer);
+		ASSERT(pBuffer && pBuffer->IsValid());
+
+		return pBuffer;
+	}
+
 	virtual EnHandleResult DoFireClose(TAgentSocketObj* pSocketObj, EnSocketOperation enOperation, int iErrorCode)
 	{
 		EnHandleResult result = __super::DoFireClose(pSocketObj, enOperation, iErrorCode);
@@ -135,6 +171,12 @@ protected:
 	}
 
 private:
+	TBuffer* FindBuffer(CONNID dwConnID)
+	{
+		TBuffer* pBuffer = TPullContext::Find(this, dwConnID);
+		return (pBuffer != nullptr) ? pBuffer : m_bfPool[dwConnID];
+	}
+
 	void ReleaseConnectionExtra(TAgentSocketObj* pSocketObj)
 	{
 		TBuffer* pBuffer = nullptr;
@@ -149,7 +191,8 @@ private:
 
 public:
 	CTcpPullAgentT(ITcpAgentListener* pListener)
-	: T(pListener)
+	: T					(pListener)
+	, m_bDirectReceive	(FALSE)
 	{
 
 	}
@@ -160,6 +203,8 @@ public:
 	}
 
 private:
+	BOOL m_bDirectReceive;
+
 	CBufferPool m_bfPool;
 };
 
@@ -47,6 +47,16 @@ public:
 		return ::PeekBuffer(&m_lsBuffer, pData, iLength);
 	}
 
+	virtual EnFetchResult PeekView(WSABUF pBuffers[], int& iCount, int iLength)
+	{
+		return ::PeekBufferView(&m_lsBuffer, pBuffers, iCount, iLength);
+	}
+
+	virtual EnFetchResult Skip(int iLength)
+	{
+		return ::SkipBuffer(&m_lsBuffer, iLength);
+	}
+
 protected:
 	virtual EnHandleResult DoFireReceive(ITcpClient* pSender, const BYTE* pData, int iLength)
 	{
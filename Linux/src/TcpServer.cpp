@@ -60,13 +60,20 @@ BOOL CTcpServer::CheckParams()
 		((int)m_dwAcceptSocketCount > 0)														&&
 		((int)m_dwSocketBufferSize >= MIN_SOCKET_BUFFER_SIZE)									&&
 		((int)m_dwSocketListenQueue > 0)														&&
+		((int)m_dwAcceptBudget >= 0)															&&
+		((int)m_dwDeferAcceptTime >= 0)															&&
 		((int)m_dwFreeSocketObjLockTime >= 1000)												&&
 		((int)m_dwFreeSocketObjPool >= 0)														&&
 		((int)m_dwFreeBufferObjPool >= 0)														&&
 		((int)m_dwFreeSocketObjHold >= 0)														&&
 		((int)m_dwFreeBufferObjHold >= 0)														&&
 		((int)m_dwKeepAliveTime >= 1000 || m_dwKeepAliveTime == 0)								&&
-		((int)m_dwKeepAliveInterval >= 1000 || m_dwKeepAliveInterval == 0)						)
+		((int)m_dwKeepAliveInterval >= 1000 || m_dwKeepAliveInterval == 0)						&&
+		((int)m_dwBusyPollTime >= 0)															&&
+		((int)m_dwRebalanceThreshold >= 0 && m_dwRebalanceThreshold <= 100)						&&
+		(m_dwSendHighWatermark == 0 || m_dwSendLowWatermark < m_dwSendHighWatermark)			&&
+		(m_dwIdleTimeout == 0 || (m_bMarkSilence && m_dwIdleTimeout <= MAX_CONNECTION_PERIOD))	&&
+		(::MakeCpuAffinityList(m_enCpuAffinityPolicy, m_strCpuAffinityList, m_vtCpus))			)
 		return TRUE;
 
 	SetLastError(SE_INVALID_PARAM, __FUNCTION__, ERROR_INVALID_PARAMETER);
@@ -84,11 +91,19 @@ void CTcpServer::PrepareStart()
 
 	m_bfObjPool.Prepare();
 
-	m_rcBuffers = make_unique<CBufferPtr[]>(m_dwWorkerThreadCount);
-	for_each(m_rcBuffers.get(), m_rcBuffers.get() + m_dwWorkerThreadCount, [this](CBufferPtr& buff) {buff.Malloc(m_dwSocketBufferSize);});
+	DWORD dwWorkerThreadCount = m_dwWorkerThreadCount
+#ifdef USE_EXTERNAL_GC
+														+ 1
+#endif
+														;
+
+	m_rcBuffers = make_unique<CBufferPtr[]>(dwWorkerThreadCount);
+	for_each(m_rcBuffers.get(), m_rcBuffers.get() + dwWorkerThreadCount, [this](CBufferPtr& buff) {buff.Malloc(m_dwSocketBufferSize);});
 
 	m_soListens = make_unique<SOCKET[]>(m_dwWorkerThreadCount);
 	for_each(m_soListens.get(), m_soListens.get() + m_dwWorkerThreadCount, [](SOCKET& sock) {sock = INVALID_FD;});
+
+	m_vtZeroCopy.assign(m_dwWorkerThreadCount, FALSE);
 }
 
 BOOL CTcpServer::CheckStarting()
@@ -155,6 +170,22 @@ BOOL CTcpServer::CreateListenSocket(LPCTSTR lpszBindAddress, USHORT usPort)
 		VERIFY(IS_NO_ERROR(::SSO_ReuseAddress(soListen, m_enReusePolicy)));
 		VERIFY(IS_NO_ERROR(::SSO_NoDelay(soListen, m_bNoDelay)));
 
+		if(m_dwBusyPollTime > 0)
+			::SSO_BusyPoll(soListen, (int)m_dwBusyPollTime);
+
+		if(!m_vtCpus.empty())
+			::SSO_IncomingCpu(soListen, m_vtCpus[i % m_vtCpus.size()]);
+
+		if(m_dwDeferAcceptTime > 0)
+			VERIFY(IS_NO_ERROR(::SSO_DeferAccept(soListen, m_dwDeferAcceptTime)));
+
+		/* TCP_NOTSENT_LOWAT 由已接受的连接继承：内核未发送数据达到该值后写操作返回 EAGAIN，直到 EPOLLOUT 再次就绪 */
+		if(m_dwNotSentLowat > 0)
+			VERIFY(IS_NO_ERROR(::SSO_NotSentLowat(soListen, m_dwNotSentLowat)));
+
+		/* SO_ZEROCOPY 由已接受的连接继承，连接按接受它的监听 Socket 确定是否启用 */
+		m_vtZeroCopy[i] = (m_dwZeroCopyThreshold > 0 && IS_NO_ERROR(::SSO_ZeroCopy(soListen)));
+
 		if(IS_HAS_ERROR(::bind(soListen, addr.Addr(), addr.AddrSize())))
 		{
 			SetLastError(SE_SOCKET_BIND, __FUNCTION__, ::WSAGetLastError());
@@ -185,7 +216,13 @@ BOOL CTcpServer::CreateWorkerThreads()
 #endif
 														;
 
-	if(!m_ioDispatcher.Start(this, m_dwAcceptSocketCount, dwWorkerThreadCount))
+	if(!m_ioDispatcher.Start(this, m_dwAcceptSocketCount, dwWorkerThreadCount, m_bUseIOUring, m_vtCpus, m_dwBusyPollTime, m_dwSocketBufferSize))
+	{
+		SetLastError(SE_WORKER_THREAD_CREATE, __FUNCTION__, ::WSAGetLastError());
+		return FALSE;
+	}
+
+	if(m_dwRebalanceThreshold > 0 && !m_ioDispatcher.StartRebalance(m_dwRebalanceThreshold))
 	{
 		SetLastError(SE_WORKER_THREAD_CREATE, __FUNCTION__, ::WSAGetLastError());
 		return FALSE;
@@ -246,14 +283,17 @@ void CTcpServer::CloseListenSocket()
 {
 	if(m_soListens)
 	{
-		for_each(m_soListens.get(), m_soListens.get() + m_dwWorkerThreadCount, [](SOCKET& sock)
+		for(DWORD i = 0; i < m_dwWorkerThreadCount; i++)
 		{
+			SOCKET& sock = m_soListens[i];
+
 			if(sock != INVALID_FD)
 			{
+				m_ioDispatcher.DetachFD(i, sock);
 				::ManualCloseSocket(sock);
 				sock = INVALID_FD;
 			}
-		});
+		}
 
 		::WaitFor(100);
 	}
@@ -312,6 +352,8 @@ void CTcpServer::Reset()
 	m_rcBuffers = nullptr;
 	m_soListens = nullptr;
 
+	m_vtZeroCopy.clear();
+
 	m_enState = SS_STOPPED;
 
 	m_evWait.SyncNotifyAll();
@@ -357,6 +399,9 @@ void CTcpServer::AddFreeSocketObj(TSocketObj* pSocketObj, EnSocketCloseFlag enFl
 	CloseClientSocketObj(pSocketObj, enFlag, enOperation, iErrorCode);
 
 	m_bfActiveSockets.Remove(pSocketObj->connID);
+
+	m_ioDispatcher.KillTimer(&pSocketObj->timer);
+	m_ioDispatcher.KillTimer(&pSocketObj->idleTimer);
 	TSocketObj::Release(pSocketObj);
 
 #ifndef USE_EXTERNAL_GC
@@ -377,16 +422,30 @@ BOOL CTcpServer::InvalidSocketObj(TSocketObj* pSocketObj)
 	return TSocketObj::InvalidSocketObj(pSocketObj);
 }
 
-void CTcpServer::AddClientSocketObj(CONNID dwConnID, TSocketObj* pSocketObj, const HP_SOCKADDR& remoteAddr)
+void CTcpServer::AddClientSocketObj(CONNID dwConnID, TSocketObj* pSocketObj, const HP_SOCKADDR& remoteAddr, int iIndex)
 {
 	ASSERT(FindSocketObj(dwConnID) == nullptr);
 
 	pSocketObj->connTime	= ::TimeGetTime();
 	pSocketObj->activeTime	= pSocketObj->connTime;
+	pSocketObj->index		= iIndex;
+	pSocketObj->zerocopy	= m_vtZeroCopy[iIndex] && !m_ioDispatcher.IsCompletionIo();
+	pSocketObj->coalesce	= m_dwCoalesceSize;
+	pSocketObj->pHolder		= this;
+	pSocketObj->timer.fn	= FlushCoalesced;
+	pSocketObj->timer.pv	= pSocketObj;
 
 	remoteAddr.Copy(pSocketObj->remoteAddr);
 	pSocketObj->SetConnected();
 
+	if(m_dwIdleTimeout > 0)
+	{
+		pSocketObj->idleTimer.fn = CheckIdle;
+		pSocketObj->idleTimer.pv = pSocketObj;
+
+		VERIFY(m_ioDispatcher.SetTimer(iIndex, &pSocketObj->idleTimer, m_dwIdleTimeout));
+	}
+
 	VERIFY(m_bfActiveSockets.ReleaseLock(dwConnID, pSocketObj));
 }
 
@@ -412,6 +471,7 @@ void CTcpServer::CloseClientSocketObj(TSocketObj* pSocketObj, EnSocketCloseFlag
 	SOCKET socket = pSocketObj->socket;
 	pSocketObj->socket = INVALID_SOCKET;
 
+	m_ioDispatcher.DetachFD(pSocketObj->index, socket);
 	::ManualCloseSocket(socket, iShutdownFlag);
 }
 
@@ -499,6 +559,27 @@ BOOL CTcpServer::GetConnectionExtra(TSocketObj* pSocketObj, PVOID* ppExtra)
 	return FALSE;
 }
 
+BOOL CTcpServer::SetConnectionCoalesceSize(CONNID dwConnID, DWORD dwCoalesceSize)
+{
+	TSocketObj* pSocketObj = FindSocketObj(dwConnID);
+
+	if(!TSocketObj::IsValid(pSocketObj))
+	{
+		::SetLastError(ERROR_OBJECT_NOT_FOUND);
+		return FALSE;
+	}
+
+	CReentrantCriSecLock locallock(pSocketObj->csSend);
+
+	pSocketObj->coalesce = dwCoalesceSize;
+
+	/* 关闭合并或调小阈值后立即发送已暂存的数据 */
+	if(pSocketObj->held && pSocketObj->Pending() >= (int)dwCoalesceSize)
+		RequestSend(pSocketObj, FALSE);
+
+	return TRUE;
+}
+
 BOOL CTcpServer::SetConnectionReserved(CONNID dwConnID, PVOID pReserved)
 {
 	TSocketObj* pSocketObj = FindSocketObj(dwConnID);
@@ -677,7 +758,7 @@ BOOL CTcpServer::Disconnect(CONNID dwConnID, BOOL bForce)
 		return FALSE;
 	}
 
-	return m_ioDispatcher.SendCommandByFD(pSocketObj->socket, DISP_CMD_DISCONNECT, dwConnID, bForce);
+	return SendCommand(pSocketObj, DISP_CMD_DISCONNECT, bForce);
 }
 
 BOOL CTcpServer::DisconnectLongConnections(DWORD dwPeriod, BOOL bForce)
@@ -746,11 +827,86 @@ BOOL CTcpServer::PauseReceive(CONNID dwConnID, BOOL bPause)
 	pSocketObj->paused = bPause;
 
 	if(!bPause)
-		return m_ioDispatcher.SendCommandByFD(pSocketObj->socket, DISP_CMD_UNPAUSE, pSocketObj->connID);
+		return SendCommand(pSocketObj, DISP_CMD_UNPAUSE);
 
 	return TRUE;
 }
 
+BOOL CTcpServer::Flush(CONNID dwConnID)
+{
+	TSocketObj* pSocketObj = FindSocketObj(dwConnID);
+
+	if(!TSocketObj::IsValid(pSocketObj))
+	{
+		::SetLastError(ERROR_OBJECT_NOT_FOUND);
+		return FALSE;
+	}
+
+	return FlushInternal(pSocketObj);
+}
+
+BOOL CTcpServer::FlushInternal(TSocketObj* pSocketObj)
+{
+	int result = NO_ERROR;
+
+	{
+		CLocalSafeCounter localcounter(*pSocketObj);
+		CReentrantCriSecLock locallock(pSocketObj->csSend);
+
+		if(!TSocketObj::IsValid(pSocketObj))
+			result = ERROR_OBJECT_NOT_FOUND;
+		else if(pSocketObj->held)
+			result = RequestSend(pSocketObj, FALSE);
+	}
+
+	if(result != NO_ERROR)
+		::SetLastError(result);
+
+	return (result == NO_ERROR);
+}
+
+void CTcpServer::FlushCoalesced(PVOID pv)
+{
+	TSocketObj* pSocketObj = (TSocketObj*)pv;
+	((CTcpServer*)pSocketObj->pHolder)->FlushInternal(pSocketObj);
+}
+
+void CTcpServer::CheckIdle(PVOID pv)
+{
+	TSocketObj* pSocketObj = (TSocketObj*)pv;
+
+	if(!TSocketObj::IsValid(pSocketObj))
+		return;
+
+	CTcpServer* pServer	= (CTcpServer*)pSocketObj->pHolder;
+	DWORD dwPeriod		= ::GetTimeGap32(pSocketObj->activeTime);
+
+	/* 未超时则按剩余时间重新设置单次定时器（连接迁移后随之挂接到新工作线程的时间轮），收到数据时无需操作定时器 */
+	if(dwPeriod >= pServer->m_dwIdleTimeout)
+		pServer->SendCommand(pSocketObj, DISP_CMD_DISCONNECT, TRUE);
+	else
+		pServer->m_ioDispatcher.SetTimer(pSocketObj->index, &pSocketObj->idleTimer, pServer->m_dwIdleTimeout - dwPeriod);
+}
+
+BOOL CTcpServer::Post(CONNID dwConnID, Fn_ConnTaskProc fnProc, PVOID pvArg)
+{
+	if(fnProc == nullptr)
+	{
+		::SetLastError(ERROR_INVALID_PARAMETER);
+		return FALSE;
+	}
+
+	TSocketObj* pSocketObj = FindSocketObj(dwConnID);
+
+	if(!TSocketObj::IsValid(pSocketObj))
+	{
+		::SetLastError(ERROR_OBJECT_NOT_FOUND);
+		return FALSE;
+	}
+
+	return SendCommand(pSocketObj, DISP_CMD_POST, (UINT_PTR)TConnTask::Construct(fnProc, pvArg));
+}
+
 BOOL CTcpServer::OnBeforeProcessIo(const TDispContext* pContext, PVOID pv, UINT events)
 {
 	if(pv == &m_soListens[pContext->GetIndex()])
@@ -771,7 +927,7 @@ BOOL CTcpServer::OnBeforeProcessIo(const TDispContext* pContext, PVOID pv, UINT
 	if(!TSocketObj::IsValid(pSocketObj))
 		return FALSE;
 
-	if(events & _EPOLL_ALL_ERROR_EVENTS)
+	if((events & _EPOLL_HUNGUP_EVENTS) || ((events & _EPOLL_ERROR_EVENTS) && !(pSocketObj->zerocopy && pSocketObj->HasConnected())))
 		pSocketObj->SetConnected(FALSE);
 
 	pSocketObj->Increment();
@@ -782,6 +938,8 @@ BOOL CTcpServer::OnBeforeProcessIo(const TDispContext* pContext, PVOID pv, UINT
 		return FALSE;
 	}
 
+	pSocketObj->processing = TRUE;
+
 	return TRUE;
 }
 
@@ -789,19 +947,61 @@ VOID CTcpServer::OnAfterProcessIo(const TDispContext* pContext, PVOID pv, UINT e
 {
 	TSocketObj* pSocketObj = (TSocketObj*)(pv);
 
+	pSocketObj->processing = FALSE;
+
+	/* 事件处理期间在本线程中发送的数据直接发送，仍未发送完毕时才注册写事件 */
+	if(TSocketObj::IsValid(pSocketObj) && !(events & EPOLLOUT) && pSocketObj->IsSendPending())
+		HandleSend(pContext, pSocketObj, RETRIVE_EVENT_FLAG_H(events));
+
 	if(TSocketObj::IsValid(pSocketObj))
 	{
-		ASSERT(rs && !(events & (EPOLLERR | EPOLLHUP | EPOLLRDHUP)));
+		ASSERT(rs && !(events & (EPOLLHUP | EPOLLRDHUP)) && (!(events & EPOLLERR) || pSocketObj->zerocopy));
 
-		UINT evts = (pSocketObj->IsPending() ? EPOLLOUT : 0) | (pSocketObj->IsPaused() ? 0 : EPOLLIN);
-		m_ioDispatcher.ModFD(pSocketObj->socket, evts | EPOLLRDHUP, pSocketObj);
+		UINT evts = ((pSocketObj->IsSendPending() && !pSocketObj->sending) ? EPOLLOUT : 0) | (pSocketObj->IsPaused() ? 0 : EPOLLIN);
+		m_ioDispatcher.ModFD(pSocketObj->index, pSocketObj->socket, evts | EPOLLRDHUP, pSocketObj, pSocketObj->armed);
 	}
 
 	pSocketObj->Decrement();
 }
 
+BOOL CTcpServer::OnMigrate(const TDispContext* pContext, PVOID pv, int iTarget)
+{
+	if(pv == &m_soListens[pContext->GetIndex()] || pv == this)
+		return FALSE;
+
+	TSocketObj* pSocketObj = (TSocketObj*)(pv);
+
+	if(!TSocketObj::IsValid(pSocketObj) || !pSocketObj->HasConnected() || pSocketObj->index != pContext->GetIndex())
+		return FALSE;
+
+	CReentrantCriSecLock locallock(pSocketObj->csSend);
+
+	/* 当前工作线程中还有该连接的命令未执行时暂不迁移，保证连接的命令按投递顺序执行 */
+	if(pSocketObj->commands > 0)
+		return FALSE;
+
+	if(!m_ioDispatcher.DelFD(pSocketObj->index, pSocketObj->socket))
+		return FALSE;
+
+	pSocketObj->armed = 0;
+	pSocketObj->index = iTarget;
+
+	/* 切换所属工作线程与投递迁入命令在同一临界区内完成，此后投递到目标工作线程的命令都在迁入命令之后执行 */
+	VERIFY(SendCommand(pSocketObj, DISP_CMD_MIGRATE));
+
+	return TRUE;
+}
+
 VOID CTcpServer::OnCommand(const TDispContext* pContext, TDispCommand* pCmd)
 {
+	if(pCmd->type != DISP_CMD_SEND_BATCH)
+	{
+		TSocketObj* pSocketObj = FindSocketObj((CONNID)(pCmd->wParam));
+
+		if(TSocketObj::IsExist(pSocketObj))
+			--pSocketObj->commands;
+	}
+
 	switch(pCmd->type)
 	{
 	case DISP_CMD_SEND:
@@ -813,9 +1013,29 @@ VOID CTcpServer::OnCommand(const TDispContext* pContext, TDispCommand* pCmd)
 	case DISP_CMD_DISCONNECT:
 		HandleCmdDisconnect(pContext, (CONNID)(pCmd->wParam), (BOOL)pCmd->lParam);
 		break;
+	case DISP_CMD_MIGRATE:
+		HandleCmdMigrate(pContext, (CONNID)(pCmd->wParam));
+		break;
+	case DISP_CMD_POST:
+		HandleCmdPost(pContext, (CONNID)(pCmd->wParam), (TConnTask*)(pCmd->lParam));
+		break;
+	case DISP_CMD_HIGH_WATER:
+		HandleCmdHighWater(pContext, (CONNID)(pCmd->wParam));
+		break;
+	case DISP_CMD_SEND_BATCH:
+		HandleCmdSendBatch(pContext, (TConnIDList*)(pCmd->lParam));
+		break;
 	}
 }
 
+VOID CTcpServer::OnDropCommand(TDispCommand* pCmd)
+{
+	if(pCmd->type == DISP_CMD_POST)
+		TConnTask::Execute((TConnTask*)(pCmd->lParam), (CONNID)(pCmd->wParam), FALSE);
+	else if(pCmd->type == DISP_CMD_SEND_BATCH)
+		delete (TConnIDList*)(pCmd->lParam);
+}
+
 VOID CTcpServer::HandleCmdSend(const TDispContext* pContext, CONNID dwConnID)
 {
 	TSocketObj* pSocketObj = FindSocketObj(dwConnID);
@@ -831,8 +1051,9 @@ VOID CTcpServer::HandleCmdUnpause(const TDispContext* pContext, CONNID dwConnID)
 	if(!TSocketObj::IsValid(pSocketObj))
 		return;
 
+	/* 完成模式下重新注册接收即可，暂停期间保留的数据由事件环重新投递 */
 	if(BeforeUnpause(pSocketObj))
-		m_ioDispatcher.ProcessIo(pContext, pSocketObj, EPOLLIN);
+		m_ioDispatcher.ProcessIo(pContext, pSocketObj, m_ioDispatcher.IsCompletionIo() ? 0 : EPOLLIN);
 	else
 		AddFreeSocketObj(pSocketObj, SCF_ERROR, SO_RECEIVE, ENSURE_ERROR_CANCELLED);
 }
@@ -845,6 +1066,63 @@ VOID CTcpServer::HandleCmdDisconnect(const TDispContext* pContext, CONNID dwConn
 		m_ioDispatcher.ProcessIo(pContext, pSocketObj, EPOLLHUP);
 }
 
+VOID CTcpServer::HandleCmdMigrate(const TDispContext* pContext, CONNID dwConnID)
+{
+	TSocketObj* pSocketObj = FindSocketObj(dwConnID);
+
+	if(!TSocketObj::IsValid(pSocketObj) || pSocketObj->index != pContext->GetIndex())
+		return;
+
+	UINT evts = ((pSocketObj->IsSendPending() && !pSocketObj->sending) ? EPOLLOUT : 0) | (pSocketObj->IsPaused() ? 0 : EPOLLIN);
+
+	if(!m_ioDispatcher.AddFD(pSocketObj->index, pSocketObj->socket, evts | EPOLLRDHUP, pSocketObj, pSocketObj->armed))
+		AddFreeSocketObj(pSocketObj, SCF_ERROR, SO_RECEIVE, ::WSAGetLastError());
+}
+
+VOID CTcpServer::HandleCmdPost(const TDispContext* pContext, CONNID dwConnID, TConnTask* pTask)
+{
+	TConnTask::Execute(pTask, dwConnID, TSocketObj::IsValid(FindSocketObj(dwConnID)));
+}
+
+VOID CTcpServer::HandleCmdHighWater(const TDispContext* pContext, CONNID dwConnID)
+{
+	TSocketObj* pSocketObj = FindSocketObj(dwConnID);
+
+	if(!TSocketObj::IsValid(pSocketObj) || !pSocketObj->highWater || pSocketObj->highNotified)
+		return;
+
+	pSocketObj->highNotified = TRUE;
+
+	if(TRIGGER(FireSendBufferHigh(pSocketObj, pSocketObj->Pending())) == HR_ERROR)
+	{
+		TRACE("<S-CNNID: %zu> OnSendBufferHigh() event return 'HR_ERROR', connection will be closed !", dwConnID);
+
+		AddFreeSocketObj(pSocketObj, SCF_ERROR, SO_SEND, ENSURE_ERROR_CANCELLED);
+		return;
+	}
+
+	/* 通知送达前发送缓冲区可能已经排空 */
+	CheckDrained(pSocketObj);
+}
+
+VOID CTcpServer::HandleCmdSendBatch(const TDispContext* pContext, TConnIDList* pIDs)
+{
+	for(CONNID dwConnID : *pIDs)
+	{
+		TSocketObj* pSocketObj = FindSocketObj(dwConnID);
+
+		if(!TSocketObj::IsExist(pSocketObj))
+			continue;
+
+		--pSocketObj->commands;
+
+		if(TSocketObj::IsValid(pSocketObj) && pSocketObj->IsPending())
+			m_ioDispatcher.ProcessIo(pContext, pSocketObj, EPOLLOUT);
+	}
+
+	delete pIDs;
+}
+
 BOOL CTcpServer::OnReadyRead(const TDispContext* pContext, PVOID pv, UINT events)
 {
 	return HandleReceive(pContext, (TSocketObj*)pv, RETRIVE_EVENT_FLAG_H(events));
@@ -855,6 +1133,33 @@ BOOL CTcpServer::OnReadyWrite(const TDispContext* pContext, PVOID pv, UINT event
 	return HandleSend(pContext, (TSocketObj*)pv, RETRIVE_EVENT_FLAG_H(events));
 }
 
+EnHandleResult CTcpServer::OnReceiveComplete(const TDispContext* pContext, PVOID pv, const BYTE* pData, int iResult)
+{
+	return HandleReceived(pContext, (TSocketObj*)pv, pData, iResult);
+}
+
+BOOL CTcpServer::OnSendComplete(const TDispContext* pContext, PVOID pv, int iResult)
+{
+	TSocketObj* pSocketObj = (TSocketObj*)(pv);
+
+	pSocketObj->sending = FALSE;
+
+	/* 发送请求被取消时重新提交未发送的数据 */
+	if(iResult == -ERROR_CANCELLED)
+		iResult = 0;
+	else if(iResult < 0)
+	{
+		AddFreeSocketObj(pSocketObj, SCF_ERROR, SO_SEND, -iResult);
+		return FALSE;
+	}
+
+	if(iResult > 0)
+		ReduceSentItems(pSocketObj, pSocketObj->sndItems, iResult);
+
+	/* 本次完成可能已发送完所有数据，HandleSend() 直接返回，需要检查是否低于低水位 */
+	return HandleSend(pContext, pSocketObj, 0) && CheckDrained(pSocketObj);
+}
+
 BOOL CTcpServer::OnHungUp(const TDispContext* pContext, PVOID pv, UINT events)
 {
 	return HandleClose(pContext, (TSocketObj*)pv, SCF_CLOSE, events);
@@ -865,6 +1170,23 @@ BOOL CTcpServer::OnError(const TDispContext* pContext, PVOID pv, UINT events)
 	return HandleClose(pContext, (TSocketObj*)pv, SCF_ERROR, events);
 }
 
+BOOL CTcpServer::OnErrorQueue(const TDispContext* pContext, PVOID pv, UINT events)
+{
+	TSocketObj* pSocketObj = (TSocketObj*)(pv);
+
+	if(!pSocketObj->zerocopy || !pSocketObj->HasConnected())
+		return FALSE;
+
+	UINT uiDone = 0;
+
+	if(::ReadZeroCopyNotifications(pSocketObj->socket, uiDone) <= 0)
+		return FALSE;
+
+	pSocketObj->ReleaseZeroCopy(uiDone);
+
+	return TRUE;
+}
+
 VOID CTcpServer::OnDispatchThreadStart(THR_ID tid)
 {
 	OnWorkerThreadStart(tid);
@@ -904,12 +1226,15 @@ BOOL CTcpServer::HandleAccept(const TDispContext* pContext, UINT events)
 		return FALSE;
 	}
 
-	while(TRUE)
+	int idx			= pContext->GetIndex();
+	SOCKET soListen	= m_soListens[idx];
+
+	for(DWORD i = 0; m_dwAcceptBudget == 0 || i < m_dwAcceptBudget; i++)
 	{
 		HP_SOCKADDR addr;
 
 		socklen_t addrLen	= (socklen_t)addr.AddrSize();
-		SOCKET soClient		= ::accept(m_soListens[pContext->GetIndex()], addr.Addr(), &addrLen);
+		SOCKET soClient		= ::accept4(soListen, addr.Addr(), &addrLen, SOCK_NONBLOCK | SOCK_CLOEXEC);
 
 		if(soClient == INVALID_SOCKET)
 		{
@@ -924,11 +1249,8 @@ BOOL CTcpServer::HandleAccept(const TDispContext* pContext, UINT events)
 			}
 		}
 
-		if(!::fcntl_SETFL(soClient, O_NOATIME | O_NONBLOCK | O_CLOEXEC))
-		{
-			::ManualCloseSocket(soClient, SHUT_RDWR);
-			continue;
-		}
+		if(m_dwBusyPollTime > 0)
+			::SSO_QuickAck(soClient);
 
 		CONNID dwConnID = 0;
 
@@ -940,7 +1262,8 @@ BOOL CTcpServer::HandleAccept(const TDispContext* pContext, UINT events)
 
 		TSocketObj* pSocketObj = GetFreeSocketObj(dwConnID, soClient);
 
-		AddClientSocketObj(dwConnID, pSocketObj, addr);
+		/* 连接由接受它的工作线程处理（与监听 Socket 的 SO_INCOMING_CPU 保持一致） */
+		AddClientSocketObj(dwConnID, pSocketObj, addr, idx);
 
 		if(TRIGGER(FireAccept(pSocketObj)) == HR_ERROR)
 		{
@@ -948,15 +1271,22 @@ BOOL CTcpServer::HandleAccept(const TDispContext* pContext, UINT events)
 			continue;
 		}
 
-		UINT evts = (pSocketObj->IsPending() ? EPOLLOUT : 0) | (pSocketObj->IsPaused() ? 0 : EPOLLIN);
+		UINT evts = (pSocketObj->IsSendPending() ? EPOLLOUT : 0) | (pSocketObj->IsPaused() ? 0 : EPOLLIN);
 
-		if(!m_ioDispatcher.AddFD(pSocketObj->socket, evts | EPOLLRDHUP, pSocketObj))
+		if(!m_ioDispatcher.AddFD(pSocketObj->index, pSocketObj->socket, evts | EPOLLRDHUP, pSocketObj, pSocketObj->armed))
 		{
 			AddFreeSocketObj(pSocketObj, SCF_ERROR, SO_ACCEPT, ::WSAGetLastError());
 			continue;
 		}
+
+		/* 客户端通常先发送数据（HTTP、TLS 等），立即尝试读取以省去一次事件等待（完成模式下已提交接收请求） */
+		if((evts & EPOLLIN) && !m_ioDispatcher.IsCompletionIo())
+			m_ioDispatcher.ProcessIo(pContext, pSocketObj, evts);
 	}
 
+	/* 达到本次唤醒的接受上限，重新激活监听 Socket 以便在处理其它事件后继续接受 */
+	m_ioDispatcher.ModFD(idx, soListen, EPOLLIN | EPOLLET, TO_PVOID(&m_soListens[idx]));
+
 	return TRUE;
 }
 
@@ -967,25 +1297,36 @@ BOOL CTcpServer::HandleReceive(const TDispContext* pContext, TSocketObj* pSocket
 	if(m_bMarkSilence) pSocketObj->activeTime = ::TimeGetTime();
 
 	CBufferPtr& buffer = m_rcBuffers[pContext->GetIndex()];
+	TBuffer* pDirect   = GetDirectReceiveBuffer(pSocketObj);
 
-	int reads = flag ? -1 : MAX_CONTINUE_READS;
+	TIoBudget budget(GetReadBudget(), m_dwIoTimeBudget, flag);
 
-	for(int i = 0; i < reads || reads < 0; i++)
+	while(TRUE)
 	{
 		if(pSocketObj->paused)
 			break;
 
-		int rc = (int)read(pSocketObj->socket, buffer.Ptr(), buffer.Size());
+		int rc = (pDirect != nullptr)
+				? ::ReadBuffer(pSocketObj->socket, pDirect)
+				: (int)read(pSocketObj->socket, buffer.Ptr(), buffer.Size());
 
 		if(rc > 0)
 		{
-			if(TRIGGER(FireReceive(pSocketObj, buffer.Ptr(), rc)) == HR_ERROR)
+			EnHandleResult rs = (pDirect != nullptr)
+								? TRIGGER(FireDirectReceive(pSocketObj, pDirect, rc))
+								: TRIGGER(FireReceive(pSocketObj, buffer.Ptr(), rc));
+
+			if(rs == HR_ERROR)
 			{
 				TRACE("<S-CNNID: %zu> OnReceive() event return 'HR_ERROR', connection will be closed !", pSocketObj->connID);
 
 				AddFreeSocketObj(pSocketObj, SCF_ERROR, SO_RECEIVE, ENSURE_ERROR_CANCELLED);
 				return FALSE;
 			}
+
+			/* 读取预算用完后让出工作线程，连接仍处于可读状态，下一轮事件循环继续读取 */
+			if(budget.Consume(rc))
+				break;
 		}
 		else if(rc == 0)
 		{
@@ -1006,66 +1347,172 @@ BOOL CTcpServer::HandleReceive(const TDispContext* pContext, TSocketObj* pSocket
 		}
 	}
 
+	if(m_dwBusyPollTime > 0)
+		::SSO_QuickAck(pSocketObj->socket);
+
 	return TRUE;
 }
 
+EnHandleResult CTcpServer::HandleReceived(const TDispContext* pContext, TSocketObj* pSocketObj, const BYTE* pData, int iResult)
+{
+	ASSERT(TSocketObj::IsValid(pSocketObj));
+
+	if(iResult == 0)
+	{
+		AddFreeSocketObj(pSocketObj, SCF_CLOSE, SO_RECEIVE, SE_OK);
+		return HR_ERROR;
+	}
+	else if(iResult < 0)
+	{
+		AddFreeSocketObj(pSocketObj, SCF_ERROR, SO_RECEIVE, -iResult);
+		return HR_ERROR;
+	}
+
+	/* 暂停接收期间由事件环保留数据，恢复接收后重新投递 */
+	if(pSocketObj->paused)
+		return HR_IGNORE;
+
+	if(m_bMarkSilence) pSocketObj->activeTime = ::TimeGetTime();
+
+	if(TRIGGER(FireReceive(pSocketObj, pData, iResult)) == HR_ERROR)
+	{
+		TRACE("<S-CNNID: %zu> OnReceive() event return 'HR_ERROR', connection will be closed !", pSocketObj->connID);
+
+		AddFreeSocketObj(pSocketObj, SCF_ERROR, SO_RECEIVE, ENSURE_ERROR_CANCELLED);
+		return HR_ERROR;
+	}
+
+	if(m_dwBusyPollTime > 0)
+		::SSO_QuickAck(pSocketObj->socket);
+
+	return HR_OK;
+}
+
 BOOL CTcpServer::HandleSend(const TDispContext* pContext, TSocketObj* pSocketObj, int flag)
 {
 	ASSERT(TSocketObj::IsValid(pSocketObj));
 
-	if(!pSocketObj->IsPending())
+	/* 已提交的发送请求完成后再继续发送 */
+	if(pSocketObj->sending || !pSocketObj->IsPending())
 		return TRUE;
 
-	BOOL bBlocked	= FALSE;
-	int writes		= flag ? -1 : MAX_CONTINUE_WRITES;
+	BOOL bBlocked = FALSE;
+	TIoBudget budget(m_dwWriteBudget, m_dwIoTimeBudget, flag);
 
-	TBufferObjList& sndBuff = pSocketObj->sndBuff;
-	TItemPtr itPtr(sndBuff);
+	TItemList& lsItem = pSocketObj->sndItems;
 
-	for(int i = 0; i < writes || writes < 0; i++)
+	/* 发送到 Socket 阻塞、数据发送完毕或写入预算用完为止 */
+	while(TRUE)
 	{
-		{
-			CReentrantCriSecLock locallock(pSocketObj->csSend);
-			itPtr = sndBuff.PopFront();
-		}
+		/* 每轮不加锁取走生产者压入的全部数据；未发送完的数据留在 sndItems 中 */
+		if(!pSocketObj->DetachSendBuffer())
+			break;
+
+		if(!SendItems(pSocketObj, lsItem, bBlocked, budget))
+			return FALSE;
 
-		if(!itPtr.IsValid())
+		if(bBlocked)
 			break;
+	}
+
+	return CheckDrained(pSocketObj);
+}
+
+BOOL CTcpServer::SendItems(TSocketObj* pSocketObj, TItemList& lsItem, BOOL& bBlocked, TIoBudget& budget)
+{
+	int iZeroCopy = pSocketObj->zerocopy ? (int)m_dwZeroCopyThreshold : 0;
+
+	while(!lsItem.IsEmpty())
+	{
+		TItem* pFront = lsItem.Front();
+
+		if(pFront->IsFile())
+		{
+			int iPending = 0;
+			int rc		 = ::SendFileItem(pSocketObj->socket, pFront, iPending);
+
+			if(rc > 0)
+			{
+				pSocketObj->ReducePending(iPending);
+
+				if(pFront->IsEmpty())
+				{
+					pSocketObj->RecycleSentItem(lsItem.PopFront());
 
-		ASSERT(!itPtr->IsEmpty());
+					if(budget.Consume(iPending))
+					{
+						bBlocked = TRUE;
+						break;
+					}
 
-		if(!SendItem(pSocketObj, itPtr, bBlocked))
+					continue;
+				}
+
+				/* 每次最多发送 MAX_SEND_FILE_CHUNK_SIZE 字节文件数据，然后让出工作线程处理其它连接 */
+				bBlocked = TRUE;
+				break;
+			}
+
+			/* 文件长度小于发送范围（文件被截断） */
+			int code = (rc == 0) ? ERROR_NO_DATA : ::WSAGetLastError();
+
+			if(code == ERROR_WOULDBLOCK)
+			{
+				bBlocked = TRUE;
+				break;
+			}
+
+			AddFreeSocketObj(pSocketObj, SCF_ERROR, SO_SEND, code);
 			return FALSE;
+		}
 
-		if(bBlocked)
+		/* 完成模式：以 SQE 提交发送，数据块在发送完成前留在 sndItems 中 */
+		if(m_ioDispatcher.IsCompletionIo())
 		{
-			ASSERT(!itPtr->IsEmpty());
+			iovec vecs[MAX_SEND_IOV_COUNT];
+			int iCount = lsItem.GetIoVecs(vecs, MAX_SEND_IOV_COUNT);
 
-			CReentrantCriSecLock locallock(pSocketObj->csSend);
-			sndBuff.PushFront(itPtr.Detach());
+			if(!m_ioDispatcher.SubmitSend(pSocketObj->index, pSocketObj->socket, vecs, iCount))
+			{
+				AddFreeSocketObj(pSocketObj, SCF_ERROR, SO_SEND, ::WSAGetLastError());
+				return FALSE;
+			}
+
+			pSocketObj->sending = TRUE;
+			bBlocked			= TRUE;
 
 			break;
 		}
-	}
 
-	return TRUE;
-}
+		BOOL bZeroCopy	= (iZeroCopy > 0 && pFront->Size() >= iZeroCopy);
+		int rc			= SOCKET_ERROR;
 
-BOOL CTcpServer::SendItem(TSocketObj* pSocketObj, TItem* pItem, BOOL& bBlocked)
-{
-	while(!pItem->IsEmpty())
-	{
-		int rc = (int)write(pSocketObj->socket, pItem->Ptr(), pItem->Size());
+		if(bZeroCopy)
+		{
+			rc = ::SendZeroCopy(pSocketObj->socket, pFront->Ptr(), pFront->Size());
+
+			/* 超出 optmem 限制时退化为普通发送 */
+			if(rc == SOCKET_ERROR && ::WSAGetLastError() == ENOBUFS)
+				bZeroCopy = FALSE;
+			else if(rc > 0)
+				pFront->Pin(pSocketObj->zcSeq++);
+		}
+
+		if(!bZeroCopy)
+			rc = ::WriteItems(pSocketObj->socket, lsItem, iZeroCopy);
 
 		if(rc > 0)
 		{
-			if(TRIGGER(FireSend(pSocketObj, pItem->Ptr(), rc)) == HR_ERROR)
+			BOOL bExhausted = budget.Consume(rc);
+
+			ReduceSentItems(pSocketObj, lsItem, rc);
+
+			/* 写入预算用完后让出工作线程，剩余数据在下一轮事件循环中继续发送 */
+			if(bExhausted)
 			{
-				TRACE("<S-CNNID: %zu> OnSend() event should not return 'HR_ERROR' !!", pSocketObj->connID);
-				ASSERT(FALSE);
+				bBlocked = TRUE;
+				break;
 			}
-
-			pItem->Reduce(rc);
 		}
 		else if(rc == SOCKET_ERROR)
 		{
@@ -1089,6 +1536,31 @@ BOOL CTcpServer::SendItem(TSocketObj* pSocketObj, TItem* pItem, BOOL& bBlocked)
 	return TRUE;
 }
 
+VOID CTcpServer::ReduceSentItems(TSocketObj* pSocketObj, TItemList& lsItem, int iLength)
+{
+	pSocketObj->ReducePending(iLength);
+
+	while(iLength > 0)
+	{
+		TItem* pItem = lsItem.Front();
+		int iSent	 = MIN(iLength, pItem->Size());
+
+		if(TRIGGER(FireSend(pSocketObj, pItem->Ptr(), iSent)) == HR_ERROR)
+		{
+			TRACE("<S-CNNID: %zu> OnSend() event should not return 'HR_ERROR' !!", pSocketObj->connID);
+			ASSERT(FALSE);
+		}
+
+		iLength -= pItem->Reduce(iSent);
+
+		if(!pItem->IsEmpty())
+			continue;
+
+		/* 以 MSG_ZEROCOPY 发送过的数据块需等待内核完成通知后才能回收 */
+		pSocketObj->RecycleSentItem(lsItem.PopFront());
+	}
+}
+
 BOOL CTcpServer::Send(CONNID dwConnID, const BYTE* pBuffer, int iLength, int iOffset)
 {
 	ASSERT(pBuffer && iLength > 0);
@@ -1102,7 +1574,7 @@ BOOL CTcpServer::Send(CONNID dwConnID, const BYTE* pBuffer, int iLength, int iOf
 	return SendPackets(dwConnID, &buffer, 1);
 }
 
-BOOL CTcpServer::DoSendPackets(CONNID dwConnID, const WSABUF pBuffers[], int iCount)
+BOOL CTcpServer::DoSendPackets(CONNID dwConnID, const WSABUF pBuffers[], int iCount, Fn_SendBufferRelease fnRelease, PVOID pvArg)
 {
 	ASSERT(pBuffers && iCount > 0);
 
@@ -1110,14 +1582,22 @@ BOOL CTcpServer::DoSendPackets(CONNID dwConnID, const WSABUF pBuffers[], int iCo
 
 	if(!TSocketObj::IsValid(pSocketObj))
 	{
+		::InvokeSendBufferRelease(fnRelease, pvArg);
 		::SetLastError(ERROR_OBJECT_NOT_FOUND);
 		return FALSE;
 	}
 
-	return DoSendPackets(pSocketObj, pBuffers, iCount);
+	if(pSocketObj->highWater)
+	{
+		::InvokeSendBufferRelease(fnRelease, pvArg);
+		::SetLastError(ERROR_NOT_ENOUGH_QUOTA);
+		return FALSE;
+	}
+
+	return DoSendPackets(pSocketObj, pBuffers, iCount, fnRelease, pvArg);
 }
 
-BOOL CTcpServer::DoSendPackets(TSocketObj* pSocketObj, const WSABUF pBuffers[], int iCount)
+BOOL CTcpServer::DoSendPackets(TSocketObj* pSocketObj, const WSABUF pBuffers[], int iCount, Fn_SendBufferRelease fnRelease, PVOID pvArg)
 {
 	ASSERT(pSocketObj && pBuffers && iCount > 0);
 
@@ -1126,15 +1606,21 @@ BOOL CTcpServer::DoSendPackets(TSocketObj* pSocketObj, const WSABUF pBuffers[],
 	if(pBuffers && iCount > 0)
 	{
 		CLocalSafeCounter localcounter(*pSocketObj);
-		CReentrantCriSecLock locallock(pSocketObj->csSend);
 
-		if(TSocketObj::IsValid(pSocketObj))
-			result = SendInternal(pSocketObj, pBuffers, iCount);
+		/* 直接发送和合并发送需要在 csSend 保护下判断连接的发送状态；其它情况下生产者不加锁，把数据压入 sndQueue */
+		if(m_enSendPolicy == SP_DIRECT || pSocketObj->coalesce > 0)
+		{
+			CReentrantCriSecLock locallock(pSocketObj->csSend);
+			result = SendInternal(pSocketObj, pBuffers, iCount, fnRelease, pvArg);
+		}
 		else
-			result = ERROR_OBJECT_NOT_FOUND;
+			result = SendInternal(pSocketObj, pBuffers, iCount, fnRelease, pvArg);
 	}
 	else
+	{
 		result = ERROR_INVALID_PARAMETER;
+		::InvokeSendBufferRelease(fnRelease, pvArg);
+	}
 
 	if(result != NO_ERROR)
 		::SetLastError(result);
@@ -1142,33 +1628,323 @@ BOOL CTcpServer::DoSendPackets(TSocketObj* pSocketObj, const WSABUF pBuffers[],
 	return (result == NO_ERROR);
 }
 
-int CTcpServer::SendInternal(TSocketObj* pSocketObj, const WSABUF pBuffers[], int iCount)
+BOOL CTcpServer::Broadcast(const CONNID pIDs[], DWORD dwCount, const WSABUF pBuffers[], int iCount)
 {
-	BOOL bPending = pSocketObj->IsPending();
+	ASSERT(pIDs && dwCount > 0 && pBuffers && iCount > 0);
 
-	for(int i = 0; i < iCount; i++)
+	if(!pIDs || dwCount == 0 || !pBuffers || iCount <= 0)
+	{
+		::SetLastError(ERROR_INVALID_PARAMETER);
+		return FALSE;
+	}
+
+	int iWorkers			= m_ioDispatcher.GetWorkers();
+	int result				= ERROR_OBJECT_NOT_FOUND;
+	DWORD dwSent			= 0;
+	TSharedBuffer* pShared	= TSharedBuffer::Construct(pBuffers, iCount);
+
+	if(pShared == nullptr)
+	{
+		::SetLastError(ERROR_NOT_ENOUGH_MEMORY);
+		return FALSE;
+	}
+
+	unique_ptr<TConnIDList[]> batches(new TConnIDList[iWorkers]);
+
+	WSABUF buffer;
+	buffer.len = pShared->len;
+	buffer.buf = pShared->Ptr();
+
+	for(DWORD i = 0; i < dwCount; i++)
+	{
+		TSocketObj* pSocketObj = FindSocketObj(pIDs[i]);
+
+		if(!TSocketObj::IsValid(pSocketObj))
+			continue;
+
+		if(pSocketObj->highWater)
+		{
+			result = ERROR_NOT_ENOUGH_QUOTA;
+			continue;
+		}
+
+		CLocalSafeCounter localcounter(*pSocketObj);
+
+		/* 小数据直接复制，无需引用共享缓冲区 */
+		BOOL bCopy = ((int)buffer.len <= MAX_COMPACT_SEND_SIZE);
+
+		if(!bCopy)
+			pShared->AddRef();
+
+		Fn_SendBufferRelease fnRelease = bCopy ? nullptr : TSharedBuffer::Release;
+		int rs = NO_ERROR;
+
+		if(m_enSendPolicy == SP_DIRECT || pSocketObj->coalesce > 0)
+		{
+			CReentrantCriSecLock locallock(pSocketObj->csSend);
+			rs = CommitSend(pSocketObj, PushSendBuffers(pSocketObj, &buffer, 1, 0, fnRelease, pShared), TRUE, batches.get());
+		}
+		else
+			rs = CommitSend(pSocketObj, PushSendBuffers(pSocketObj, &buffer, 1, 0, fnRelease, pShared), TRUE, batches.get());
+
+		if(rs == NO_ERROR)
+			++dwSent;
+		else
+			result = rs;
+	}
+
+	for(int i = 0; i < iWorkers; i++)
 	{
-		int iBufLen = pBuffers[i].len;
+		if(batches[i].empty())
+			continue;
+
+		TConnIDList* pIDList = new TConnIDList(move(batches[i]));
 
-		if(iBufLen > 0)
+		if(!m_ioDispatcher.SendCommandByIndex(i, DISP_CMD_SEND_BATCH, 0, (UINT_PTR)pIDList))
 		{
-			BYTE* pBuffer = (BYTE*)pBuffers[i].buf;
-			ASSERT(pBuffer);
+			for(CONNID dwConnID : *pIDList)
+			{
+				TSocketObj* pSocketObj = FindSocketObj(dwConnID);
+
+				if(TSocketObj::IsExist(pSocketObj))
+					--pSocketObj->commands;
+			}
 
-			pSocketObj->sndBuff.Cat(pBuffer, iBufLen);
-			ASSERT(pSocketObj->sndBuff.Length() > 0);
+			delete pIDList;
 		}
 	}
 
+	TSharedBuffer::Release(pShared);
+
+	if(dwSent == 0)
+	{
+		::SetLastError(result);
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+BOOL CTcpServer::BroadcastAll(const WSABUF pBuffers[], int iCount)
+{
+	DWORD dwCount = 0;
+	unique_ptr<CONNID[]> ids = m_bfActiveSockets.GetAllElementIndexes(dwCount);
+
+	if(dwCount == 0)
+	{
+		::SetLastError(ERROR_OBJECT_NOT_FOUND);
+		return FALSE;
+	}
+
+	return Broadcast(ids.get(), dwCount, pBuffers, iCount);
+}
+
+int CTcpServer::SendInternal(TSocketObj* pSocketObj, const WSABUF pBuffers[], int iCount, Fn_SendBufferRelease fnRelease, PVOID pvArg)
+{
+	if(!TSocketObj::IsValid(pSocketObj))
+	{
+		::InvokeSendBufferRelease(fnRelease, pvArg);
+		return ERROR_OBJECT_NOT_FOUND;
+	}
+
+	int iSent = 0;
+
+	/* 调用者持有 csSend 时才会直接发送 */
+	if(m_enSendPolicy == SP_DIRECT && !pSocketObj->IsPending() && pSocketObj->coalesce == 0)
+		iSent = SendDirect(pSocketObj, pBuffers, iCount);
+
+	BOOL bPending = PushSendBuffers(pSocketObj, pBuffers, iCount, iSent, fnRelease, pvArg);
+
+	return CommitSend(pSocketObj, bPending);
+}
+
+int CTcpServer::SendFileInternal(TSocketObj* pSocketObj, CFile& file, ULONGLONG ullOffset, ULONGLONG ullLength, const LPWSABUF pHead, const LPWSABUF pTail, Fn_SendBufferRelease fnComplete, PVOID pvArg)
+{
+	TBufferObjList lsBuff(m_bfObjPool);
+	::CatSendFile(lsBuff, file, ullOffset, ullLength, pHead, pTail, fnComplete, pvArg);
+
+	return CommitSend(pSocketObj, pSocketObj->PushSendItems(lsBuff), FALSE);
+}
+
+BOOL CTcpServer::PushSendBuffers(TSocketObj* pSocketObj, const WSABUF pBuffers[], int iCount, int iSkip, Fn_SendBufferRelease fnRelease, PVOID pvArg)
+{
+	int iLength = -iSkip;
+
+	for(int i = 0; i < iCount; i++)
+		iLength += (int)pBuffers[i].len;
+
+	/* 不需要释放函数的小数据直接复制到 sndQueue 当前的数据块中，多个生产者的小数据共用数据块 */
+	if(fnRelease == nullptr && iLength <= MAX_COMPACT_SEND_SIZE && pSocketObj->sndQueue.CanCopy(iLength))
+		return pSocketObj->PushSendCopy(pBuffers, iCount, iSkip, iLength);
+
+	TBufferObjList lsBuff(m_bfObjPool);
+	::CatSendBuffers(lsBuff, pBuffers, iCount, iSkip, fnRelease, pvArg);
+
+	return pSocketObj->PushSendItems(lsBuff);
+}
+
+int CTcpServer::CommitSend(TSocketObj* pSocketObj, BOOL bPending, BOOL bCoalesce, TConnIDList* pBatches)
+{
+	/* 连接已被关闭（关闭后 sndQueue 拒绝压入，已压入的数据由关闭时释放） */
+	if(!TSocketObj::IsValid(pSocketObj))
+		return ERROR_OBJECT_NOT_FOUND;
+
+	CheckHighWater(pSocketObj);
+
+	/* 工作线程有待发送的数据时会取出新压入的数据一并发送，只有待发送数据从无到有或需要合并发送时才加锁通知工作线程 */
+	if(bPending && pSocketObj->coalesce == 0)
+		return NO_ERROR;
+
+	CReentrantCriSecLock locallock(pSocketObj->csSend);
+
+	if(bCoalesce && pSocketObj->coalesce > 0)
+		return CoalesceSend(pSocketObj, bPending);
+
+	return RequestSend(pSocketObj, bPending, pBatches);
+}
+
+int CTcpServer::RequestSend(TSocketObj* pSocketObj, BOOL bPending, TConnIDList* pBatches)
+{
+	/* 暂存等待合并的数据尚未注册写事件 */
+	if(pSocketObj->held)
+	{
+		pSocketObj->held = FALSE;
+		bPending		 = FALSE;
+	}
+
 	if(!bPending && pSocketObj->IsPending())
 	{
-		if(!m_ioDispatcher.SendCommandByFD(pSocketObj->socket, DISP_CMD_SEND, pSocketObj->connID))
+		/* 在连接所属的工作线程中调用时直接注册写事件，无需投递命令（刚迁入、尚未注册句柄的连接仍然投递命令）；
+		   正在处理该连接的 IO 事件时不注册写事件，由 OnAfterProcessIo() 直接发送 */
+		if(m_ioDispatcher.GetContextRefByIndex(pSocketObj->index).GetThreadId() == SELF_THREAD_ID && pSocketObj->armed != 0)
+		{
+			if(pSocketObj->processing || pSocketObj->sending)
+				return NO_ERROR;
+
+			UINT evts = EPOLLOUT | (pSocketObj->IsPaused() ? 0 : EPOLLIN);
+			m_ioDispatcher.ModFD(pSocketObj->index, pSocketObj->socket, evts | EPOLLRDHUP, pSocketObj, pSocketObj->armed);
+		}
+		/* 批量发送时按工作线程收集连接，最后每个工作线程只投递一个命令 */
+		else if(pBatches != nullptr)
+		{
+			pBatches[pSocketObj->index].push_back(pSocketObj->connID);
+			++pSocketObj->commands;
+		}
+		else if(!SendCommand(pSocketObj, DISP_CMD_SEND))
 			return ::GetLastError();
 	}
 
 	return NO_ERROR;
 }
 
+int CTcpServer::CoalesceSend(TSocketObj* pSocketObj, BOOL bPending)
+{
+	/* 工作线程正在发送时，新数据随之发送 */
+	if(!pSocketObj->held && bPending)
+		return NO_ERROR;
+
+	if(pSocketObj->Pending() >= (int)pSocketObj->coalesce)
+		return RequestSend(pSocketObj, FALSE);
+
+	if(!pSocketObj->held)
+	{
+		/* 延迟为 0 时只在达到阈值或调用 Flush() 时发送 */
+		if(m_dwCoalesceDelay > 0 && !m_ioDispatcher.SetTimer(pSocketObj->index, &pSocketObj->timer, m_dwCoalesceDelay))
+			return RequestSend(pSocketObj, FALSE);
+
+		pSocketObj->held = TRUE;
+	}
+
+	return NO_ERROR;
+}
+
+void CTcpServer::CheckHighWater(TSocketObj* pSocketObj)
+{
+	if(m_dwSendHighWatermark == 0 || pSocketObj->highWater || pSocketObj->Pending() < (int)m_dwSendHighWatermark)
+		return;
+
+	/* 达到高水位时才加锁，保证只投递一次命令 */
+	CReentrantCriSecLock locallock(pSocketObj->csSend);
+
+	if(pSocketObj->highWater)
+		return;
+
+	/* 由工作线程触发 OnSendBufferHigh 事件，此后的发送请求均失败，直到缓冲区回落到低水位 */
+	pSocketObj->highWater = TRUE;
+
+	VERIFY(SendCommand(pSocketObj, DISP_CMD_HIGH_WATER));
+}
+
+BOOL CTcpServer::SendCommand(TSocketObj* pSocketObj, USHORT usType, UINT_PTR lParam)
+{
+	/* 在 csSend 保护下读取连接所属工作线程并投递命令，避免与连接迁移交错（迁移前须等待已投递的命令执行完毕） */
+	CReentrantCriSecLock locallock(pSocketObj->csSend);
+
+	++pSocketObj->commands;
+
+	if(m_ioDispatcher.SendCommandByIndex(pSocketObj->index, usType, pSocketObj->connID, lParam))
+		return TRUE;
+
+	--pSocketObj->commands;
+
+	return FALSE;
+}
+
+BOOL CTcpServer::CheckDrained(TSocketObj* pSocketObj)
+{
+	if(!pSocketObj->highNotified)
+		return TRUE;
+
+	int iPending = 0;
+
+	{
+		CReentrantCriSecLock locallock(pSocketObj->csSend);
+
+		iPending = pSocketObj->Pending();
+
+		if(iPending > (int)m_dwSendLowWatermark)
+			return TRUE;
+
+		pSocketObj->highWater	 = FALSE;
+		pSocketObj->highNotified = FALSE;
+	}
+
+	if(TRIGGER(FireSendBufferDrained(pSocketObj, iPending)) == HR_ERROR)
+	{
+		TRACE("<S-CNNID: %zu> OnSendBufferDrained() event return 'HR_ERROR', connection will be closed !", pSocketObj->connID);
+
+		AddFreeSocketObj(pSocketObj, SCF_ERROR, SO_SEND, ENSURE_ERROR_CANCELLED);
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+int CTcpServer::SendDirect(TSocketObj* pSocketObj, const WSABUF pBuffers[], int iCount)
+{
+	int rc = ::WriteBuffers(pSocketObj->socket, pBuffers, iCount);
+
+	/* 发送失败时缓存全部数据，由工作线程继续发送或处理错误 */
+	if(rc <= 0)
+		return 0;
+
+	/* 直接发送的数据在调用线程中触发 OnSend 事件（调用者持有 csSend） */
+	for(int i = 0, remain = rc; remain > 0; i++)
+	{
+		int iSent = MIN(remain, (int)pBuffers[i].len);
+
+		if(iSent > 0 && TRIGGER(FireSend(pSocketObj, (BYTE*)pBuffers[i].buf, iSent)) == HR_ERROR)
+		{
+			TRACE("<S-CNNID: %zu> OnSend() event should not return 'HR_ERROR' !!", pSocketObj->connID);
+			ASSERT(FALSE);
+		}
+
+		remain -= iSent;
+	}
+
+	return rc;
+}
+
 BOOL CTcpServer::SendSmallFile(CONNID dwConnID, LPCTSTR lpszFileName, const LPWSABUF pHead, const LPWSABUF pTail)
 {
 	CFile file;
@@ -1185,3 +1961,87 @@ BOOL CTcpServer::SendSmallFile(CONNID dwConnID, LPCTSTR lpszFileName, const LPWS
 
 	return SendPackets(dwConnID, szBuf, 3);
 }
+
+BOOL CTcpServer::SendFile(CONNID dwConnID, LPCTSTR lpszFileName, ULONGLONG ullOffset, ULONGLONG ullLength, const LPWSABUF pHead, const LPWSABUF pTail, Fn_SendBufferRelease fnComplete, PVOID pvArg)
+{
+	CFile file;
+	HRESULT hr = ::OpenSendFile(lpszFileName, file, ullOffset, ullLength);
+
+	if(FAILED(hr))
+	{
+		::InvokeSendBufferRelease(fnComplete, pvArg);
+		::SetLastError(hr);
+
+		return FALSE;
+	}
+
+	return DoSendFile(dwConnID, file, ullOffset, ullLength, pHead, pTail, fnComplete, pvArg);
+}
+
+BOOL CTcpServer::DoSendFile(CONNID dwConnID, CFile& file, ULONGLONG ullOffset, ULONGLONG ullLength, const LPWSABUF pHead, const LPWSABUF pTail, Fn_SendBufferRelease fnComplete, PVOID pvArg)
+{
+	/* 需要对发送数据进行加密的连接不能通过 sendfile() 直接发送文件 */
+	if(IsSecure())
+		return SendFileByPackets(dwConnID, file, ullOffset, ullLength, pHead, pTail, fnComplete, pvArg);
+
+	int result = NO_ERROR;
+	TSocketObj* pSocketObj = FindSocketObj(dwConnID);
+
+	if(!TSocketObj::IsValid(pSocketObj))
+		result = ERROR_OBJECT_NOT_FOUND;
+	else if(pSocketObj->highWater)
+		result = ERROR_NOT_ENOUGH_QUOTA;
+	else
+	{
+		CLocalSafeCounter localcounter(*pSocketObj);
+
+		if(m_enSendPolicy == SP_DIRECT || pSocketObj->coalesce > 0)
+		{
+			CReentrantCriSecLock locallock(pSocketObj->csSend);
+			result = SendFileInternal(pSocketObj, file, ullOffset, ullLength, pHead, pTail, fnComplete, pvArg);
+		}
+		else
+			result = SendFileInternal(pSocketObj, file, ullOffset, ullLength, pHead, pTail, fnComplete, pvArg);
+
+		if(result != NO_ERROR)
+			::SetLastError(result);
+
+		return (result == NO_ERROR);
+	}
+
+	::InvokeSendBufferRelease(fnComplete, pvArg);
+	::SetLastError(result);
+
+	return FALSE;
+}
+
+BOOL CTcpServer::SendFileByPackets(CONNID dwConnID, CFile& file, ULONGLONG ullOffset, ULONGLONG ullLength, const LPWSABUF pHead, const LPWSABUF pTail, Fn_SendBufferRelease fnComplete, PVOID pvArg)
+{
+	CBufferPtr buffer;
+	HRESULT hr = ::ReadSendFile(file, ullOffset, ullLength, buffer);
+	BOOL isOK  = FALSE;
+
+	if(SUCCEEDED(hr))
+	{
+		WSABUF szBuf[3];
+
+		szBuf[1].len = (UINT)buffer.Size();
+		szBuf[1].buf = buffer.Ptr();
+
+		if(pHead) memcpy(&szBuf[0], pHead, sizeof(WSABUF));
+		else	  memset(&szBuf[0], 0, sizeof(WSABUF));
+
+		if(pTail) memcpy(&szBuf[2], pTail, sizeof(WSABUF));
+		else	  memset(&szBuf[2], 0, sizeof(WSABUF));
+
+		isOK = SendPackets(dwConnID, szBuf, 3);
+	}
+
+	/* 文件数据已复制到发送缓冲区 */
+	::InvokeSendBufferRelease(fnComplete, pvArg);
+
+	if(FAILED(hr))
+		::SetLastError(hr);
+
+	return isOK;
+}
@@ -96,7 +96,7 @@ private:
 public:
 	CUdpArqServer(IUdpServerListener* pListener)
 	: CUdpServer(pListener)
-	, m_ssPool	(this)
+	, m_ssPool	(this, m_ioDispatcher)
 	, m_dwMtu	(0)
 	{
 		
@@ -48,6 +48,7 @@ public:
 	virtual EnSocketError GetLastError	()	{return m_enLastError;}
 	virtual LPCTSTR GetLastErrorDesc	()	{return ::GetSocketErrorDesc(m_enLastError);}
 	virtual BOOL GetPendingDataLength	(int& iPending);
+	virtual BOOL GetWorkerStats			(TWorkerStats pStats[], DWORD& dwCount)	{return m_ioDispatcher.GetStats(pStats, dwCount);}
 
 private:
 	virtual BOOL OnBeforeProcessIo(const TDispContext* pContext, PVOID pv, UINT events)			override;
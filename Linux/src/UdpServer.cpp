@@ -72,7 +72,8 @@ BOOL CUdpServer::CheckParams()
 		((int)m_dwMaxDatagramSize > 0 && m_dwMaxDatagramSize <= MAXIMUM_UDP_MAX_DATAGRAM_SIZE)	&&
 		((int)m_dwPostReceiveCount > 0)															&&
 		((int)m_dwDetectAttempts >= 0)															&&
-		((int)m_dwDetectInterval >= 1000 || m_dwDetectInterval == 0)							)
+		((int)m_dwDetectInterval >= 1000 || m_dwDetectInterval == 0)						&&
+		(::MakeCpuAffinityList(m_enCpuAffinityPolicy, m_strCpuAffinityList, m_vtCpus))			)
 		return TRUE;
 
 	SetLastError(SE_INVALID_PARAM, __FUNCTION__, ERROR_INVALID_PARAMETER);
@@ -159,6 +160,9 @@ BOOL CUdpServer::CreateListenSocket(LPCTSTR lpszBindAddress, USHORT usPort)
 		::fcntl_SETFL(soListen, O_NOATIME | O_NONBLOCK | O_CLOEXEC);
 		VERIFY(IS_NO_ERROR(::SSO_ReuseAddress(soListen, m_enReusePolicy)));
 
+		if(!m_vtCpus.empty())
+			::SSO_IncomingCpu(soListen, m_vtCpus[i % m_vtCpus.size()]);
+
 		if(IS_HAS_ERROR(::bind(soListen, addr.Addr(), addr.AddrSize())))
 		{
 			SetLastError(SE_SOCKET_BIND, __FUNCTION__, ::WSAGetLastError());
@@ -183,7 +187,7 @@ BOOL CUdpServer::CreateWorkerThreads()
 #endif
 														;
 
-	if(!m_ioDispatcher.Start(this, m_dwPostReceiveCount, dwWorkerThreadCount))
+	if(!m_ioDispatcher.Start(this, m_dwPostReceiveCount, dwWorkerThreadCount, FALSE, m_vtCpus))
 	{
 		SetLastError(SE_WORKER_THREAD_CREATE, __FUNCTION__, ::WSAGetLastError());
 		return FALSE;
@@ -406,7 +410,7 @@ void CUdpServer::AddFreeSocketObj(TUdpSocketObj* pSocketObj, EnSocketCloseFlag e
 		m_mpClientAddr.erase(&pSocketObj->remoteAddr);
 	}
 
-	m_ioDispatcher.DelTimer(pSocketObj->index, pSocketObj->fdTimer);
+	m_ioDispatcher.KillTimer(&pSocketObj->timer);
 	TUdpSocketObj::Release(pSocketObj);
 
 #ifndef USE_EXTERNAL_GC
@@ -437,7 +441,12 @@ void CUdpServer::AddClientSocketObj(int idx, CONNID dwConnID, TUdpSocketObj* pSo
 	pSocketObj->activeTime	= pSocketObj->connTime;
 
 	if(IsNeedDetectConnection())
-		pSocketObj->fdTimer = m_ioDispatcher.AddTimer(pSocketObj->index, m_dwDetectInterval, pSocketObj);
+	{
+		pSocketObj->timer.fn = DetectConnection;
+		pSocketObj->timer.pv = pSocketObj;
+
+		VERIFY(m_ioDispatcher.SetTimer(pSocketObj->index, &pSocketObj->timer, m_dwDetectInterval, m_dwDetectInterval));
+	}
 
 	remoteAddr.Copy(pSocketObj->remoteAddr);
 	pSocketObj->SetConnected();
@@ -801,6 +810,25 @@ BOOL CUdpServer::PauseReceive(CONNID dwConnID, BOOL bPause)
 	return FALSE;
 }
 
+BOOL CUdpServer::Post(CONNID dwConnID, Fn_ConnTaskProc fnProc, PVOID pvArg)
+{
+	if(fnProc == nullptr)
+	{
+		::SetLastError(ERROR_INVALID_PARAMETER);
+		return FALSE;
+	}
+
+	TUdpSocketObj* pSocketObj = FindSocketObj(dwConnID);
+
+	if(!TUdpSocketObj::IsValid(pSocketObj))
+	{
+		::SetLastError(ERROR_OBJECT_NOT_FOUND);
+		return FALSE;
+	}
+
+	return m_ioDispatcher.SendCommandByIndex(pSocketObj->index, DISP_CMD_POST, dwConnID, (UINT_PTR)TConnTask::Construct(fnProc, pvArg));
+}
+
 BOOL CUdpServer::OnBeforeProcessIo(const TDispContext* pContext, PVOID pv, UINT events)
 {
 	if(pv == &m_soListens[pContext->GetIndex()])
@@ -813,9 +841,6 @@ BOOL CUdpServer::OnBeforeProcessIo(const TDispContext* pContext, PVOID pv, UINT
 		return FALSE;
 	}
 
-	if(!(events & _EPOLL_ALL_ERROR_EVENTS))
-		DetectConnection(pv);
-
 	return FALSE;
 }
 
@@ -839,9 +864,18 @@ VOID CUdpServer::OnCommand(const TDispContext* pContext, TDispCommand* pCmd)
 	case DISP_CMD_TIMEOUT:
 		HandleCmdTimeout(dwConnID);
 		break;
+	case DISP_CMD_POST:
+		HandleCmdPost(dwConnID, (TConnTask*)(pCmd->lParam));
+		break;
 	}
 }
 
+VOID CUdpServer::OnDropCommand(TDispCommand* pCmd)
+{
+	if(pCmd->type == DISP_CMD_POST)
+		TConnTask::Execute((TConnTask*)(pCmd->lParam), (CONNID)(pCmd->wParam), FALSE);
+}
+
 VOID CUdpServer::HandleCmdDisconnect(CONNID dwConnID, BOOL bForce)
 {
 	AddFreeSocketObj(FindSocketObj(dwConnID), SCF_CLOSE);
@@ -852,6 +886,11 @@ VOID CUdpServer::HandleCmdTimeout(CONNID dwConnID)
 	AddFreeSocketObj(FindSocketObj(dwConnID), SCF_CLOSE, SO_UNKNOWN, 0, FALSE);
 }
 
+VOID CUdpServer::HandleCmdPost(CONNID dwConnID, TConnTask* pTask)
+{
+	TConnTask::Execute(pTask, dwConnID, TUdpSocketObj::IsValid(FindSocketObj(dwConnID)));
+}
+
 BOOL CUdpServer::OnReadyRead(const TDispContext* pContext, PVOID pv, UINT events)
 {
 	return HandleReceive(pContext, RETRIVE_EVENT_FLAG_H(events));
@@ -1220,11 +1259,9 @@ void CUdpServer::DetectConnection(PVOID pv)
 		CUdpServer* pServer = (CUdpServer*)pSocketObj->pHolder;
 
 		if(pSocketObj->detectFails >= pServer->m_dwDetectAttempts)
-			VERIFY(m_ioDispatcher.SendCommandByIndex(pSocketObj->index, DISP_CMD_TIMEOUT, pSocketObj->connID));
+			VERIFY(pServer->m_ioDispatcher.SendCommandByIndex(pSocketObj->index, DISP_CMD_TIMEOUT, pSocketObj->connID));
 		else
 			::InterlockedIncrement(&pSocketObj->detectFails);
-
-		::ReadTimer(pSocketObj->fdTimer);
 	}
 }
 
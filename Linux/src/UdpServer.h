@@ -41,6 +41,7 @@ public:
 	virtual BOOL Send	(CONNID dwConnID, const BYTE* pBuffer, int iLength, int iOffset = 0);
 	virtual BOOL SendPackets	(CONNID dwConnID, const WSABUF pBuffers[], int iCount);
 	virtual BOOL PauseReceive	(CONNID dwConnID, BOOL bPause = TRUE);
+	virtual BOOL Post			(CONNID dwConnID, Fn_ConnTaskProc fnProc, PVOID pvArg);
 	virtual BOOL Wait			(DWORD dwMilliseconds = INFINITE) {return m_evWait.WaitFor(dwMilliseconds, WAIT_FOR_STOP_PREDICATE);}
 	virtual BOOL			HasStarted					()	{return m_enState == SS_STARTED || m_enState == SS_STARTING;}
 	virtual EnServiceState	GetState					()	{return m_enState;}
@@ -56,6 +57,7 @@ public:
 	virtual BOOL GetPendingDataLength	(CONNID dwConnID, int& iPending);
 	virtual DWORD GetConnectionCount	();
 	virtual BOOL GetAllConnectionIDs	(CONNID pIDs[], DWORD& dwCount);
+	virtual BOOL GetWorkerStats			(TWorkerStats pStats[], DWORD& dwCount)	{return m_ioDispatcher.GetStats(pStats, dwCount);}
 	virtual BOOL GetConnectPeriod		(CONNID dwConnID, DWORD& dwPeriod);
 	virtual BOOL GetSilencePeriod		(CONNID dwConnID, DWORD& dwPeriod);
 	virtual EnSocketError GetLastError	()	{return m_enLastError;}
@@ -65,6 +67,7 @@ private:
 	virtual BOOL OnBeforeProcessIo(const TDispContext* pContext, PVOID pv, UINT events)			override;
 	virtual VOID OnAfterProcessIo(const TDispContext* pContext, PVOID pv, UINT events, BOOL rs)	override;
 	virtual VOID OnCommand(const TDispContext* pContext, TDispCommand* pCmd)					override;
+	virtual VOID OnDropCommand(TDispCommand* pCmd)												override;
 	virtual BOOL OnReadyRead(const TDispContext* pContext, PVOID pv, UINT events)				override;
 	virtual BOOL OnReadyWrite(const TDispContext* pContext, PVOID pv, UINT events)				override;
 	virtual BOOL OnHungUp(const TDispContext* pContext, PVOID pv, UINT events)					override;
@@ -93,6 +96,7 @@ public:
 	virtual void SetDetectAttempts			(DWORD dwDetectAttempts)		{ENSURE_HAS_STOPPED(); m_dwDetectAttempts			= dwDetectAttempts;}
 	virtual void SetDetectInterval			(DWORD dwDetectInterval)		{ENSURE_HAS_STOPPED(); m_dwDetectInterval			= dwDetectInterval;}
 	virtual void SetMarkSilence				(BOOL bMarkSilence)				{ENSURE_HAS_STOPPED(); m_bMarkSilence				= bMarkSilence;}
+	virtual void SetCpuAffinity				(EnCpuAffinityPolicy enPolicy, LPCTSTR lpszCpuList = nullptr)	{ENSURE_HAS_STOPPED(); m_enCpuAffinityPolicy = enPolicy; m_strCpuAffinityList = (lpszCpuList ? lpszCpuList : _T(""));}
 
 	virtual EnReuseAddressPolicy GetReuseAddressPolicy	()	{return m_enReusePolicy;}
 	virtual EnSendPolicy GetSendPolicy					()	{return m_enSendPolicy;}
@@ -109,6 +113,8 @@ public:
 	virtual DWORD GetDetectAttempts			()	{return m_dwDetectAttempts;}
 	virtual DWORD GetDetectInterval			()	{return m_dwDetectInterval;}
 	virtual BOOL  IsMarkSilence				()	{return m_bMarkSilence;}
+	virtual EnCpuAffinityPolicy GetCpuAffinityPolicy	()	{return m_enCpuAffinityPolicy;}
+	virtual LPCTSTR GetCpuAffinityList					()	{return m_strCpuAffinityList;}
 
 protected:
 	virtual EnHandleResult FirePrepareListen(SOCKET soListen)
@@ -207,6 +213,7 @@ private:
 	VOID HandleCmdSend		(CONNID dwConnID, int flag);
 	VOID HandleCmdDisconnect(CONNID dwConnID, BOOL bForce);
 	VOID HandleCmdTimeout	(CONNID dwConnID);
+	VOID HandleCmdPost		(CONNID dwConnID, TConnTask* pTask);
 
 	CONNID HandleAccept		(const TDispContext* pContext, HP_SOCKADDR& addr);
 	BOOL HandleReceive		(const TDispContext* pContext, int flag = 0);
@@ -216,7 +223,7 @@ private:
 
 	BOOL SendItem			(TUdpSocketObj* pSocketObj, TItem* pItem, BOOL& bBlocked);
 
-	void DetectConnection		(PVOID pv);
+	static void DetectConnection(PVOID pv);
 	BOOL IsNeedDetectConnection	() const {return m_dwDetectAttempts > 0 && m_dwDetectInterval > 0;}
 
 public:
@@ -240,6 +247,7 @@ public:
 	, m_dwDetectAttempts		(DEFAULT_UDP_DETECT_ATTEMPTS)
 	, m_dwDetectInterval		(DEFAULT_UDP_DETECT_INTERVAL)
 	, m_bMarkSilence			(TRUE)
+	, m_enCpuAffinityPolicy		(CAP_NONE)
 	{
 		ASSERT(m_pListener);
 	}
@@ -265,9 +273,13 @@ private:
 	DWORD m_dwDetectAttempts;
 	DWORD m_dwDetectInterval;
 	BOOL  m_bMarkSilence;
+	EnCpuAffinityPolicy m_enCpuAffinityPolicy;
+	CString m_strCpuAffinityList;
+	vector<int> m_vtCpus;
 
 protected:
 	CBufferObjPool			m_bfObjPool;
+	CIODispatcher			m_ioDispatcher;
 
 private:
 	CSEM					m_evWait;
@@ -294,8 +306,6 @@ private:
 	TUdpSocketObjPtrQueue	m_lsGCSocket;
 
 	CSendQueuesPtr			m_quSends;
-
-	CIODispatcher			m_ioDispatcher;
 };
 
 #endif
@@ -104,6 +104,77 @@ void TItem::Reset(int first, int last)
 	if(last >= 0)	end		= head + MIN(last, capacity);
 }
 
+int TItem::Attach(const BYTE* pData, int length)
+{
+	ASSERT(IsEmpty() && !attached);
+	ASSERT(pData != nullptr && length > 0);
+
+	attached = true;
+	begin	 = (BYTE*)pData;
+	end		 = begin + length;
+
+	return length;
+}
+
+LONGLONG TItem::AttachFile(FD fd, LONGLONG offset, LONGLONG length)
+{
+	ASSERT(IsEmpty() && !attached);
+	ASSERT(IS_VALID_FD(fd) && offset >= 0 && length > 0);
+
+	attached	= true;
+	file		= fd;
+	fileOffset	= offset;
+	fileRemain	= length;
+
+	return length;
+}
+
+LONGLONG TItem::ReduceFile(LONGLONG length)
+{
+	ASSERT(length >= 0);
+
+	LONGLONG reduce = MIN(fileRemain, length);
+	fileOffset	   += reduce;
+	fileRemain	   -= reduce;
+
+	return reduce;
+}
+
+void TItem::Detach()
+{
+	if(IsFile())
+	{
+		int iErrno = errno;
+
+		close(file);
+
+		file		= INVALID_FD;
+		fileOffset	= 0;
+		fileRemain	= 0;
+		errno		= iErrno;
+	}
+
+	if(fnRelease != nullptr)
+	{
+		Fn_SendBufferRelease fn = fnRelease;
+		int iErrno				= errno;
+
+		fnRelease = nullptr;
+		fn(pvRelease);
+
+		errno = iErrno;
+	}
+
+	if(attached)
+	{
+		attached = false;
+		begin	 = head;
+		end		 = head;
+	}
+
+	pinned = false;
+}
+
 TBuffer* TBuffer::Construct(CBufferPool& pool, ULONG_PTR dwID)
 {
 	ASSERT(dwID != 0);
@@ -173,6 +244,12 @@ int TBuffer::Reduce(int len)
 	return reduce;
 }
 
+int TBuffer::CommitTail(int len, TItem* pSpare)
+{
+	items.CommitTail(len, pSpare);
+	return IncreaseLength(len);
+}
+
 void CBufferPool::PutFreeBuffer(ULONG_PTR dwID)
 {
 	ASSERT(dwID != 0);
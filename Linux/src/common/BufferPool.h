@@ -23,13 +23,15 @@
 
 #pragma once
 
-#include "../../include/hpsocket/GlobalDef.h"
+#include "../../include/hpsocket/HPTypeDef.h"
 #include "Singleton.h"
 #include "STLHelper.h"
 #include "RingBuffer.h"
 #include "PrivateHeap.h"
 #include "CriSec.h"
 
+#include <sys/uio.h>
+
 template<class T> T* ConstructItemT(T*, CPrivateHeap& heap, int capacity, BYTE* pData, int length)
 {
 	ASSERT(capacity > 0);
@@ -56,6 +58,7 @@ struct TItem
 	template<typename T> friend struct	TSimpleList;
 	template<typename T> friend class	CNodePoolT;
 	template<typename T> friend struct	TItemListT;
+	template<typename T> friend struct	TItemQueueT;
 
 	friend struct						TBuffer;
 
@@ -67,13 +70,31 @@ public:
 	int Increase(int length);
 	int Reduce	(int length);
 	void Reset	(int first = 0, int last = 0);
+	int Attach	(const BYTE* pData, int length);
+	void Detach	();
+
+	LONGLONG AttachFile	(FD fd, LONGLONG offset, LONGLONG length);
+	LONGLONG ReduceFile	(LONGLONG length);
+
+	void SetReleaser(Fn_SendBufferRelease fn, PVOID pv)	{ASSERT(fnRelease == nullptr); fnRelease = fn; pvRelease = pv;}
+	void MoveReleaser(TItem* pOther)					{pOther->SetReleaser(fnRelease, pvRelease); fnRelease = nullptr; pvRelease = nullptr;}
+	bool HasReleaser() const							{return fnRelease != nullptr;}
+
+	void Pin		(UINT s)			{pinned = true; seq = s;}
+	bool IsPinned	()	const			{return pinned;}
+	UINT GetSeq		()	const			{return seq;}
+
+	bool		IsFile		()	const	{return file != INVALID_FD;}
+	FD			GetFile		()	const	{return file;}
+	LONGLONG	FileOffset	()	const	{return fileOffset;}
+	LONGLONG	FileRemain	()	const	{return fileRemain;}
 
 	BYTE*		Ptr		()			{return begin;}
 	const BYTE*	Ptr		()	const	{return begin;}
 	int			Size	()	const	{return (int)(end - begin);}
-	int			Remain	()	const	{return capacity - (int)(end - head);}
+	int			Remain	()	const	{return attached ? 0 : capacity - (int)(end - head);}
 	int			Capacity()	const	{return capacity;}
-	bool		IsEmpty	()	const	{return Size()	 == 0;}
+	bool		IsEmpty	()	const	{return Size()	 == 0 && fileRemain == 0;}
 	bool		IsFull	()	const	{return Remain() == 0;}
 	CPrivateHeap& GetPrivateHeap()	{return heap;}
 
@@ -96,12 +117,14 @@ public:
 
 	TItem(CPrivateHeap& hp, BYTE* pHead, int cap = DEFAULT_ITEM_CAPACITY, BYTE* pData = nullptr, int length = 0)
 	: heap(hp), head(pHead), begin(pHead), end(pHead), capacity(cap), next(nullptr), last(nullptr)
+	, attached(false), fnRelease(nullptr), pvRelease(nullptr), pinned(false), seq(0)
+	, file(INVALID_FD), fileOffset(0), fileRemain(0)
 	{
 		if(pData != nullptr && length != 0)
 			Cat(pData, length);
 	}
 
-	~TItem() {}
+	~TItem() {Detach();}
 
 	DECLARE_NO_COPY_CLASS(TItem)
 
@@ -119,10 +142,23 @@ private:
 	BYTE*	head;
 	BYTE*	begin;
 	BYTE*	end;
+
+	bool					attached;
+	Fn_SendBufferRelease	fnRelease;
+	PVOID					pvRelease;
+
+	bool					pinned;
+	UINT					seq;
+
+	FD						file;
+	LONGLONG				fileOffset;
+	LONGLONG				fileRemain;
 };
 
 template<class T> struct TSimpleList
 {
+	template<typename U> friend struct TItemQueueT;
+
 public:
 	T* PushFront(T* pItem)
 	{
@@ -281,6 +317,8 @@ public:
 	{
 		ASSERT(pItem != nullptr);
 
+		pItem->Detach();
+
 		if(!m_lsFreeItem.TryPut(pItem))
 			T::Destruct(pItem);
 	}
@@ -401,6 +439,16 @@ public:
 		return length;
 	}
 
+	int Attach(const BYTE* pData, int length)
+	{
+		T* pItem = itPool.PickFreeItem();
+		pItem->Attach(pData, length);
+
+		__super::PushBack(pItem);
+
+		return length;
+	}
+
 	int Cat(const T* pItem)
 	{
 		return Cat(pItem->Ptr(), pItem->Size());
@@ -454,6 +502,88 @@ public:
 		return length - remain;
 	}
 
+	/* 获取从第 offset 字节开始、覆盖 length 字节数据的连续内存段（最多填充 count 个），返回所需内存段数量 */
+	int GetViews(WSABUF bufs[], int count, int length, int offset = 0) const
+	{
+		int i		= 0;
+		T* pItem	= __super::Front();
+
+		for(; pItem != nullptr && offset >= pItem->Size(); pItem = pItem->next)
+			offset -= pItem->Size();
+
+		for(; length > 0 && pItem != nullptr; i++, pItem = pItem->next, offset = 0)
+		{
+			int len = MIN(length, pItem->Size() - offset);
+
+			if(i < count)
+			{
+				bufs[i].buf = pItem->Ptr() + offset;
+				bufs[i].len = (UINT)len;
+			}
+
+			length -= len;
+		}
+
+		return i;
+	}
+
+	/* 以尾节点剩余空间和一个新节点作为读取缓冲区（新节点暂不加入链表），返回缓冲区数量 */
+	int ReserveTail(iovec vecs[2], T*& pSpare)
+	{
+		int i		= 0;
+		T* pItem	= __super::Back();
+
+		if(pItem != nullptr && !pItem->IsFull())
+		{
+			vecs[i].iov_base	= pItem->end;
+			vecs[i++].iov_len	= pItem->Remain();
+		}
+
+		pSpare = itPool.PickFreeItem();
+
+		vecs[i].iov_base	= pSpare->end;
+		vecs[i++].iov_len	= pSpare->Remain();
+
+		return i;
+	}
+
+	/* 把读取到 ReserveTail() 缓冲区中的 length 字节数据计入链表，未使用的新节点放回对象池 */
+	int CommitTail(int length, T* pSpare)
+	{
+		int remain	= length;
+		T* pItem	= __super::Back();
+
+		if(pItem != nullptr && remain > 0)
+			remain -= pItem->Increase(remain);
+
+		if(remain > 0)
+		{
+			pSpare->Increase(remain);
+			__super::PushBack(pSpare);
+		}
+		else
+			itPool.PutFreeItem(pSpare);
+
+		return length;
+	}
+
+	int GetIoVecs(iovec vecs[], int count, int breakSize = 0) const
+	{
+		int i		= 0;
+		T* pItem	= __super::Front();
+
+		for(; i < count && pItem != nullptr; i++, pItem = pItem->next)
+		{
+			if(pItem->IsFile() || (breakSize > 0 && i > 0 && pItem->Size() >= breakSize))
+				break;
+
+			vecs[i].iov_base = pItem->Ptr();
+			vecs[i].iov_len	 = pItem->Size();
+		}
+
+		return i;
+	}
+
 	int Increase(int length)
 	{
 		int remain = length;
@@ -588,6 +718,14 @@ public:
 		return cat;
 	}
 
+	int Attach(const BYTE* pData, int length)
+	{
+		int cat = __super::Attach(pData, length);
+		this->length += cat;
+
+		return cat;
+	}
+
 	int Cat(const T* pItem)
 	{
 		int cat = __super::Cat(pItem->Ptr(), pItem->Size());
@@ -652,6 +790,436 @@ private:
 using TItemListEx	= TItemListExT<TItem>;
 using TItemListExV	= TItemListExT<TItem, volatile int>;
 
+/* 多生产者、单消费者发送队列，由数据块链组成：
+   生产者以 CAS 在当前打开的数据块中预留空间并复制小数据，复制完毕后原子增加该数据块的已提交长度；
+   其它数据由生产者先组装成数据块链，再以 CAS 封闭当前数据块并把数据块链接在队列末尾。
+   消费者不加锁沿数据块链读取：数据块封闭（由生产者切换或由消费者关闭）并且已全部提交后整块移入发送列表，无需再次复制 */
+template<class T> struct TItemQueueT
+{
+private:
+	/* 状态中的偏移量特殊值：没有打开的数据块、队列末尾为数据块链、正在切换、队列已关闭 */
+	static const UINT OFF_CLOSED	= 0xFFFFFFFF;
+	static const UINT OFF_TAIL		= 0xFFFFFFFE;
+	static const UINT OFF_SWITCH	= 0xFFFFFFFD;
+	static const UINT OFF_SHUT		= 0xFFFFFFFC;
+
+	/* 已提交长度中表示消费者正在等待的标志位 */
+	static const UINT COMMIT_WAIT	= 0x80000000;
+
+	/* 数据块头部：已提交的偏移量、封闭时的偏移量（0 表示尚未封闭）、数据块代数；数据从头部之后开始复制 */
+	struct TChunkHead
+	{
+		UINT commit;
+		UINT seal;
+		UINT gen;
+	};
+
+	static const int CHUNK_HEAD_SIZE = sizeof(TChunkHead);
+
+public:
+	/* 复制数据到当前数据块（跳过 iSkip 字节后共 iLength 字节，须满足 CanCopy()），返回 FALSE 表示队列已关闭；
+	   bWait 返回消费者是否正在等待本次提交的数据（调用者需要唤醒消费者） */
+	BOOL PushCopy(const WSABUF pBuffers[], int iCount, int iSkip, int iLength, BOOL& bWait)
+	{
+		ASSERT(CanCopy(iLength));
+
+		T* pChunk;
+		UINT uiOffset;
+
+		if(!Reserve(iLength, pChunk, uiOffset))
+			return FALSE;
+
+		BYTE* pData = pChunk->head + uiOffset;
+
+		for(int i = 0; i < iCount; i++)
+		{
+			int iCut = MIN(iSkip, (int)pBuffers[i].len);
+			int iCat = (int)pBuffers[i].len - iCut;
+			iSkip	-= iCut;
+
+			if(iCat > 0)
+			{
+				memcpy(pData, (const BYTE*)pBuffers[i].buf + iCut, iCat);
+				pData += iCat;
+			}
+		}
+
+		UINT uiCommit = __atomic_fetch_add(&Head(pChunk)->commit, (UINT)iLength, __ATOMIC_ACQ_REL);
+		bWait		  = ((uiCommit & COMMIT_WAIT) != 0);
+
+		return TRUE;
+	}
+
+	/* 把 lsItem 中的数据块链整体接在队列末尾（lsItem 随后为空），返回 FALSE 表示队列已关闭（lsItem 保持不变） */
+	BOOL Push(TSimpleList<T>& lsItem)
+	{
+		ASSERT(!lsItem.IsEmpty());
+
+		for(UINT i = 0; ; i++)
+		{
+			ULONGLONG ullState = m_ullState.load(memory_order_acquire);
+
+			if(StateOffset(ullState) == OFF_SHUT)
+				return FALSE;
+			if(StateOffset(ullState) == OFF_SWITCH)
+				::YieldThread(i);
+			else if(Switch(ullState, &lsItem))
+				return TRUE;
+		}
+	}
+
+	/* 按压入顺序取出全部可发送的数据块，追加到 lsItem 末尾（仅由消费者调用），返回是否取出了数据；
+	   遇到仍有生产者正在复制数据的数据块时，如果 lsItem 已没有待发送的数据则标记等待，由提交数据的生产者唤醒消费者 */
+	BOOL Pop(TItemListT<T>& lsItem)
+	{
+		BOOL isOK = FALSE;
+		m_bWait	  = FALSE;
+
+		while(m_pRead != nullptr || OpenRead())
+		{
+			T* pItem = m_pRead;
+
+			if(m_bChunk)
+			{
+				SealRead();
+
+				UINT* pCommit = &Head(pItem)->commit;
+				UINT uiCommit = __atomic_load_n(pCommit, __ATOMIC_ACQUIRE);
+
+				if((uiCommit & ~COMMIT_WAIT) != m_uiSeal)
+				{
+					if(!lsItem.IsEmpty())
+						break;
+
+					if((uiCommit & COMMIT_WAIT) != 0 || __atomic_compare_exchange_n(pCommit, &uiCommit, uiCommit | COMMIT_WAIT, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+					{
+						m_bWait = TRUE;
+						break;
+					}
+
+					continue;
+				}
+
+				UINT uiSeal = m_uiSeal;
+				NextRead(m_pNext);
+
+				pItem->next = nullptr;
+
+				if(uiSeal == CHUNK_HEAD_SIZE)
+				{
+					itPool.PutFreeItem(pItem);
+					continue;
+				}
+
+				pItem->Reset(CHUNK_HEAD_SIZE, uiSeal);
+			}
+			else
+			{
+				T* pNext = __atomic_load_n(&pItem->next, __ATOMIC_ACQUIRE);
+
+				if(pNext == nullptr && !CloseTail())
+					continue;
+
+				NextRead(pNext);
+
+				pItem->next = nullptr;
+			}
+
+			lsItem.PushBack(pItem);
+			isOK = TRUE;
+		}
+
+		return isOK;
+	}
+
+	/* 关闭队列并丢弃全部数据（由消费者所在线程调用），此后压入均失败，直到调用 Reset()；
+	   等待已预留空间的生产者提交数据后再释放数据块 */
+	void Close()
+	{
+		ULONGLONG ullState;
+
+		for(UINT i = 0; ; i++)
+		{
+			ullState = m_ullState.load(memory_order_acquire);
+
+			if(StateOffset(ullState) == OFF_SHUT)
+				return;
+			if(StateOffset(ullState) == OFF_SWITCH)
+			{
+				::YieldThread(i);
+				continue;
+			}
+
+			if(m_ullState.compare_exchange_weak(ullState, MakeState(StateGen(ullState), OFF_SHUT), memory_order_acq_rel, memory_order_relaxed))
+				break;
+		}
+
+		while(m_pRead != nullptr || OpenRead())
+		{
+			T* pItem = m_pRead;
+			T* pNext = nullptr;
+
+			if(m_bChunk)
+			{
+				TChunkHead* pHead = Head(pItem);
+
+				/* 没有封闭的数据块是关闭队列前打开的数据块 */
+				if(m_uiSeal == 0)
+				{
+					m_uiSeal = __atomic_load_n(&pHead->seal, __ATOMIC_ACQUIRE);
+					m_pNext	 = pItem->next;
+
+					if(m_uiSeal == 0)
+					{
+						m_uiSeal = StateOffset(ullState);
+						m_pNext	 = nullptr;
+					}
+				}
+
+				for(UINT i = 0; (__atomic_load_n(&pHead->commit, __ATOMIC_ACQUIRE) & ~COMMIT_WAIT) != m_uiSeal; i++)
+					::YieldThread(i);
+
+				pNext = m_pNext;
+			}
+			else
+				pNext = pItem->next;
+
+			NextRead(pNext);
+
+			pItem->next = nullptr;
+			itPool.PutFreeItem(pItem);
+		}
+
+		m_pOpen.store(nullptr, memory_order_relaxed);
+		m_pTail = nullptr;
+	}
+
+	/* 消费者是否正在等待生产者提交数据（仅由消费者调用）；等待期间无需监听写事件，提交数据的生产者会唤醒消费者 */
+	BOOL IsWaiting() const
+	{
+		return m_bWait && (__atomic_load_n(&Head(m_pRead)->commit, __ATOMIC_ACQUIRE) & ~COMMIT_WAIT) != m_uiSeal;
+	}
+
+	/* 重新打开已关闭的队列 */
+	void Reset()
+	{
+		ULONGLONG ullState = m_ullState.load(memory_order_acquire);
+
+		if(StateOffset(ullState) == OFF_SHUT)
+			m_ullState.store(MakeState(StateGen(ullState) + 1, OFF_CLOSED), memory_order_release);
+	}
+
+	/* 长度为 iLength 的数据是否可以复制到数据块中 */
+	BOOL CanCopy(int iLength) const
+	{
+		return iLength > 0 && CHUNK_HEAD_SIZE + iLength <= (int)itPool.GetItemCapacity();
+	}
+
+private:
+	/* 在当前数据块中预留 iLength 字节，队列已关闭时返回 FALSE */
+	BOOL Reserve(int iLength, T*& pChunk, UINT& uiOffset)
+	{
+		for(UINT i = 0; ; i++)
+		{
+			ULONGLONG ullState = m_ullState.load(memory_order_acquire);
+			uiOffset		   = StateOffset(ullState);
+
+			if(uiOffset == OFF_SHUT)
+				return FALSE;
+			if(uiOffset == OFF_SWITCH)
+			{
+				::YieldThread(i);
+				continue;
+			}
+
+			if(!IsOpen(uiOffset) || uiOffset + iLength > itPool.GetItemCapacity())
+			{
+				Switch(ullState, nullptr);
+				continue;
+			}
+
+			pChunk = m_pOpen.load(memory_order_acquire);
+
+			/* 状态中的代数在切换数据块时递增，CAS 成功说明 pChunk 就是预留空间所在的数据块 */
+			if(m_ullState.compare_exchange_weak(ullState, ullState + iLength, memory_order_acq_rel, memory_order_relaxed))
+				return TRUE;
+		}
+	}
+
+	/* 封闭当前数据块，在队列末尾接上新打开的数据块（pItems 为 nullptr 时）或 pItems 中的数据块链 */
+	BOOL Switch(ULONGLONG ullState, TSimpleList<T>* pItems)
+	{
+		UINT uiGen	  = StateGen(ullState);
+		UINT uiOffset = StateOffset(ullState);
+
+		if(!m_ullState.compare_exchange_strong(ullState, MakeState(uiGen, OFF_SWITCH), memory_order_acq_rel, memory_order_relaxed))
+			return FALSE;
+
+		T* pLink;
+		T* pChunk = nullptr;
+
+		if(pItems == nullptr)
+		{
+			pChunk = itPool.PickFreeItem();
+
+			TChunkHead* pHead = Head(pChunk);
+			pHead->commit	  = CHUNK_HEAD_SIZE;
+			pHead->seal		  = 0;
+			pHead->gen		  = uiGen + 1;
+
+			pLink = MakeLink(pChunk, TRUE);
+		}
+		else
+		{
+			pItems->pBack->next = nullptr;
+			pLink = MakeLink(pItems->pFront, FALSE);
+		}
+
+		if(uiOffset == OFF_CLOSED)
+			m_pFirst.store(pLink, memory_order_release);
+		else if(uiOffset == OFF_TAIL)
+			__atomic_store_n(&m_pTail->next, pLink, __ATOMIC_RELEASE);
+		else
+		{
+			T* pOpen	= m_pOpen.load(memory_order_relaxed);
+			pOpen->next	= pLink;
+
+			__atomic_store_n(&Head(pOpen)->seal, uiOffset, __ATOMIC_RELEASE);
+		}
+
+		if(pItems == nullptr)
+		{
+			m_pOpen.store(pChunk, memory_order_release);
+			m_ullState.store(MakeState(uiGen + 1, CHUNK_HEAD_SIZE), memory_order_release);
+		}
+		else
+		{
+			m_pTail = pItems->pBack;
+			pItems->Reset();
+
+			m_ullState.store(MakeState(uiGen + 1, OFF_TAIL), memory_order_release);
+		}
+
+		return TRUE;
+	}
+
+	/* 获取正在读取的数据块的封闭偏移量，数据块仍然打开时由消费者关闭（之后的生产者打开新数据块） */
+	void SealRead()
+	{
+		TChunkHead* pHead = Head(m_pRead);
+
+		for(UINT i = 0; m_uiSeal == 0; i++)
+		{
+			m_uiSeal = __atomic_load_n(&pHead->seal, __ATOMIC_ACQUIRE);
+
+			if(m_uiSeal != 0)
+			{
+				m_pNext = m_pRead->next;
+				break;
+			}
+
+			ULONGLONG ullState = m_ullState.load(memory_order_acquire);
+			UINT uiOffset	   = StateOffset(ullState);
+
+			if(uiOffset == OFF_SWITCH)
+				::YieldThread(i);
+			else if(StateGen(ullState) == pHead->gen && IsOpen(uiOffset) &&
+				m_ullState.compare_exchange_strong(ullState, MakeState(pHead->gen, OFF_CLOSED), memory_order_acq_rel, memory_order_relaxed))
+			{
+				m_uiSeal = uiOffset;
+				m_pNext	 = nullptr;
+			}
+		}
+	}
+
+	/* 正在读取的数据块链末尾没有后续数据时关闭队列末尾，返回 FALSE 表示已有后续数据（重新读取 next） */
+	BOOL CloseTail()
+	{
+		for(UINT i = 0; ; i++)
+		{
+			ULONGLONG ullState = m_ullState.load(memory_order_acquire);
+
+			if(StateOffset(ullState) == OFF_SWITCH)
+			{
+				::YieldThread(i);
+				continue;
+			}
+
+			if(StateOffset(ullState) != OFF_TAIL || __atomic_load_n(&m_pRead->next, __ATOMIC_ACQUIRE) != nullptr)
+				return FALSE;
+
+			return m_ullState.compare_exchange_strong(ullState, MakeState(StateGen(ullState), OFF_CLOSED), memory_order_acq_rel, memory_order_relaxed);
+		}
+	}
+
+	BOOL OpenRead()
+	{
+		T* pLink = m_pFirst.exchange(nullptr, memory_order_acquire);
+
+		if(pLink == nullptr)
+			return FALSE;
+
+		NextRead(pLink);
+
+		return TRUE;
+	}
+
+	void NextRead(T* pLink)
+	{
+		m_pRead	 = LinkItem(pLink);
+		m_bChunk = IsChunkLink(pLink);
+		m_uiSeal = 0;
+		m_pNext	 = nullptr;
+		m_bWait	 = FALSE;
+	}
+
+	/* 数据块链中的 next 指针最低位标记下一个数据块是否为复制数据的数据块 */
+	static T* MakeLink(T* pItem, BOOL bChunk)	{return (T*)((UINT_PTR)pItem | (bChunk ? 1 : 0));}
+	static T* LinkItem(T* pLink)				{return (T*)((UINT_PTR)pLink & ~(UINT_PTR)1);}
+	static BOOL IsChunkLink(T* pLink)			{return ((UINT_PTR)pLink & 1) != 0;}
+
+	static TChunkHead* Head(T* pChunk)			{return (TChunkHead*)pChunk->head;}
+
+	static BOOL IsOpen(UINT uiOffset)			{return uiOffset < OFF_SHUT;}
+
+	static ULONGLONG MakeState(UINT uiGen, UINT uiOffset)	{return ((ULONGLONG)uiGen << 32) | uiOffset;}
+	static UINT StateGen(ULONGLONG ullState)				{return (UINT)(ullState >> 32);}
+	static UINT StateOffset(ULONGLONG ullState)				{return (UINT)ullState;}
+
+public:
+	TItemQueueT(CNodePoolT<T>& pool)
+	: itPool(pool), m_ullState(MakeState(0, OFF_CLOSED)), m_pOpen(nullptr), m_pFirst(nullptr), m_pTail(nullptr)
+	, m_pRead(nullptr), m_bChunk(FALSE), m_uiSeal(0), m_pNext(nullptr), m_bWait(FALSE)
+	{
+	}
+
+	~TItemQueueT()
+	{
+		Close();
+	}
+
+	DECLARE_NO_COPY_CLASS(TItemQueueT)
+
+private:
+	CNodePoolT<T>&		itPool;
+
+	/* 高 32 位为当前数据块的代数，低 32 位为下一次预留的偏移量 */
+	atomic<ULONGLONG>	m_ullState;
+	/* 当前打开的数据块、队列为空时生产者接入的第一个数据块、队列末尾的数据块链（仅由切换中的生产者访问） */
+	atomic<T*>			m_pOpen;
+	atomic<T*>			m_pFirst;
+	T*					m_pTail;
+
+	/* 消费者正在读取的数据块、是否为复制数据的数据块、封闭偏移量、下一个数据块及是否正在等待该数据块提交 */
+	T*					m_pRead;
+	BOOL				m_bChunk;
+	UINT				m_uiSeal;
+	T*					m_pNext;
+	BOOL				m_bWait;
+};
+
+using TItemQueue	= TItemQueueT<TItem>;
+
 template<class T> struct TItemPtrT
 {
 public:
@@ -738,6 +1306,10 @@ public:
 	int Peek	(BYTE* pData, int length);
 	int Reduce	(int len);
 
+	int GetViews(WSABUF bufs[], int count, int length, int offset = 0) const	{return items.GetViews(bufs, count, length, offset);}
+	int ReserveTail	(iovec vecs[2], TItem*& pSpare)			{return items.ReserveTail(vecs, pSpare);}
+	int CommitTail	(int len, TItem* pSpare);
+
 public:
 	CCriSec&	CriSec	()	{return cs;}
 	TItemList&	ItemList()	{return items;}
@@ -61,6 +61,7 @@ public:
 
 	BOOL IsValid()	{return IS_VALID_FD(m_fd);}
 	operator FD ()	{return m_fd;}
+	FD Detach()		{FD fd = m_fd; m_fd = INVALID_FD; return fd;}
 
 	BOOL IsExist()	{return IsValid();}
 
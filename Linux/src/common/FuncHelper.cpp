@@ -113,6 +113,16 @@ ULLONG TimeGetTime64()
 	return 0ull;
 }
 
+ULLONG TimeGetMicroTime64()
+{
+	timespec ts;
+
+	if(clock_gettime(CLOCK_MONOTONIC, &ts) == NO_ERROR)
+		return (((ULLONG)(ts.tv_sec)) * 1000000 + ts.tv_nsec / 1000);
+
+	return 0ull;
+}
+
 DWORD GetTimeGap32(DWORD dwOriginal, DWORD dwCurrent)
 {
 	if(dwCurrent == 0)
@@ -391,3 +401,15 @@ BOOL SetThreadName(THR_ID tid, LPCTSTR lpszName)
 
 	return TRUE;
 }
+
+BOOL SetCurrentThreadCpuAffinity(int iCpu)
+{
+	ASSERT_CHECK_EINVAL(iCpu >= 0 && iCpu < CPU_SETSIZE);
+
+	cpu_set_t cpus;
+
+	CPU_ZERO(&cpus);
+	CPU_SET(iCpu, &cpus);
+
+	return IS_NO_ERROR(sched_setaffinity(0, sizeof(cpu_set_t), &cpus));
+}
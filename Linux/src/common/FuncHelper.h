@@ -301,6 +301,7 @@ tm*			_gmtime64(tm* ptm, __time64_t* pt);
 
 DWORD		TimeGetTime();
 ULLONG		TimeGetTime64();
+ULLONG		TimeGetMicroTime64();
 DWORD		GetTimeGap32(DWORD dwOriginal, DWORD dwCurrent = 0);
 ULLONG		GetTimeGap64(ULLONG ullOriginal, ULONGLONG ullCurrent = 0);
 LLONG		TimevalToMillisecond(const timeval& tv);
@@ -326,6 +327,7 @@ void ABORT(int iErrno = -1, LPCSTR lpszFile = nullptr, int iLine = 0, LPCSTR lps
 BOOL SetSequenceThreadName(THR_ID tid, LPCTSTR lpszPrefix, volatile UINT& vuiSeq);
 BOOL SetThreadName(THR_ID tid, LPCTSTR lpszPrefix, UINT uiSequence);
 BOOL SetThreadName(THR_ID tid, LPCTSTR lpszName);
+BOOL SetCurrentThreadCpuAffinity(int iCpu);
 
 template<typename T, typename = enable_if_t<is_integral<T>::value>>
 inline bool IS_INFINITE(T v)
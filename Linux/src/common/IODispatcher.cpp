@@ -26,11 +26,41 @@
 
 #include <signal.h>
 #include <pthread.h>
+#include <sys/ioctl.h>
+
+#ifdef _IO_URING_SUPPORT
+	#include <sys/mman.h>
+	#include <sys/syscall.h>
+	#include <sys/resource.h>
+#endif
+
+#ifndef EPIOCSPARAMS
+
+struct epoll_params
+{
+	uint32_t busy_poll_usecs;
+	uint16_t busy_poll_budget;
+	uint8_t prefer_busy_poll;
+	uint8_t __pad;
+};
+
+#define EPIOCSPARAMS				_IOW(0x8A, 0x01, struct epoll_params)
+
+#endif
+
+#define EPOLL_BUSY_POLL_BUDGET		8
 
 volatile UINT CIODispatcher::sm_uiNum		= MAXUINT;
 LPCTSTR CIODispatcher::WORKER_THREAD_PREFIX	= _T("io-disp-");
 
-BOOL CIODispatcher::Start(IIOHandler* pHandler, int iWorkerMaxEvents, int iWorkers)
+/* 开启 EPOLL 实例的 NAPI 忙轮询（内核 6.9 及以上版本有效，否则忽略） */
+static VOID EnableEpollBusyPoll(FD epoll, DWORD dwBusyPollTime)
+{
+	epoll_params params = {dwBusyPollTime, EPOLL_BUSY_POLL_BUDGET, 1, 0};
+	ioctl(epoll, EPIOCSPARAMS, &params);
+}
+
+BOOL CIODispatcher::Start(IIOHandler* pHandler, int iWorkerMaxEvents, int iWorkers, BOOL bUseIOUring, const vector<int>& vtCpus, DWORD dwBusyPollTime, DWORD dwRecvBufferSize)
 {
 	ASSERT_CHECK_EINVAL(pHandler && iWorkerMaxEvents >= 0 && iWorkers >= 0);
 	CHECK_ERROR(!HasStarted(), ERROR_INVALID_STATE);
@@ -41,6 +71,12 @@ BOOL CIODispatcher::Start(IIOHandler* pHandler, int iWorkerMaxEvents, int iWorke
 	m_iMaxEvents = iWorkerMaxEvents;
 	m_iWorkers	 = iWorkers;
 	m_pHandler	 = pHandler;
+	m_vtCpus	 = vtCpus;
+	m_dwBusyPollTime = dwBusyPollTime;
+#ifdef _IO_URING_SUPPORT
+	m_bIOUring	 = bUseIOUring;
+	m_dwRecvBufferSize = dwRecvBufferSize;
+#endif
 
 	m_evExit = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC | EFD_SEMAPHORE);
 
@@ -55,9 +91,26 @@ BOOL CIODispatcher::Start(IIOHandler* pHandler, int iWorkerMaxEvents, int iWorke
 
 		ctx.m_iIndex = i;
 
-		ctx.m_epoll = epoll_create1(EPOLL_CLOEXEC);
-		CHECK_ERROR_FD(ctx.m_epoll);
+#ifdef _IO_URING_SUPPORT
+		if(m_bIOUring && !InitIOUring(ctx))
+		{
+			if(i > 0)
+				goto START_ERROR;
+
+			m_bIOUring = FALSE;
+		}
+
+		if(!m_bIOUring)
+#endif
+		{
+			ctx.m_epoll = epoll_create1(EPOLL_CLOEXEC);
+			CHECK_ERROR_FD(ctx.m_epoll);
+
+			if(m_dwBusyPollTime > 0)
+				EnableEpollBusyPoll(ctx.m_epoll, m_dwBusyPollTime);
+		}
 
+		ctx.m_dwSpin = m_dwBusyPollTime;
 		ctx.m_evCmd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
 
 		if(IS_INVALID_FD(ctx.m_evCmd))
@@ -66,6 +119,14 @@ BOOL CIODispatcher::Start(IIOHandler* pHandler, int iWorkerMaxEvents, int iWorke
 		if(!VERIFY(AddFD(i, ctx.m_evCmd, EPOLLIN | EPOLLET, &ctx.m_evCmd)))
 			goto START_ERROR;
 
+		ctx.m_pWheel = make_unique<CTimingWheel>();
+
+		if(!ctx.m_pWheel->Init())
+			goto START_ERROR;
+
+		if(!VERIFY(AddFD(i, ctx.m_pWheel->GetFD(), EPOLLIN | EPOLLET, ctx.m_pWheel.get())))
+			goto START_ERROR;
+
 		if(!VERIFY(AddFD(i, m_evExit, EPOLLIN, &m_evExit)))
 			goto START_ERROR;
 
@@ -81,6 +142,14 @@ BOOL CIODispatcher::Start(IIOHandler* pHandler, int iWorkerMaxEvents, int iWorke
 			goto START_ERROR;
 	}
 
+#ifdef _IO_URING_SUPPORT
+	/* 所有工作线程的事件环都支持完成模式时才启用 */
+	m_bCompletionIo = m_bIOUring && m_dwRecvBufferSize > 0;
+
+	for(int i = 0; m_bCompletionIo && i < m_iWorkers; i++)
+		m_bCompletionIo = m_pContexts[i].m_pRing->IsComplete();
+#endif
+
 	return TRUE;
 
 START_ERROR:
@@ -96,6 +165,8 @@ BOOL CIODispatcher::Stop(BOOL bCheck)
 
 	if(m_pContexts)
 	{
+		KillTimer(&m_tmRebalance);
+
 		isOK &= IS_NO_ERROR(eventfd_write(m_evExit, m_iWorkers));
 
 		for(int i = 0; i < m_iWorkers; i++)
@@ -106,20 +177,39 @@ BOOL CIODispatcher::Stop(BOOL bCheck)
 				isOK &= ctx.m_pWorker->Join();
 
 			if(!ctx.m_queue.IsEmpty())
+			{
+				TDispCommand cmd;
+
+				while(ctx.m_queue.UnsafePopFront(cmd))
+					m_pHandler->OnDropCommand(&cmd);
+
+				VERIFY(ctx.m_queue.IsEmpty());
+			}
+
+			if(!ctx.m_lsOverflow.IsEmpty())
 			{
 				TDispCommand* pCmd = nullptr;
 
-				while(ctx.m_queue.PopFront(&pCmd))
+				while(ctx.m_lsOverflow.PopFront(&pCmd))
+				{
+					m_pHandler->OnDropCommand(pCmd);
 					TDispCommand::Destruct(pCmd);
+				}
 
-				VERIFY(ctx.m_queue.IsEmpty());
+				VERIFY(ctx.m_lsOverflow.IsEmpty());
 			}
 
+			ctx.m_pWheel = nullptr;
+
 			if(IS_VALID_FD(ctx.m_evCmd))
 				isOK &= IS_NO_ERROR(close(ctx.m_evCmd));
 
 			if(IS_VALID_FD(ctx.m_epoll))
 				isOK &= IS_NO_ERROR(close(ctx.m_epoll));
+
+#ifdef _IO_URING_SUPPORT
+			ctx.m_pRing = nullptr;
+#endif
 		}
 	}
 
@@ -136,9 +226,19 @@ VOID CIODispatcher::Reset()
 	m_uiSeq		= MAXUINT;
 	m_iWorkers	= 0;
 	m_iMaxEvents= 0;
+	m_bIOUring	= FALSE;
+	m_bCompletionIo = FALSE;
+	m_dwRecvBufferSize = 0;
 	m_evExit	= INVALID_FD;
+	m_dwBusyPollTime = 0;
 	m_pHandler	= nullptr;
 	m_pContexts	= nullptr;
+
+	m_dwRebalanceThreshold	= 0;
+	m_ullRebalanceTime		= 0;
+
+	m_vtCpus.clear();
+	m_vtBusyTime.clear();
 }
 
 VOID CIODispatcher::MakePrefix()
@@ -159,56 +259,144 @@ TDispContext& CIODispatcher::GetContext(int idx, FD fd)
 
 BOOL CIODispatcher::SendCommandByIndex(int idx, USHORT t, UINT_PTR wp, UINT_PTR lp)
 {
-	return SendCommandByIndex(idx, TDispCommand::Construct(t, wp, lp));
+	TDispContext& ctx = GetContextByIndex(idx);
+	return SendCommand(ctx, TDispCommand(t, wp, lp));
 }
 
-BOOL CIODispatcher::SendCommandByIndex(int idx, TDispCommand* pCmd)
+BOOL CIODispatcher::SendCommandByFD(FD fd, USHORT t, UINT_PTR wp, UINT_PTR lp)
 {
-	TDispContext& ctx = GetContextByIndex(idx);
-	return SendCommand(ctx, pCmd);
+	TDispContext& ctx = GetContextByFD(fd);
+	return SendCommand(ctx, TDispCommand(t, wp, lp));
 }
 
-BOOL CIODispatcher::SendCommandByFD(FD fd, USHORT t, UINT_PTR wp, UINT_PTR lp)
+BOOL CIODispatcher::SendCommand(TDispContext& ctx, const TDispCommand& cmd)
 {
-	return SendCommandByFD(fd, TDispCommand::Construct(t, wp, lp));
+	PushCommand(ctx, cmd);
+	return NotifyCommand(ctx);
 }
 
-BOOL CIODispatcher::SendCommandByFD(FD fd, TDispCommand* pCmd)
+BOOL CIODispatcher::SendCommands(TDispContext& ctx, const TDispCommand cmds[], int iCount)
 {
-	TDispContext& ctx = GetContextByFD(fd);
-	return SendCommand(ctx, pCmd);
+	if(iCount <= 0) return FALSE;
+
+	for(int i = 0; i < iCount; i++)
+		PushCommand(ctx, cmds[i]);
+
+	return NotifyCommand(ctx);
+}
+
+VOID CIODispatcher::PushCommand(TDispContext& ctx, const TDispCommand& cmd)
+{
+	/* 溢出队列中有未处理命令时，后续命令也进入溢出队列，保证同一线程发出的命令按发送顺序执行 */
+	if(ctx.m_dwOverflow.load(memory_order_acquire) == 0 && ctx.m_queue.TryPushBack(cmd))
+		return;
+
+	ctx.m_dwOverflow.fetch_add(1, memory_order_acq_rel);
+	ctx.m_lsOverflow.PushBack(TDispCommand::Construct(cmd));
 }
 
-BOOL CIODispatcher::SendCommand(TDispContext& ctx, TDispCommand* pCmd)
+BOOL CIODispatcher::NotifyCommand(TDispContext& ctx)
 {
-	ctx.m_queue.PushBack(pCmd);
+	/* 工作线程已被唤醒但尚未处理命令时，无需重复写 eventfd */
+	if(ctx.m_bSignaled.exchange(TRUE))
+		return TRUE;
+
+	ctx.m_stats.signalTime.store(::TimeGetMicroTime64(), memory_order_relaxed);
+
 	return VERIFY_IS_NO_ERROR(eventfd_write(ctx.m_evCmd, 1));
 }
 
-BOOL CIODispatcher::CtlFD(int idx, FD fd, int op, UINT mask, PVOID pv)
+BOOL CIODispatcher::DoCtlFD(int idx, FD fd, int op, UINT mask, PVOID pv, BOOL bComplete)
 {
 	const TDispContext& ctx = GetContext(idx, fd);
 
+#ifdef _IO_URING_SUPPORT
+	if(m_bIOUring)
+		return ctx.m_pRing->CtlFD(fd, op, mask, pv, ctx.GetThreadId() == SELF_THREAD_ID, bComplete);
+#endif
+
 	epoll_event evt = {mask, pv};
 	return IS_NO_ERROR(epoll_ctl(ctx.m_epoll, op, fd, &evt));
 }
 
+BOOL CIODispatcher::DetachFD(int idx, FD fd)
+{
+	/* EPOLL 模式下关闭句柄时自动注销，无需系统调用 */
+	if(!m_bIOUring)
+		return TRUE;
+
+	return DoCtlFD(idx, fd, EPOLL_CTL_DEL, 0, nullptr, m_bCompletionIo);
+}
+
+BOOL CIODispatcher::AddFD(int idx, FD fd, UINT mask, PVOID pv, UINT& armed)
+{
+	armed = mask;
+
+	if(DoCtlFD(idx, fd, EPOLL_CTL_ADD, mask, pv, m_bCompletionIo))
+		return TRUE;
+
+	armed = 0;
+
+	return FALSE;
+}
+
+BOOL CIODispatcher::ModFD(int idx, FD fd, UINT mask, PVOID pv, UINT& armed)
+{
+	if(mask == armed)
+		return TRUE;
+
+	if(!DoCtlFD(idx, fd, EPOLL_CTL_MOD, mask, pv, m_bCompletionIo))
+		return FALSE;
+
+	armed = mask;
+
+	return TRUE;
+}
+
+BOOL CIODispatcher::SubmitSend(int idx, FD fd, const iovec vecs[], int iCount)
+{
+#ifdef _IO_URING_SUPPORT
+	if(m_bCompletionIo)
+		return GetContext(idx, fd).m_pRing->Send(fd, vecs, iCount);
+#endif
+
+	::SetLastError(ERROR_NOT_SUPPORTED);
+	return FALSE;
+}
+
 int CIODispatcher::WorkerProc(TDispContext* pContext)
 {
 	::SetSequenceThreadName(SELF_THREAD_ID, m_strPrefix, m_uiSeq);
 
+	if(!m_vtCpus.empty())
+		::SetCurrentThreadCpuAffinity(m_vtCpus[pContext->m_iIndex % m_vtCpus.size()]);
+
+#ifdef _IO_URING_SUPPORT
+	if(m_bIOUring)
+		return WorkerProcIOUring(pContext);
+#endif
+
 	m_pHandler->OnDispatchThreadStart(SELF_THREAD_ID);
 
 	BOOL bRun						  = TRUE;
+	TDispStats& stats				  = pContext->m_stats;
+	ULLONG ullNow					  = ::TimeGetMicroTime64();
 	unique_ptr<epoll_event[]> pEvents = make_unique<epoll_event[]>(m_iMaxEvents);
 
 	while(bRun)
 	{
-		int rs = NO_EINTR_INT(epoll_pwait(pContext->m_epoll, pEvents.get(), m_iMaxEvents, INFINITE, nullptr));
+		ULLONG ullBegin = ullNow;
+		int rs			= (m_dwBusyPollTime > 0) ? BusyPoll(pContext, pEvents.get()) : 0;
+
+		if(rs == 0)
+			rs = NO_EINTR_INT(epoll_pwait(pContext->m_epoll, pEvents.get(), m_iMaxEvents, INFINITE, nullptr));
 
 		if(rs <= TIMEOUT)
 			ERROR_ABORT();
 
+		ullNow = ::TimeGetMicroTime64();
+		stats.OnWake(ullBegin, ullNow, rs);
+
 		for(int i = 0; i < rs; i++)
 		{
 			UINT events	= pEvents[i].events;
@@ -216,10 +404,19 @@ int CIODispatcher::WorkerProc(TDispContext* pContext)
 
 			if(ptr == &pContext->m_evCmd)
 				ProcessCommand(pContext, events);
+			else if(ptr == pContext->m_pWheel.get())
+				ProcessTimer(pContext, events);
 			else if(ptr == &m_evExit)
 				bRun = ProcessExit(pContext, events);
 			else
+			{
 				ProcessIo(pContext, ptr, events);
+
+				if(pContext->m_iMigrateTo >= 0)
+					ProcessMigrate(pContext, ptr);
+			}
+
+			ullNow = stats.OnHandle(ullNow);
 		}
 	}
 
@@ -228,6 +425,33 @@ int CIODispatcher::WorkerProc(TDispContext* pContext)
 	return 0;
 }
 
+int CIODispatcher::BusyPoll(TDispContext* pContext, epoll_event* pEvents)
+{
+	ULLONG ullEnd = ::TimeGetMicroTime64() + pContext->m_dwSpin;
+	int rs;
+
+	do
+	{
+		rs = NO_EINTR_INT(epoll_pwait(pContext->m_epoll, pEvents, m_iMaxEvents, 0, nullptr));
+	} while(rs == 0 && ::TimeGetMicroTime64() < ullEnd);
+
+	AdjustBusyPollSpin(pContext, rs != 0);
+
+	return rs;
+}
+
+VOID CIODispatcher::AdjustBusyPollSpin(TDispContext* pContext, BOOL bHit)
+{
+	DWORD dwSpin = pContext->m_dwSpin;
+
+	if(bHit)
+		dwSpin = MIN(dwSpin << 1, m_dwBusyPollTime);
+	else
+		dwSpin = MAX(dwSpin >> 1, MIN(MIN_BUSY_POLL_SPIN, m_dwBusyPollTime));
+
+	pContext->m_dwSpin = dwSpin;
+}
+
 BOOL CIODispatcher::ProcessCommand(TDispContext* pContext, UINT events)
 {
 	if(events & _EPOLL_ALL_ERROR_EVENTS)
@@ -246,13 +470,29 @@ BOOL CIODispatcher::ProcessCommand(TDispContext* pContext, UINT events)
 	{
 		ASSERT(v > 0);
 
+		pContext->m_bSignaled.store(FALSE);
+
+		TDispCommand cmd;
+		DWORD dwCommands = 0;
+
+		for(; pContext->m_queue.UnsafePopFront(cmd); ++dwCommands)
+			m_pHandler->OnCommand(pContext, &cmd);
+
 		TDispCommand* pCmd = nullptr;
 
-		while(pContext->m_queue.PopFront(&pCmd))
+		for(; pContext->m_lsOverflow.PopFront(&pCmd); ++dwCommands)
 		{
+			/* 生产者在溢出之前放入环形队列的命令先于其溢出命令执行 */
+			for(; pContext->m_queue.UnsafePopFront(cmd); ++dwCommands)
+				m_pHandler->OnCommand(pContext, &cmd);
+
 			m_pHandler->OnCommand(pContext, pCmd);
 			TDispCommand::Destruct(pCmd);
+
+			pContext->m_dwOverflow.fetch_sub(1, memory_order_acq_rel);
 		}
+
+		pContext->m_stats.OnDrain(dwCommands);
 	}
 	else if(IS_HAS_ERROR(rs))
 	{
@@ -264,6 +504,52 @@ BOOL CIODispatcher::ProcessCommand(TDispContext* pContext, UINT events)
 	return isOK;
 }
 
+BOOL CIODispatcher::ProcessTimer(TDispContext* pContext, UINT events)
+{
+	if(events & _EPOLL_ALL_ERROR_EVENTS)
+		ERROR_ABORT();
+
+	if(!(events & EPOLLIN))
+		return FALSE;
+
+	CTimingWheel::CExpiredTimers& vtExpired = pContext->m_vtExpired;
+
+	pContext->m_pWheel->Expire(vtExpired);
+
+	for(auto it = vtExpired.begin(), end = vtExpired.end(); it != end; ++it)
+	{
+		TDispTimer* pTimer = it->first;
+
+		/* 定时器在到期后被取消或重新设置（如被本批次中先执行的回调取消）则跳过 */
+		if(pTimer->gen == it->second)
+			pTimer->fn(pTimer->pv);
+	}
+
+	vtExpired.clear();
+
+	return TRUE;
+}
+
+VOID CIODispatcher::ProcessMigrate(TDispContext* pContext, PVOID pv)
+{
+	int iTarget = pContext->m_iMigrateTo;
+
+	if(iTarget < 0)
+		return;
+
+	if(iTarget == pContext->m_iIndex || iTarget >= m_iWorkers)
+	{
+		pContext->m_iMigrateTo = -1;
+		return;
+	}
+
+	if(m_pHandler->OnMigrate(pContext, pv, iTarget))
+	{
+		pContext->m_iMigrateTo			= -1;
+		pContext->m_stats.migrations	= pContext->m_stats.migrations + 1;
+	}
+}
+
 BOOL CIODispatcher::ProcessExit(const TDispContext* pContext, UINT events)
 {
 	if(events & _EPOLL_ALL_ERROR_EVENTS)
@@ -300,10 +586,37 @@ BOOL CIODispatcher::ProcessIo(const TDispContext* pContext, PVOID pv, UINT event
 	return rs;
 }
 
+BOOL CIODispatcher::ProcessReceive(const TDispContext* pContext, PVOID pv, const BYTE* pData, int iResult)
+{
+	if(!m_pHandler->OnBeforeProcessIo(pContext, pv, EPOLLIN))
+		return FALSE;
+
+	EnHandleResult rs = m_pHandler->OnReceiveComplete(pContext, pv, pData, iResult);
+	m_pHandler->OnAfterProcessIo(pContext, pv, EPOLLIN, rs != HR_ERROR);
+
+	return (rs == HR_IGNORE);
+}
+
+BOOL CIODispatcher::ProcessSend(const TDispContext* pContext, PVOID pv, int iResult)
+{
+	if(!m_pHandler->OnBeforeProcessIo(pContext, pv, EPOLLOUT))
+		return FALSE;
+
+	BOOL rs = m_pHandler->OnSendComplete(pContext, pv, iResult);
+	m_pHandler->OnAfterProcessIo(pContext, pv, EPOLLOUT, rs);
+
+	return rs;
+}
+
 BOOL CIODispatcher::DoProcessIo(const TDispContext* pContext, PVOID pv, UINT events)
 {
 	if(events & EPOLLERR)
-		return m_pHandler->OnError(pContext, pv, events);
+	{
+		/* 错误队列中只有非致命通知（如 MSG_ZEROCOPY 完成通知）时继续处理其它事件 */
+		if(!m_pHandler->OnErrorQueue(pContext, pv, events))
+			return m_pHandler->OnError(pContext, pv, events);
+	}
+
 	if((events & EPOLLPRI) && !m_pHandler->OnReadyPrivilege(pContext, pv, events))
 		return FALSE;
 	if((events & EPOLLIN) && !m_pHandler->OnReadyRead(pContext, pv, events))
@@ -346,3 +659,1357 @@ BOOL CIODispatcher::DelTimer(int idx, FD fdTimer)
 
 	return isOK;
 }
+
+BOOL CIODispatcher::SetTimer(int idx, TDispTimer* pTimer, DWORD dwDelay, DWORD dwPeriod)
+{
+	ASSERT_CHECK_EINVAL(pTimer && pTimer->fn);
+	CHECK_ERROR(HasStarted(), ERROR_INVALID_STATE);
+
+	CTimingWheel* pWheel = GetContextByIndex(idx).m_pWheel.get();
+	CTimingWheel* pOld	 = pTimer->wheel;
+
+	if(pOld != nullptr && pOld != pWheel)
+		pOld->Cancel(pTimer);
+
+	++pTimer->gen;
+
+	return pWheel->Schedule(pTimer, dwDelay, dwPeriod);
+}
+
+BOOL CIODispatcher::KillTimer(TDispTimer* pTimer)
+{
+	/* 使已到期但尚未回调的定时器失效 */
+	++pTimer->gen;
+
+	CTimingWheel* pWheel = pTimer->wheel;
+
+	if(pWheel == nullptr)
+		return FALSE;
+
+	return pWheel->Cancel(pTimer);
+}
+
+BOOL CIODispatcher::GetStats(TWorkerStats pStats[], DWORD& dwCount)
+{
+	CHECK_ERROR(HasStarted(), ERROR_INVALID_STATE);
+
+	if(pStats == nullptr || dwCount < (DWORD)m_iWorkers)
+	{
+		dwCount = (DWORD)m_iWorkers;
+		return FALSE;
+	}
+
+	for(int i = 0; i < m_iWorkers; i++)
+	{
+		TDispContext& ctx	= m_pContexts[i];
+		TDispStats& stats	= ctx.m_stats;
+		TWorkerStats& ws	= pStats[i];
+
+		ws.index				= (DWORD)i;
+		ws.maxLoopEvents		= stats.maxEvents;
+		ws.loops				= stats.loops;
+		ws.events				= stats.events;
+		ws.commands				= stats.commands;
+		ws.commandQueueDepth	= ctx.m_queue.Size() + ctx.m_lsOverflow.Size();
+		ws.maxCommandLatency	= stats.maxCmdLatency;
+		ws.commandDrains		= stats.drains;
+		ws.commandLatency		= stats.cmdLatency;
+		ws.handleTime			= stats.handleTime;
+		ws.waitTime				= stats.waitTime;
+		ws.maxHandleTime		= stats.maxHandle;
+		ws.migrations			= stats.migrations;
+	}
+
+	dwCount = (DWORD)m_iWorkers;
+
+	return TRUE;
+}
+
+BOOL CIODispatcher::StartRebalance(DWORD dwThreshold, DWORD dwInterval)
+{
+	ASSERT_CHECK_EINVAL(dwThreshold > 0 && dwThreshold <= 100 && dwInterval > 0);
+	CHECK_ERROR(HasStarted(), ERROR_INVALID_STATE);
+
+	/* 完成模式下保留的接收数据和接收请求属于工作线程的事件环，连接不能迁移 */
+	if(m_iWorkers < 2 || m_bCompletionIo)
+		return TRUE;
+
+	m_dwRebalanceThreshold	= dwThreshold;
+	m_ullRebalanceTime		= ::TimeGetMicroTime64();
+
+	m_vtBusyTime.resize(m_iWorkers);
+
+	for(int i = 0; i < m_iWorkers; i++)
+		m_vtBusyTime[i] = m_pContexts[i].m_stats.handleTime;
+
+	return SetTimer(0, &m_tmRebalance, dwInterval, dwInterval);
+}
+
+BOOL CIODispatcher::StopRebalance()
+{
+	CHECK_ERROR(HasStarted(), ERROR_INVALID_STATE);
+
+	KillTimer(&m_tmRebalance);
+
+	for(int i = 0; i < m_iWorkers; i++)
+		m_pContexts[i].m_iMigrateTo = -1;
+
+	return TRUE;
+}
+
+VOID CIODispatcher::Rebalance()
+{
+	ULLONG ullNow	= ::TimeGetMicroTime64();
+	ULLONG ullSpan	= ullNow - m_ullRebalanceTime;
+	ULLONG ullMax	= 0;
+	ULLONG ullMin	= (ULLONG)-1;
+	int iMax		= 0;
+	int iMin		= 0;
+
+	m_ullRebalanceTime = ullNow;
+
+	for(int i = 0; i < m_iWorkers; i++)
+	{
+		TDispContext& ctx	= m_pContexts[i];
+		ULLONG ullBusy		= ctx.m_stats.handleTime;
+		ULLONG ullDelta		= ullBusy - m_vtBusyTime[i];
+
+		m_vtBusyTime[i]		= ullBusy;
+		ctx.m_iMigrateTo	= -1;
+
+		if(ullDelta > ullMax)
+		{
+			ullMax	= ullDelta;
+			iMax	= i;
+		}
+
+		if(ullDelta < ullMin)
+		{
+			ullMin	= ullDelta;
+			iMin	= i;
+		}
+	}
+
+	/* 每轮最多迁移一个连接，避免连接在工作线程之间来回振荡 */
+	if(ullSpan > 0 && (ullMax - ullMin) * 100 >= m_dwRebalanceThreshold * ullSpan)
+		m_pContexts[iMax].m_iMigrateTo = iMin;
+}
+
+VOID CTimingWheel::Reset()
+{
+	m_fd		= INVALID_FD;
+	m_ullTick	= 0;
+	m_ullArmed	= 0;
+	m_dwCount	= 0;
+
+	for(int i = 0; i < TVR_SIZE; i++)
+		m_tvRoot[i].Init();
+
+	for(int i = 0; i < TVN_LEVELS; i++)
+	{
+		for(int j = 0; j < TVN_SIZE; j++)
+			m_tvLevels[i][j].Init();
+	}
+}
+
+BOOL CTimingWheel::Init()
+{
+	ASSERT(IS_INVALID_FD(m_fd));
+
+	m_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+
+	return IS_VALID_FD(m_fd);
+}
+
+VOID CTimingWheel::Term()
+{
+	{
+		CCriSecLock locallock(m_cs);
+
+		/* 解除残留定时器与本时间轮的关联，避免其持有者访问已销毁的时间轮 */
+		auto fnDetach = [](TDispTimerLink& lsHead)
+		{
+			while(!lsHead.IsEmpty())
+			{
+				TDispTimer* pTimer = static_cast<TDispTimer*>(lsHead.next);
+
+				Unlink(pTimer);
+				pTimer->wheel = nullptr;
+			}
+		};
+
+		for(int i = 0; i < TVR_SIZE; i++)
+			fnDetach(m_tvRoot[i]);
+
+		for(int i = 0; i < TVN_LEVELS; i++)
+		{
+			for(int j = 0; j < TVN_SIZE; j++)
+				fnDetach(m_tvLevels[i][j]);
+		}
+
+		if(IS_VALID_FD(m_fd))
+			close(m_fd);
+	}
+
+	Reset();
+}
+
+BOOL CTimingWheel::Schedule(TDispTimer* pTimer, DWORD dwDelay, DWORD dwPeriod)
+{
+	CCriSecLock locallock(m_cs);
+
+	if(pTimer->wheel != nullptr)
+	{
+		if(pTimer->wheel != this)
+		{
+			::SetLastError(ERROR_INVALID_STATE);
+			return FALSE;
+		}
+
+		Unlink(pTimer);
+		--m_dwCount;
+	}
+
+	ULLONG ullNow = Now();
+
+	if(m_dwCount == 0)
+		m_ullTick = ullNow;
+
+	pTimer->expire	= ullNow + dwDelay;
+	pTimer->period	= dwPeriod;
+	pTimer->wheel	= this;
+
+	AddTimer(pTimer);
+	++m_dwCount;
+
+	if(m_ullArmed == 0 || pTimer->expire < m_ullArmed)
+		Arm(MAX(pTimer->expire, m_ullTick));
+
+	return TRUE;
+}
+
+BOOL CTimingWheel::Cancel(TDispTimer* pTimer)
+{
+	CCriSecLock locallock(m_cs);
+
+	if(pTimer->wheel != this)
+		return FALSE;
+
+	Unlink(pTimer);
+
+	pTimer->wheel = nullptr;
+
+	/* 时间轮已空则撤销 timerfd，否则保留当前触发时间，到期时再重新计算 */
+	if(--m_dwCount == 0)
+		Arm(0);
+
+	return TRUE;
+}
+
+VOID CTimingWheel::Expire(CExpiredTimers& vtExpired)
+{
+	::ReadTimer(m_fd);
+
+	CCriSecLock locallock(m_cs);
+
+	ULLONG ullNow = Now();
+	m_ullArmed	  = 0;
+
+	while(m_dwCount > 0 && m_ullTick <= ullNow)
+	{
+		int idx = (int)(m_ullTick & TVR_MASK);
+
+		if(idx == 0)
+		{
+			for(int i = 0; i < TVN_LEVELS && Cascade(i) == 0; i++);
+		}
+
+		TDispTimerLink lsExpired;
+		Splice(&m_tvRoot[idx], &lsExpired);
+
+		while(!lsExpired.IsEmpty())
+		{
+			TDispTimer* pTimer = static_cast<TDispTimer*>(lsExpired.next);
+
+			Unlink(pTimer);
+			vtExpired.emplace_back(pTimer, (DWORD)pTimer->gen);
+
+			if(pTimer->period > 0)
+			{
+				pTimer->expire = ullNow + pTimer->period;
+				AddTimer(pTimer);
+			}
+			else
+			{
+				pTimer->wheel = nullptr;
+				--m_dwCount;
+			}
+		}
+
+		++m_ullTick;
+	}
+
+	Arm(GetNextTick());
+}
+
+VOID CTimingWheel::AddTimer(TDispTimer* pTimer)
+{
+	ULLONG ullExpire = pTimer->expire;
+	TDispTimerLink* pHead;
+
+	if(ullExpire < m_ullTick)
+		pHead = &m_tvRoot[m_ullTick & TVR_MASK];
+	else
+	{
+		ULLONG ullDelta = ullExpire - m_ullTick;
+
+		if(ullDelta < TVR_SIZE)
+			pHead = &m_tvRoot[ullExpire & TVR_MASK];
+		else
+		{
+			/* 超出时间轮范围的定时器暂时放在最高层，级联时按实际到期时间重新定位 */
+			if(ullDelta > MAX_DELAY)
+			{
+				ullDelta  = MAX_DELAY;
+				ullExpire = m_ullTick + MAX_DELAY;
+			}
+
+			int iLevel = 0;
+
+			while(iLevel < TVN_LEVELS - 1 && ullDelta >= (1ULL << (TVR_BITS + (iLevel + 1) * TVN_BITS)))
+				++iLevel;
+
+			pHead = &m_tvLevels[iLevel][(ullExpire >> (TVR_BITS + iLevel * TVN_BITS)) & TVN_MASK];
+		}
+	}
+
+	Link(pHead, pTimer);
+}
+
+int CTimingWheel::Cascade(int iLevel)
+{
+	int idx = (int)((m_ullTick >> (TVR_BITS + iLevel * TVN_BITS)) & TVN_MASK);
+
+	TDispTimerLink lsTimers;
+	Splice(&m_tvLevels[iLevel][idx], &lsTimers);
+
+	while(!lsTimers.IsEmpty())
+	{
+		TDispTimer* pTimer = static_cast<TDispTimer*>(lsTimers.next);
+
+		Unlink(pTimer);
+		AddTimer(pTimer);
+	}
+
+	return idx;
+}
+
+ULLONG CTimingWheel::GetNextTick()
+{
+	if(m_dwCount == 0)
+		return 0;
+
+	/* 第 0 层在下一个级联点之前的最早非空槽；若没有，则在级联点唤醒 */
+	ULLONG ullCascade = (m_ullTick | TVR_MASK) + 1;
+
+	for(ULLONG ullTick = m_ullTick; ullTick < ullCascade; ullTick++)
+	{
+		if(!m_tvRoot[ullTick & TVR_MASK].IsEmpty())
+			return ullTick;
+	}
+
+	return ullCascade;
+}
+
+VOID CTimingWheel::Arm(ULLONG ullTick)
+{
+	if(ullTick == m_ullArmed)
+		return;
+
+	itimerspec its = {};
+
+	if(ullTick > 0)
+		::MillisecondToTimespec((LLONG)ullTick, its.it_value);
+
+	VERIFY_IS_NO_ERROR(timerfd_settime(m_fd, TFD_TIMER_ABSTIME, &its, nullptr));
+
+	m_ullArmed = ullTick;
+}
+
+ULLONG CTimingWheel::Now()
+{
+	return ::TimeGetMicroTime64() / 1000;
+}
+
+VOID CTimingWheel::Link(TDispTimerLink* pHead, TDispTimerLink* pNode)
+{
+	pNode->next			= pHead;
+	pNode->prev			= pHead->prev;
+	pHead->prev->next	= pNode;
+	pHead->prev			= pNode;
+}
+
+VOID CTimingWheel::Unlink(TDispTimerLink* pNode)
+{
+	pNode->prev->next	= pNode->next;
+	pNode->next->prev	= pNode->prev;
+	pNode->prev			= nullptr;
+	pNode->next			= nullptr;
+}
+
+VOID CTimingWheel::Splice(TDispTimerLink* pHead, TDispTimerLink* pList)
+{
+	if(pHead->IsEmpty())
+	{
+		pList->Init();
+		return;
+	}
+
+	pList->next			= pHead->next;
+	pList->prev			= pHead->prev;
+	pList->next->prev	= pList;
+	pList->prev->next	= pList;
+
+	pHead->Init();
+}
+
+#ifdef _IO_URING_SUPPORT
+
+BOOL CIODispatcher::InitIOUring(TDispContext& ctx)
+{
+	ctx.m_pRing = make_unique<CIOUring>();
+
+	if(ctx.m_pRing->Init(CIOUring::DEF_ENTRIES, m_dwRecvBufferSize))
+		return TRUE;
+
+	ctx.m_pRing = nullptr;
+
+	return FALSE;
+}
+
+int CIODispatcher::WorkerProcIOUring(TDispContext* pContext)
+{
+	m_pHandler->OnDispatchThreadStart(SELF_THREAD_ID);
+
+	BOOL bRun			= TRUE;
+	CIOUring* pRing		= pContext->m_pRing.get();
+	TDispStats& stats	= pContext->m_stats;
+	ULLONG ullNow		= ::TimeGetMicroTime64();
+
+	while(bRun)
+	{
+		ULLONG ullBegin = ullNow;
+
+		if(!(m_dwBusyPollTime > 0 && BusyPollIOUring(pContext)) && !pRing->Enter(TRUE))
+			ERROR_ABORT();
+
+		ullNow			= ::TimeGetMicroTime64();
+		ULLONG ullWake	= ullNow;
+
+		CIOUring::TEvent evt;
+		int i;
+
+		for(i = 0; bRun && i < m_iMaxEvents && pRing->PeekEvent(evt); i++)
+		{
+			PVOID ptr	= evt.pv;
+			BOOL bHold	= FALSE;
+
+			if(evt.type == CIOUring::ET_RECV)
+				bHold = ProcessReceive(pContext, ptr, evt.data, evt.res);
+			else if(evt.type == CIOUring::ET_SEND)
+				ProcessSend(pContext, ptr, evt.res);
+			else if(ptr == &pContext->m_evCmd)
+				ProcessCommand(pContext, evt.events);
+			else if(ptr == pContext->m_pWheel.get())
+				ProcessTimer(pContext, evt.events);
+			else if(ptr == &m_evExit)
+				bRun = ProcessExit(pContext, evt.events);
+			else
+			{
+				ProcessIo(pContext, ptr, evt.events);
+
+				if(pContext->m_iMigrateTo >= 0)
+					ProcessMigrate(pContext, ptr);
+			}
+
+			pRing->Rearm(evt, bHold);
+
+			ullNow = stats.OnHandle(ullNow);
+		}
+
+		stats.OnWake(ullBegin, ullWake, i);
+	}
+
+	m_pHandler->OnDispatchThreadEnd(SELF_THREAD_ID);
+
+	return 0;
+}
+
+BOOL CIODispatcher::BusyPollIOUring(TDispContext* pContext)
+{
+	CIOUring* pRing	= pContext->m_pRing.get();
+	ULLONG ullEnd	= ::TimeGetMicroTime64() + pContext->m_dwSpin;
+	BOOL bHit;
+
+	do
+	{
+		bHit = pRing->Poll();
+	} while(!bHit && ::TimeGetMicroTime64() < ullEnd);
+
+	AdjustBusyPollSpin(pContext, bHit);
+
+	return bHit;
+}
+
+VOID CIOUring::Reset()
+{
+	m_fd			= INVALID_FD;
+	m_pRing			= MAP_FAILED;
+	m_szRing		= 0;
+	m_pSqes			= (io_uring_sqe*)MAP_FAILED;
+	m_szSqes		= 0;
+	m_pSqHead		= nullptr;
+	m_pSqTail		= nullptr;
+	m_pSqArray		= nullptr;
+	m_uiSqMask		= 0;
+	m_uiSqEntries	= 0;
+	m_uiSqTail		= 0;
+	m_pCqHead		= nullptr;
+	m_pCqTail		= nullptr;
+	m_pCqes			= nullptr;
+	m_uiCqMask		= 0;
+	m_uiGen			= 0;
+	m_pBufRing		= nullptr;
+	m_szBufRing		= 0;
+	m_pBufs			= nullptr;
+	m_szBufs		= 0;
+	m_dwBufSize		= 0;
+	m_uiBufCount	= 0;
+	m_usBufTail		= 0;
+}
+
+BOOL CIOUring::Init(UINT uiEntries, DWORD dwRecvBufferSize)
+{
+	ASSERT(!IsValid());
+
+	io_uring_params params;
+	::ZeroMemory(&params, sizeof(params));
+
+	m_fd = (FD)syscall(__NR_io_uring_setup, uiEntries, &params);
+
+	if(IS_INVALID_FD(m_fd))
+		return FALSE;
+
+	const UINT FEATURES = IORING_FEAT_SINGLE_MMAP | IORING_FEAT_NODROP | IORING_FEAT_POLL_32BITS;
+
+	if((params.features & FEATURES) != FEATURES)
+	{
+		Term();
+		::SetLastError(ERROR_NOT_SUPPORTED);
+
+		return FALSE;
+	}
+
+	m_szRing = max(params.sq_off.array + params.sq_entries * sizeof(UINT), params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe));
+	m_pRing	 = mmap(nullptr, m_szRing, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_SQ_RING);
+
+	if(m_pRing == MAP_FAILED)
+	{
+		EXECUTE_RESTORE_ERROR(Term());
+		return FALSE;
+	}
+
+	m_szSqes = params.sq_entries * sizeof(io_uring_sqe);
+	m_pSqes	 = (io_uring_sqe*)mmap(nullptr, m_szSqes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_SQES);
+
+	if(m_pSqes == MAP_FAILED)
+	{
+		EXECUTE_RESTORE_ERROR(Term());
+		return FALSE;
+	}
+
+	BYTE* p = (BYTE*)m_pRing;
+
+	m_pSqHead		= (UINT*)(p + params.sq_off.head);
+	m_pSqTail		= (UINT*)(p + params.sq_off.tail);
+	m_pSqArray		= (UINT*)(p + params.sq_off.array);
+	m_uiSqMask		= *(UINT*)(p + params.sq_off.ring_mask);
+	m_uiSqEntries	= params.sq_entries;
+	m_uiSqTail		= *m_pSqTail;
+
+	m_pCqHead		= (UINT*)(p + params.cq_off.head);
+	m_pCqTail		= (UINT*)(p + params.cq_off.tail);
+	m_pCqes			= (io_uring_cqe*)(p + params.cq_off.cqes);
+	m_uiCqMask		= *(UINT*)(p + params.cq_off.ring_mask);
+
+	/* 内核不支持完成模式时，所有句柄都以 POLL_ADD 模拟 EPOLL 注册 */
+	if(dwRecvBufferSize > 0)
+		InitCompletion(params, dwRecvBufferSize);
+
+	return TRUE;
+}
+
+BOOL CIOUring::InitCompletion(const io_uring_params& params, DWORD dwRecvBufferSize)
+{
+#ifdef _IO_URING_COMPLETION_SUPPORT
+	const UINT FEATURES = IORING_FEAT_SUBMIT_STABLE | IORING_FEAT_FAST_POLL;
+
+	if((params.features & FEATURES) != FEATURES || !::IsKernelVersionAbove(6, 0, 0))
+	{
+		::SetLastError(ERROR_NOT_SUPPORTED);
+		return FALSE;
+	}
+
+	size_t szBufRing = DEF_RECV_BUFFERS * sizeof(io_uring_buf);
+	size_t szBufs	 = (size_t)DEF_RECV_BUFFERS * dwRecvBufferSize;
+	PVOID pBufRing	 = mmap(nullptr, szBufRing, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE, -1, 0);
+	PVOID pBufs		 = mmap(nullptr, szBufs, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+	io_uring_buf_reg reg;
+	::ZeroMemory(&reg, sizeof(reg));
+
+	reg.ring_addr	 = (ULLONG)pBufRing;
+	reg.ring_entries = DEF_RECV_BUFFERS;
+	reg.bgid		 = 0;
+
+	if(pBufRing == MAP_FAILED || pBufs == MAP_FAILED || IS_HAS_ERROR((int)syscall(__NR_io_uring_register, m_fd, IORING_REGISTER_PBUF_RING, &reg, 1)))
+	{
+		int code = ::GetLastError();
+
+		if(pBufRing != MAP_FAILED)	munmap(pBufRing, szBufRing);
+		if(pBufs != MAP_FAILED)		munmap(pBufs, szBufs);
+
+		::SetLastError(code);
+
+		return FALSE;
+	}
+
+	m_pBufRing	 = pBufRing;
+	m_szBufRing	 = szBufRing;
+	m_pBufs		 = (BYTE*)pBufs;
+	m_szBufs	 = szBufs;
+	m_dwBufSize	 = dwRecvBufferSize;
+	m_uiBufCount = DEF_RECV_BUFFERS;
+
+	for(UINT i = 0; i < m_uiBufCount; i++)
+		RecycleBuffer((int)i);
+
+	/* 稀疏的固定文件表（受 RLIMIT_NOFILE 限制），注册失败或槽位用完时以句柄提交请求 */
+	rlimit rl;
+	UINT uiFiles = DEF_FIXED_FILES;
+
+	if(IS_NO_ERROR(getrlimit(RLIMIT_NOFILE, &rl)) && rl.rlim_cur < uiFiles)
+		uiFiles = (UINT)rl.rlim_cur;
+
+	vector<int> vtFiles(uiFiles, INVALID_FD);
+
+	if(uiFiles > 0 && IS_NO_ERROR((int)syscall(__NR_io_uring_register, m_fd, IORING_REGISTER_FILES, vtFiles.data(), uiFiles)))
+	{
+		m_vtFreeFiles.reserve(uiFiles);
+
+		for(int i = (int)uiFiles - 1; i >= 0; i--)
+			m_vtFreeFiles.push_back(i);
+	}
+
+	return TRUE;
+#else
+	::SetLastError(ERROR_NOT_SUPPORTED);
+	return FALSE;
+#endif
+}
+
+VOID CIOUring::Term()
+{
+	if(m_pSqes != MAP_FAILED)
+		munmap(m_pSqes, m_szSqes);
+	if(m_pRing != MAP_FAILED)
+		munmap(m_pRing, m_szRing);
+	if(IS_VALID_FD(m_fd))
+		close(m_fd);
+	if(m_pBufRing != nullptr)
+		munmap(m_pBufRing, m_szBufRing);
+	if(m_pBufs != nullptr)
+		munmap(m_pBufs, m_szBufs);
+
+	m_regs.clear();
+	m_lsQueued.clear();
+	m_vtFreeFiles.clear();
+
+	Reset();
+}
+
+BOOL CIOUring::CtlFD(FD fd, int op, UINT mask, PVOID pv, BOOL bDefer, BOOL bComplete)
+{
+	CCriSecLock locallock(m_cs);
+
+	auto it = m_regs.find(fd);
+
+	switch(op)
+	{
+	case EPOLL_CTL_ADD:
+		if(it != m_regs.end())
+		{
+			::SetLastError(EEXIST);
+			return FALSE;
+		}
+
+		it = m_regs.emplace(fd, TPollReg()).first;
+
+		{
+			TPollReg& reg = it->second;
+
+			reg.mask	 = mask;
+			reg.pv		 = pv;
+			reg.gen		 = NextGen();
+			reg.complete = bComplete && IsComplete();
+			reg.id		 = reg.gen;
+			reg.file	 = reg.complete ? AllocFile(fd) : -1;
+		}
+
+		break;
+	case EPOLL_CTL_MOD:
+	case EPOLL_CTL_DEL:
+		if(it == m_regs.end())
+		{
+			::SetLastError(ENOENT);
+			return FALSE;
+		}
+
+		if(it->second.inflight && !PushPollRemove(fd, it->second.gen))
+			return FALSE;
+
+		it->second.inflight = FALSE;
+
+		if(op == EPOLL_CTL_DEL)
+		{
+			if(it->second.complete)
+				Detach(fd, it->second);
+
+			m_regs.erase(it);
+			return bDefer || DoEnter(GetToSubmit(), 0);
+		}
+
+		it->second.mask	= mask;
+		it->second.pv	= pv;
+		it->second.gen	= NextGen();
+
+		break;
+	default:
+		::SetLastError(ERROR_INVALID_PARAMETER);
+		return FALSE;
+	}
+
+	TPollReg& reg = it->second;
+
+	if(!ArmPoll(fd, reg))
+	{
+		if(op == EPOLL_CTL_ADD)
+		{
+			if(reg.file >= 0)
+				FreeFile(reg.file);
+
+			m_regs.erase(it);
+		}
+
+		return FALSE;
+	}
+
+	if(reg.complete)
+	{
+		if(reg.mask & EPOLLIN)
+			QueueRecv(fd, reg, bDefer);
+		else if(reg.recving)
+			PushCancel(MakeKey(fd, reg.id, OT_RECV));
+	}
+
+	return bDefer || DoEnter(GetToSubmit(), 0);
+}
+
+BOOL CIOUring::Send(FD fd, const iovec vecs[], int iCount)
+{
+	ASSERT(iCount > 0);
+
+	CCriSecLock locallock(m_cs);
+
+	auto it = m_regs.find(fd);
+
+	if(it == m_regs.end() || !it->second.complete || it->second.sending)
+	{
+		::SetLastError(ERROR_INVALID_STATE);
+		return FALSE;
+	}
+
+	TPollReg& reg = it->second;
+	reg.vecs.assign(vecs, vecs + iCount);
+
+	if(!PushSend(fd, reg))
+		return FALSE;
+
+	reg.sending = TRUE;
+
+	return TRUE;
+}
+
+VOID CIOUring::Detach(FD fd, TPollReg& reg)
+{
+	if(reg.recving)
+		PushCancel(MakeKey(fd, reg.id, OT_RECV));
+	if(reg.sending)
+		PushCancel(MakeKey(fd, reg.id, OT_SEND));
+
+	for(const THeldRecv& held : reg.held)
+	{
+		if(held.bid >= 0)
+			RecycleBuffer(held.bid);
+	}
+
+	reg.held.clear();
+
+	/* 立即提交：未提交的发送请求引用注册信息中的 msghdr，且固定文件槽位释放后可能分配给其它连接 */
+	if(GetToSubmit() > 0)
+		DoEnter(GetToSubmit(), 0);
+
+	if(reg.file >= 0)
+		FreeFile(reg.file);
+}
+
+UINT CIOUring::PollMask(const TPollReg& reg)
+{
+	if(!reg.complete)
+		return reg.mask;
+
+	/* 完成模式下由接收请求报告数据和连接关闭，只在需要写就绪事件或暂停接收时注册 POLL */
+	UINT mask = reg.mask & ~EPOLLIN;
+
+	if(reg.mask & EPOLLIN)
+		mask &= ~EPOLLRDHUP;
+
+	return (mask & (EPOLLOUT | EPOLLPRI | EPOLLRDHUP)) ? mask : 0;
+}
+
+BOOL CIOUring::ArmPoll(FD fd, TPollReg& reg)
+{
+	UINT mask = PollMask(reg);
+
+	if(mask == 0)
+		return TRUE;
+
+	if(!PushPoll(fd, mask, reg.gen))
+		return FALSE;
+
+	reg.inflight = TRUE;
+
+	return TRUE;
+}
+
+VOID CIOUring::ArmRecv(FD fd, TPollReg& reg)
+{
+	if(!reg.complete || !(reg.mask & EPOLLIN) || reg.recving || !reg.held.empty())
+		return;
+
+	if(PushRecv(fd, reg))
+		reg.recving = TRUE;
+}
+
+VOID CIOUring::QueueRecv(FD fd, TPollReg& reg, BOOL bDefer)
+{
+	if(reg.held.empty())
+	{
+		if(reg.recving)
+			return;
+
+		if(bDefer)
+		{
+			ArmRecv(fd, reg);
+			return;
+		}
+	}
+
+	/* 有保留数据时由工作线程先重新投递保留数据；其它线程中调用时也由工作线程提交接收请求，避免请求归属于调用线程 */
+	if(!reg.queued)
+	{
+		reg.queued = TRUE;
+		m_lsQueued.push_back(fd);
+	}
+
+	if(!bDefer)
+		PushNop();
+}
+
+VOID CIOUring::Rearm(const TEvent& evt, BOOL bHold)
+{
+	FD fd = KeyFD(evt.key);
+
+	CCriSecLock locallock(m_cs);
+
+	CPollRegs::iterator it;
+
+	switch(evt.type)
+	{
+	case ET_POLL:
+		it = m_regs.find(fd);
+
+		if(it != m_regs.end() && it->second.gen == KeyGen(evt.key) && !it->second.inflight)
+			ArmPoll(fd, it->second);
+
+		break;
+	case ET_READY:
+	case ET_RECV:
+		if(!FindReg(evt.key, it))
+		{
+			if(evt.bid >= 0)
+				RecycleBuffer(evt.bid);
+
+			break;
+		}
+
+		/* 处理器暂停接收：数据按顺序保留（重新投递的数据放回队首），恢复接收后重新投递 */
+		if(bHold)
+		{
+			THeldRecv held = {evt.bid, evt.res};
+
+			if(evt.redo)
+				it->second.held.push_front(held);
+			else
+				it->second.held.push_back(held);
+
+			break;
+		}
+
+		if(evt.bid >= 0)
+			RecycleBuffer(evt.bid);
+
+		ArmRecv(fd, it->second);
+
+		break;
+	default:
+		break;
+	}
+}
+
+BOOL CIOUring::PeekEvent(TEvent& evt)
+{
+	UINT uiHead = *m_pCqHead;
+
+	while(uiHead != __atomic_load_n(m_pCqTail, __ATOMIC_ACQUIRE))
+	{
+		const io_uring_cqe& cqe = m_pCqes[uiHead & m_uiCqMask];
+
+		ULLONG ullKey	= cqe.user_data;
+		int res			= cqe.res;
+		UINT flags		= cqe.flags;
+
+		__atomic_store_n(m_pCqHead, ++uiHead, __ATOMIC_RELEASE);
+
+		if(ullKey == 0)
+			continue;
+
+		CCriSecLock locallock(m_cs);
+
+		BOOL bEvent = FALSE;
+
+		switch(KeyOp(ullKey))
+		{
+		case OT_POLL: bEvent = OnPollCqe(ullKey, res, evt);			break;
+		case OT_RECV: bEvent = OnRecvCqe(ullKey, res, flags, evt);	break;
+		case OT_SEND: bEvent = OnSendCqe(ullKey, res, evt);			break;
+		}
+
+		if(bEvent)
+			return TRUE;
+	}
+
+	CCriSecLock locallock(m_cs);
+
+	return PeekQueued(evt);
+}
+
+BOOL CIOUring::OnPollCqe(ULLONG ullKey, int res, TEvent& evt)
+{
+	auto it = m_regs.find(KeyFD(ullKey));
+
+	if(it == m_regs.end() || it->second.gen != KeyGen(ullKey) || !it->second.inflight)
+		return FALSE;
+
+	TPollReg& reg = it->second;
+	reg.inflight  = FALSE;
+
+	/* 注册未变化而 POLL 被取消（如提交请求的线程已退出）时重新注册 */
+	if(res == -ERROR_CANCELLED)
+	{
+		ArmPoll(KeyFD(ullKey), reg);
+		return FALSE;
+	}
+
+	evt = {ET_POLL, reg.pv, res < 0 ? EPOLLERR : (UINT)res, 0, nullptr, -1, FALSE, ullKey};
+
+	return TRUE;
+}
+
+BOOL CIOUring::OnRecvCqe(ULLONG ullKey, int res, UINT flags, TEvent& evt)
+{
+#ifdef _IO_URING_COMPLETION_SUPPORT
+	FD fd	= KeyFD(ullKey);
+	int bid	= (flags & IORING_CQE_F_BUFFER) ? (int)(flags >> IORING_CQE_BUFFER_SHIFT) : -1;
+
+	CPollRegs::iterator it;
+
+	if(!FindReg(ullKey, it))
+	{
+		if(bid >= 0)
+			RecycleBuffer(bid);
+
+		return FALSE;
+	}
+
+	TPollReg& reg = it->second;
+
+	if(!(flags & IORING_CQE_F_MORE))
+		reg.recving = FALSE;
+
+	/* 接收请求被取消（暂停接收，或提交请求的线程已退出），需要时重新提交 */
+	if(res == -ERROR_CANCELLED)
+	{
+		ArmRecv(fd, reg);
+		return FALSE;
+	}
+
+	/* 提供缓冲区耗尽：退化为一次可读就绪事件，由处理器直接读取，然后重新提交接收请求 */
+	if(res == -ENOBUFS)
+	{
+		if(reg.recving || !reg.held.empty() || !(reg.mask & EPOLLIN))
+			return FALSE;
+
+		evt = {ET_READY, reg.pv, EPOLLIN, 0, nullptr, -1, FALSE, ullKey};
+
+		return TRUE;
+	}
+
+	/* 暂停接收或已有保留数据时按顺序保留 */
+	if(!reg.held.empty() || !(reg.mask & EPOLLIN))
+	{
+		reg.held.push_back({bid, res});
+		return FALSE;
+	}
+
+	evt = {ET_RECV, reg.pv, 0, res, GetBuffer(bid), bid, FALSE, ullKey};
+
+	return TRUE;
+#else
+	return FALSE;
+#endif
+}
+
+BOOL CIOUring::OnSendCqe(ULLONG ullKey, int res, TEvent& evt)
+{
+	CPollRegs::iterator it;
+
+	if(!FindReg(ullKey, it) || !it->second.sending)
+		return FALSE;
+
+	TPollReg& reg = it->second;
+	reg.sending	  = FALSE;
+
+	evt = {ET_SEND, reg.pv, 0, res, nullptr, -1, FALSE, ullKey};
+
+	return TRUE;
+}
+
+BOOL CIOUring::PeekQueued(TEvent& evt)
+{
+	while(!m_lsQueued.empty())
+	{
+		FD fd	= m_lsQueued.front();
+		auto it	= m_regs.find(fd);
+
+		if(it != m_regs.end() && it->second.queued)
+		{
+			TPollReg& reg = it->second;
+
+			if((reg.mask & EPOLLIN) && !reg.held.empty())
+			{
+				THeldRecv held = reg.held.front();
+				reg.held.pop_front();
+
+				evt = {ET_RECV, reg.pv, 0, held.res, GetBuffer(held.bid), held.bid, TRUE, MakeKey(fd, reg.id, OT_RECV)};
+
+				return TRUE;
+			}
+
+			reg.queued = FALSE;
+			ArmRecv(fd, reg);
+		}
+
+		m_lsQueued.pop_front();
+	}
+
+	return FALSE;
+}
+
+BOOL CIOUring::FindReg(ULLONG ullKey, CPollRegs::iterator& it)
+{
+	it = m_regs.find(KeyFD(ullKey));
+
+	return (it != m_regs.end() && it->second.complete && it->second.id == KeyGen(ullKey));
+}
+
+BOOL CIOUring::Enter(BOOL bWait)
+{
+	UINT uiSubmit;
+
+	{
+		CCriSecLock locallock(m_cs);
+
+		uiSubmit = GetToSubmit();
+
+		/* 有待重新投递的数据时不等待 */
+		if(!m_lsQueued.empty())
+			bWait = FALSE;
+	}
+
+	return DoEnter(uiSubmit, bWait ? 1 : 0, bWait);
+}
+
+BOOL CIOUring::Poll()
+{
+	if(HasEvent())
+		return TRUE;
+
+	UINT uiSubmit;
+
+	{
+		CCriSecLock locallock(m_cs);
+		uiSubmit = GetToSubmit();
+	}
+
+	return DoEnter(uiSubmit, 0, TRUE) && HasEvent();
+}
+
+BOOL CIOUring::DoEnter(UINT uiSubmit, UINT uiWait, BOOL bGetEvents)
+{
+	if(uiSubmit == 0 && !bGetEvents)
+		return TRUE;
+
+	UINT uiFlags = bGetEvents ? IORING_ENTER_GETEVENTS : 0;
+
+	while(TRUE)
+	{
+		int rs = (int)syscall(__NR_io_uring_enter, m_fd, uiSubmit, uiWait, uiFlags, nullptr, 0);
+
+		if(rs >= 0)
+			return TRUE;
+
+		int code = ::GetLastError();
+
+		if(code == EINTR)
+			continue;
+		if(code == EAGAIN || code == EBUSY)
+			return TRUE;
+
+		return FALSE;
+	}
+}
+
+io_uring_sqe* CIOUring::GetSqe()
+{
+	if(GetToSubmit() >= m_uiSqEntries)
+	{
+		if(!DoEnter(GetToSubmit(), 0) || GetToSubmit() >= m_uiSqEntries)
+		{
+			::SetLastError(ERROR_AGAIN);
+			return nullptr;
+		}
+	}
+
+	UINT idx			= m_uiSqTail & m_uiSqMask;
+	io_uring_sqe* pSqe	= &m_pSqes[idx];
+
+	::ZeroMemory(pSqe, sizeof(io_uring_sqe));
+
+	m_pSqArray[idx] = idx;
+
+	return pSqe;
+}
+
+VOID CIOUring::CommitSqe()
+{
+	__atomic_store_n(m_pSqTail, ++m_uiSqTail, __ATOMIC_RELEASE);
+}
+
+BOOL CIOUring::PushPoll(FD fd, UINT mask, UINT gen)
+{
+	io_uring_sqe* pSqe = GetSqe();
+
+	if(pSqe == nullptr)
+		return FALSE;
+
+	pSqe->opcode		= IORING_OP_POLL_ADD;
+	pSqe->fd			= fd;
+	pSqe->poll32_events	= mask & ~(EPOLLET | EPOLLONESHOT | EPOLLEXCLUSIVE | EPOLLWAKEUP);
+	pSqe->user_data		= MakeKey(fd, gen);
+
+	CommitSqe();
+
+	return TRUE;
+}
+
+BOOL CIOUring::PushPollRemove(FD fd, UINT gen)
+{
+	io_uring_sqe* pSqe = GetSqe();
+
+	if(pSqe == nullptr)
+		return FALSE;
+
+	pSqe->opcode	= IORING_OP_POLL_REMOVE;
+	pSqe->fd		= -1;
+	pSqe->addr		= MakeKey(fd, gen);
+	pSqe->user_data	= 0;
+
+	CommitSqe();
+
+	return TRUE;
+}
+
+BOOL CIOUring::PushRecv(FD fd, const TPollReg& reg)
+{
+#ifdef _IO_URING_COMPLETION_SUPPORT
+	io_uring_sqe* pSqe = GetSqe();
+
+	if(pSqe == nullptr)
+		return FALSE;
+
+	pSqe->opcode	= IORING_OP_RECV;
+	pSqe->fd		= (reg.file >= 0) ? reg.file : fd;
+	pSqe->flags		= IOSQE_BUFFER_SELECT | ((reg.file >= 0) ? IOSQE_FIXED_FILE : 0);
+	pSqe->ioprio	= IORING_RECV_MULTISHOT;
+	pSqe->buf_group	= 0;
+	pSqe->user_data	= MakeKey(fd, reg.id, OT_RECV);
+
+	CommitSqe();
+
+	return TRUE;
+#else
+	::SetLastError(ERROR_NOT_SUPPORTED);
+	return FALSE;
+#endif
+}
+
+BOOL CIOUring::PushSend(FD fd, TPollReg& reg)
+{
+	io_uring_sqe* pSqe = GetSqe();
+
+	if(pSqe == nullptr)
+		return FALSE;
+
+	/* 单个数据块以 IORING_OP_SEND 发送，多个数据块以 IORING_OP_SENDMSG 聚集发送（msghdr 与 iovec 在提交时由内核复制） */
+	if(reg.vecs.size() == 1)
+	{
+		pSqe->opcode	= IORING_OP_SEND;
+		pSqe->addr		= (ULLONG)reg.vecs[0].iov_base;
+		pSqe->len		= (UINT)reg.vecs[0].iov_len;
+	}
+	else
+	{
+		::ZeroMemory(&reg.msg, sizeof(reg.msg));
+
+		reg.msg.msg_iov		= reg.vecs.data();
+		reg.msg.msg_iovlen	= reg.vecs.size();
+
+		pSqe->opcode	= IORING_OP_SENDMSG;
+		pSqe->addr		= (ULLONG)&reg.msg;
+		pSqe->len		= 1;
+	}
+
+	pSqe->fd		= (reg.file >= 0) ? reg.file : fd;
+	pSqe->flags		= (reg.file >= 0) ? IOSQE_FIXED_FILE : 0;
+	pSqe->msg_flags	= MSG_NOSIGNAL;
+	pSqe->user_data	= MakeKey(fd, reg.id, OT_SEND);
+
+	CommitSqe();
+
+	return TRUE;
+}
+
+BOOL CIOUring::PushCancel(ULLONG ullKey)
+{
+	io_uring_sqe* pSqe = GetSqe();
+
+	if(pSqe == nullptr)
+		return FALSE;
+
+	pSqe->opcode	= IORING_OP_ASYNC_CANCEL;
+	pSqe->fd		= -1;
+	pSqe->addr		= ullKey;
+	pSqe->user_data	= 0;
+
+	CommitSqe();
+
+	return TRUE;
+}
+
+BOOL CIOUring::PushNop()
+{
+	io_uring_sqe* pSqe = GetSqe();
+
+	if(pSqe == nullptr)
+		return FALSE;
+
+	pSqe->opcode	= IORING_OP_NOP;
+	pSqe->user_data	= 0;
+
+	CommitSqe();
+
+	return TRUE;
+}
+
+VOID CIOUring::RecycleBuffer(int bid)
+{
+#ifdef _IO_URING_COMPLETION_SUPPORT
+	/* 缓冲区环的 tail 与第一个 io_uring_buf 的 resv 字段重叠（C++ 中 io_uring_buf_ring::bufs 的偏移与内核不一致，不能直接使用） */
+	io_uring_buf* pBufs	= (io_uring_buf*)m_pBufRing;
+	io_uring_buf& buf	= pBufs[m_usBufTail & (m_uiBufCount - 1)];
+
+	buf.addr	= (ULLONG)GetBuffer(bid);
+	buf.len		= m_dwBufSize;
+	buf.bid		= (USHORT)bid;
+
+	__atomic_store_n(&pBufs[0].resv, ++m_usBufTail, __ATOMIC_RELEASE);
+#endif
+}
+
+int CIOUring::AllocFile(FD fd)
+{
+	if(m_vtFreeFiles.empty())
+		return -1;
+
+	int file = m_vtFreeFiles.back();
+	io_uring_files_update upd;
+
+	::ZeroMemory(&upd, sizeof(upd));
+
+	upd.offset	= (UINT)file;
+	upd.fds		= (ULLONG)&fd;
+
+	if((int)syscall(__NR_io_uring_register, m_fd, IORING_REGISTER_FILES_UPDATE, &upd, 1) != 1)
+		return -1;
+
+	m_vtFreeFiles.pop_back();
+
+	return file;
+}
+
+VOID CIOUring::FreeFile(int file)
+{
+	int fd = INVALID_FD;
+	io_uring_files_update upd;
+
+	::ZeroMemory(&upd, sizeof(upd));
+
+	upd.offset	= (UINT)file;
+	upd.fds		= (ULLONG)&fd;
+
+	if(VERIFY((int)syscall(__NR_io_uring_register, m_fd, IORING_REGISTER_FILES_UPDATE, &upd, 1) == 1))
+		m_vtFreeFiles.push_back(file);
+}
+
+#endif
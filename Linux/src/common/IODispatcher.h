@@ -23,7 +23,7 @@
 
 #pragma once
 
-#include "../../include/hpsocket/GlobalDef.h"
+#include "../../include/hpsocket/HPTypeDef.h"
 #include "Singleton.h"
 #include "RingBuffer.h"
 #include "Thread.h"
@@ -32,7 +32,25 @@
 #include <sys/eventfd.h>
 #include <sys/timerfd.h>
 
+#if !defined(_IO_URING_DISABLED) && defined(__has_include)
+	#if __has_include(<linux/io_uring.h>)
+		#include <linux/io_uring.h>
+		#define _IO_URING_SUPPORT
+
+		/* 以 SQE 提交连接的收发需要多次触发的 IORING_OP_RECV 与提供缓冲区环（内核 6.0 及以上版本） */
+		#ifdef IORING_RECV_MULTISHOT
+			#define _IO_URING_COMPLETION_SUPPORT
+		#endif
+	#endif
+#endif
+
+#include <sys/uio.h>
+#include <sys/socket.h>
+
 #include <memory>
+#include <vector>
+#include <deque>
+#include <unordered_map>
 
 using namespace std;
 
@@ -68,19 +86,352 @@ using namespace std;
 struct	TDispCommand;
 class	CIODispatcher;
 
+#ifdef _IO_URING_SUPPORT
+
+/* io_uring 事件环：监听 Socket、eventfd、timerfd 等句柄以 IORING_OP_POLL_ADD 模拟水平触发的 EPOLL 注册；
+   以完成模式注册的连接 Socket 把接收与发送作为 SQE 提交：多次触发的 IORING_OP_RECV 从提供缓冲区环选取缓冲区，
+   IORING_OP_SEND / IORING_OP_SENDMSG 直接发送调用者的数据块，并尽量以固定文件（IOSQE_FIXED_FILE）引用 Socket。
+   注册/修改请求与等待事件合并为一次系统调用 */
+class CIOUring
+{
+	/* 暂停接收期间保留的接收结果（bid 为提供缓冲区 ID，-1 表示 res 为连接关闭或错误码） */
+	struct THeldRecv
+	{
+		int bid;
+		int res;
+	};
+
+	struct TPollReg
+	{
+		UINT	mask;
+		PVOID	pv;
+		UINT	gen;
+		BOOL	inflight;
+
+		/* 完成模式：id 在注册期间不变，用作接收与发送请求的 user_data；file 为固定文件槽位（-1 表示未使用） */
+		BOOL	complete;
+		UINT	id;
+		int		file;
+		BOOL	recving;
+		BOOL	sending;
+		BOOL	queued;
+
+		deque<THeldRecv>	held;
+		vector<iovec>		vecs;
+		msghdr				msg;
+	};
+
+	using CPollRegs = unordered_map<FD, TPollReg>;
+
+	enum EnOpType {OT_POLL = 0, OT_RECV = 1, OT_SEND = 2};
+
+public:
+	enum EnEventType
+	{
+		ET_POLL,	// 句柄就绪（events）
+		ET_READY,	// 提供缓冲区耗尽，完成模式的连接退化为一次可读就绪事件
+		ET_RECV,	// 接收完成（res > 0 时 data 为接收到的数据，否则为连接关闭或错误码）
+		ET_SEND		// 发送完成（res 为发送的字节数或错误码）
+	};
+
+	struct TEvent
+	{
+		EnEventType	type;
+		PVOID		pv;
+		UINT		events;
+		int			res;
+		const BYTE*	data;
+		int			bid;
+		BOOL		redo;
+		ULLONG		key;
+	};
+
+public:
+	static const UINT DEF_ENTRIES		= 1024;
+	static const UINT DEF_RECV_BUFFERS	= 256;
+	static const UINT DEF_FIXED_FILES	= 4096;
+
+public:
+	BOOL Init(UINT uiEntries = DEF_ENTRIES, DWORD dwRecvBufferSize = 0);
+	VOID Term();
+
+	BOOL CtlFD(FD fd, int op, UINT mask, PVOID pv, BOOL bDefer, BOOL bComplete = FALSE);
+	BOOL Send(FD fd, const iovec vecs[], int iCount);
+	BOOL Enter(BOOL bWait);
+	BOOL Poll();
+	BOOL PeekEvent(TEvent& evt);
+	VOID Rearm(const TEvent& evt, BOOL bHold = FALSE);
+
+	BOOL IsValid()		const {return IS_VALID_FD(m_fd);}
+	BOOL IsComplete()	const {return m_pBufRing != nullptr;}
+	BOOL HasEvent()			  {return *m_pCqHead != __atomic_load_n(m_pCqTail, __ATOMIC_ACQUIRE) || HasQueued();}
+
+private:
+	io_uring_sqe* GetSqe();
+	VOID CommitSqe();
+	BOOL PushPoll(FD fd, UINT mask, UINT gen);
+	BOOL PushPollRemove(FD fd, UINT gen);
+	BOOL PushRecv(FD fd, const TPollReg& reg);
+	BOOL PushSend(FD fd, TPollReg& reg);
+	BOOL PushCancel(ULLONG ullKey);
+	BOOL PushNop();
+	BOOL DoEnter(UINT uiSubmit, UINT uiWait, BOOL bGetEvents = FALSE);
+	UINT GetToSubmit() const {return m_uiSqTail - __atomic_load_n(m_pSqHead, __ATOMIC_ACQUIRE);}
+
+	BOOL InitCompletion(const io_uring_params& params, DWORD dwRecvBufferSize);
+	BOOL OnPollCqe(ULLONG ullKey, int res, TEvent& evt);
+	BOOL OnRecvCqe(ULLONG ullKey, int res, UINT flags, TEvent& evt);
+	BOOL OnSendCqe(ULLONG ullKey, int res, TEvent& evt);
+	BOOL PeekQueued(TEvent& evt);
+	BOOL HasQueued() {CCriSecLock locallock(m_cs); return !m_lsQueued.empty();}
+	VOID ArmRecv(FD fd, TPollReg& reg);
+	VOID QueueRecv(FD fd, TPollReg& reg, BOOL bDefer);
+	VOID Detach(FD fd, TPollReg& reg);
+	BOOL FindReg(ULLONG ullKey, CPollRegs::iterator& it);
+	BOOL ArmPoll(FD fd, TPollReg& reg);
+	VOID RecycleBuffer(int bid);
+	int AllocFile(FD fd);
+	VOID FreeFile(int file);
+
+	const BYTE* GetBuffer(int bid)	const {return bid >= 0 ? m_pBufs + (size_t)bid * m_dwBufSize : nullptr;}
+	UINT NextGen()					{return (m_uiGen = (m_uiGen + 1) & KEY_GEN_MASK) != 0 ? m_uiGen : ++m_uiGen;}
+
+	static UINT PollMask(const TPollReg& reg);
+
+	static ULLONG MakeKey(FD fd, UINT gen, EnOpType op = OT_POLL)	{return ((ULLONG)op << KEY_OP_SHIFT) | ((ULLONG)gen << 32) | (UINT)fd;}
+	static FD KeyFD(ULLONG ullKey)									{return (FD)(UINT)ullKey;}
+	static UINT KeyGen(ULLONG ullKey)								{return (UINT)(ullKey >> 32) & KEY_GEN_MASK;}
+	static EnOpType KeyOp(ULLONG ullKey)							{return (EnOpType)(ullKey >> KEY_OP_SHIFT);}
+
+	VOID Reset();
+
+public:
+	CIOUring()	{Reset();}
+	~CIOUring()	{Term();}
+
+	DECLARE_NO_COPY_CLASS(CIOUring)
+
+private:
+	static const int KEY_OP_SHIFT	= 60;
+	static const UINT KEY_GEN_MASK	= 0x0FFFFFFF;
+
+	FD				m_fd;
+	PVOID			m_pRing;
+	size_t			m_szRing;
+	io_uring_sqe*	m_pSqes;
+	size_t			m_szSqes;
+
+	UINT*			m_pSqHead;
+	UINT*			m_pSqTail;
+	UINT*			m_pSqArray;
+	UINT			m_uiSqMask;
+	UINT			m_uiSqEntries;
+	UINT			m_uiSqTail;
+
+	UINT*			m_pCqHead;
+	UINT*			m_pCqTail;
+	io_uring_cqe*	m_pCqes;
+	UINT			m_uiCqMask;
+
+	UINT			m_uiGen;
+	CPollRegs		m_regs;
+	deque<FD>		m_lsQueued;
+	CCriSec			m_cs;
+
+	PVOID			m_pBufRing;
+	size_t			m_szBufRing;
+	BYTE*			m_pBufs;
+	size_t			m_szBufs;
+	DWORD			m_dwBufSize;
+	UINT			m_uiBufCount;
+	USHORT			m_usBufTail;
+
+	vector<int>		m_vtFreeFiles;
+};
+
+#endif
+
+class CTimingWheel;
+
+typedef VOID (*Fn_DispTimerProc)(PVOID pv);
+
+struct TDispTimerLink
+{
+	TDispTimerLink* prev;
+	TDispTimerLink* next;
+
+	VOID Init()				{prev = next = this;}
+	BOOL IsEmpty() const	{return next == this;}
+
+	TDispTimerLink() : prev(nullptr), next(nullptr) {}
+};
+
+/* 分发器定时器：由调用方持有，通过 CIODispatcher::SetTimer() 挂接到指定工作线程的时间轮，在该工作线程中回调 */
+struct TDispTimer : public TDispTimerLink
+{
+	friend class CTimingWheel;
+	friend class CIODispatcher;
+
+	Fn_DispTimerProc	fn;
+	PVOID				pv;
+
+	BOOL IsActive() const {return wheel != nullptr;}
+
+	TDispTimer(Fn_DispTimerProc f = nullptr, PVOID p = nullptr)
+	: fn(f), pv(p), wheel(nullptr), expire(0), period(0), gen(0)
+	{
+	}
+
+	DECLARE_NO_COPY_CLASS(TDispTimer)
+
+private:
+	CTimingWheel* volatile	wheel;
+	ULLONG					expire;
+	DWORD					period;
+	atomic<DWORD>			gen;
+};
+
+/* 分层时间轮：每个工作线程一个，以单个 timerfd 驱动（精度 1 毫秒，第 0 层 256 槽，第 1 ~ 3 层各 64 槽） */
+class CTimingWheel
+{
+	static const int TVR_BITS	= 8;
+	static const int TVN_BITS	= 6;
+	static const int TVN_LEVELS	= 3;
+	static const int TVR_SIZE	= 1 << TVR_BITS;
+	static const int TVN_SIZE	= 1 << TVN_BITS;
+	static const int TVR_MASK	= TVR_SIZE - 1;
+	static const int TVN_MASK	= TVN_SIZE - 1;
+
+	static const ULLONG MAX_DELAY = (1ULL << (TVR_BITS + TVN_LEVELS * TVN_BITS)) - 1;
+
+public:
+	using CExpiredTimers = vector<pair<TDispTimer*, DWORD>>;
+
+public:
+	BOOL Init();
+	VOID Term();
+
+	BOOL Schedule(TDispTimer* pTimer, DWORD dwDelay, DWORD dwPeriod);
+	BOOL Cancel(TDispTimer* pTimer);
+	VOID Expire(CExpiredTimers& vtExpired);
+
+	FD GetFD()			const {return m_fd;}
+	DWORD GetCount()	const {return m_dwCount;}
+
+private:
+	VOID AddTimer(TDispTimer* pTimer);
+	int Cascade(int iLevel);
+	VOID Arm(ULLONG ullTick);
+	ULLONG GetNextTick();
+
+	static ULLONG Now();
+	static VOID Link(TDispTimerLink* pHead, TDispTimerLink* pNode);
+	static VOID Unlink(TDispTimerLink* pNode);
+	static VOID Splice(TDispTimerLink* pHead, TDispTimerLink* pList);
+
+	VOID Reset();
+
+public:
+	CTimingWheel()	{Reset();}
+	~CTimingWheel()	{Term();}
+
+	DECLARE_NO_COPY_CLASS(CTimingWheel)
+
+private:
+	FD				m_fd;
+	ULLONG			m_ullTick;
+	ULLONG			m_ullArmed;
+	DWORD			m_dwCount;
+	CCriSec			m_cs;
+
+	TDispTimerLink	m_tvRoot[TVR_SIZE];
+	TDispTimerLink	m_tvLevels[TVN_LEVELS][TVN_SIZE];
+};
+
+/* 工作线程运行统计（仅由所属工作线程更新，其它线程读取快照） */
+struct TDispStats
+{
+	volatile ULLONG	loops;
+	volatile ULLONG	events;
+	volatile ULLONG	commands;
+	volatile ULLONG	drains;
+	volatile ULLONG	cmdLatency;
+	volatile ULLONG	handleTime;
+	volatile ULLONG	waitTime;
+	volatile DWORD	migrations;
+	volatile DWORD	maxEvents;
+	volatile DWORD	maxCmdLatency;
+	volatile DWORD	maxHandle;
+
+	atomic<ULLONG>	signalTime;
+
+	VOID OnWake(ULLONG ullBegin, ULLONG ullEnd, int iEvents)
+	{
+		loops		= loops + 1;
+		events		= events + iEvents;
+		waitTime	= waitTime + (ullEnd - ullBegin);
+
+		if((DWORD)iEvents > maxEvents)
+			maxEvents = (DWORD)iEvents;
+	}
+
+	/* 统计单个事件的处理耗时（含套接字读写与用户回调） */
+	ULLONG OnHandle(ULLONG ullBegin)
+	{
+		ULLONG ullEnd	= ::TimeGetMicroTime64();
+		DWORD dwTime	= (DWORD)(ullEnd - ullBegin);
+
+		handleTime = handleTime + dwTime;
+
+		if(dwTime > maxHandle)
+			maxHandle = dwTime;
+
+		return ullEnd;
+	}
+
+	VOID OnDrain(DWORD dwCommands)
+	{
+		ULLONG ullSignal = signalTime.load(memory_order_relaxed);
+		ULLONG ullNow	 = ::TimeGetMicroTime64();
+		DWORD dwLatency	 = (ullNow > ullSignal) ? (DWORD)(ullNow - ullSignal) : 0;
+
+		commands	= commands + dwCommands;
+		drains		= drains + 1;
+		cmdLatency	= cmdLatency + dwLatency;
+
+		if(dwLatency > maxCmdLatency)
+			maxCmdLatency = dwLatency;
+	}
+
+	VOID Reset()
+	{
+		loops = events = commands = drains = cmdLatency = handleTime = waitTime = 0;
+		migrations = maxEvents = maxCmdLatency = maxHandle = 0;
+
+		signalTime.store(0, memory_order_relaxed);
+	}
+
+	TDispStats() {Reset();}
+
+	DECLARE_NO_COPY_CLASS(TDispStats)
+};
+
 struct TDispContext
 {
 	friend class CIODispatcher;
 
-	using CCommandQueue = CCASQueue<TDispCommand>;
-	using CWorkerThread = CThread<CIODispatcher, TDispContext, int>;
+	using CCommandQueue		= CMPSCRingQueue<TDispCommand>;
+	using COverflowQueue	= CCASQueue<TDispCommand>;
+	using CWorkerThread		= CThread<CIODispatcher, TDispContext, int>;
+
+	static const DWORD DEF_COMMAND_QUEUE_SIZE = 1024;
 
 public:
 	int GetIndex()		 const {return m_iIndex;}
 	THR_ID GetThreadId() const {return m_pWorker != nullptr ? m_pWorker->GetThreadID() : 0;}
 
 public:
-	TDispContext()	{Reset();}
+	TDispContext() : m_queue(DEF_COMMAND_QUEUE_SIZE) {Reset();}
 	~TDispContext() = default;
 
 	DECLARE_NO_COPY_CLASS(TDispContext)
@@ -92,6 +443,16 @@ private:
 		m_epoll		= INVALID_FD;
 		m_evCmd		= INVALID_FD;
 		m_pWorker	= nullptr;
+		m_pWheel	= nullptr;
+		m_bSignaled	= FALSE;
+		m_dwOverflow= 0;
+		m_dwSpin	= 0;
+		m_iMigrateTo= -1;
+#ifdef _IO_URING_SUPPORT
+		m_pRing		= nullptr;
+#endif
+
+		m_stats.Reset();
 	}
 
 private:
@@ -100,7 +461,18 @@ private:
 	FD	m_evCmd;
 
 	CCommandQueue				m_queue;
+	COverflowQueue				m_lsOverflow;
+	atomic<DWORD>				m_dwOverflow;
+	atomic<BOOL>				m_bSignaled;
+	DWORD						m_dwSpin;
+	volatile int				m_iMigrateTo;
 	unique_ptr<CWorkerThread>	m_pWorker;
+	unique_ptr<CTimingWheel>	m_pWheel;
+	CTimingWheel::CExpiredTimers m_vtExpired;
+	TDispStats					m_stats;
+#ifdef _IO_URING_SUPPORT
+	unique_ptr<CIOUring>		m_pRing;
+#endif
 };
 
 struct TDispCommand
@@ -109,19 +481,16 @@ struct TDispCommand
 	UINT_PTR wParam;
 	UINT_PTR lParam;
 
-	static TDispCommand* Construct(USHORT t, UINT_PTR wp = 0, UINT_PTR lp = 0)
-		{return new TDispCommand(t, wp, lp);}
+	static TDispCommand* Construct(const TDispCommand& cmd)
+		{return new TDispCommand(cmd);}
 
 	static VOID Destruct(TDispCommand* p)
 		{if(p) delete p;}
 
-private:
-	TDispCommand(USHORT t, UINT_PTR wp = 0, UINT_PTR lp = 0)
+	TDispCommand(USHORT t = 0, UINT_PTR wp = 0, UINT_PTR lp = 0)
 	: type(t), wParam(wp), lParam(lp)
 	{
 	}
-
-	~TDispCommand() = default;
 };
 
 // ------------------------------------------------------------------------------------------------------------------------------------------------------- //
@@ -130,6 +499,7 @@ class IIOHandler
 {
 public:
 	virtual VOID OnCommand(const TDispContext* pContext, TDispCommand* pCmd)					= 0;
+	virtual VOID OnDropCommand(TDispCommand* pCmd)												= 0;
 
 	virtual BOOL OnBeforeProcessIo(const TDispContext* pContext, PVOID pv, UINT events)			= 0;
 	virtual VOID OnAfterProcessIo(const TDispContext* pContext, PVOID pv, UINT events, BOOL rs)	= 0;
@@ -137,7 +507,14 @@ public:
 	virtual BOOL OnReadyWrite(const TDispContext* pContext, PVOID pv, UINT events)				= 0;
 	virtual BOOL OnHungUp(const TDispContext* pContext, PVOID pv, UINT events)					= 0;
 	virtual BOOL OnError(const TDispContext* pContext, PVOID pv, UINT events)					= 0;
+	virtual BOOL OnErrorQueue(const TDispContext* pContext, PVOID pv, UINT events)				= 0;
 	virtual BOOL OnReadyPrivilege(const TDispContext* pContext, PVOID pv, UINT events)			= 0;
+	virtual BOOL OnMigrate(const TDispContext* pContext, PVOID pv, int iTarget)					= 0;
+
+	/* io_uring 完成模式：接收完成（iResult > 0 为数据长度，0 为连接关闭，< 0 为错误码的相反数），返回 HR_IGNORE 时分发器保留数据，恢复接收后重新投递 */
+	virtual EnHandleResult OnReceiveComplete(const TDispContext* pContext, PVOID pv, const BYTE* pData, int iResult)	= 0;
+	/* io_uring 完成模式：CIODispatcher::SubmitSend() 提交的发送完成（iResult 为发送的字节数或错误码的相反数） */
+	virtual BOOL OnSendComplete(const TDispContext* pContext, PVOID pv, int iResult)			= 0;
 
 	virtual VOID OnDispatchThreadStart(THR_ID tid)												= 0;
 	virtual VOID OnDispatchThreadEnd(THR_ID tid)												= 0;
@@ -150,13 +527,19 @@ class CIOHandler : public IIOHandler
 {
 public:
 	virtual VOID OnCommand(const TDispContext* pContext, TDispCommand* pCmd)					override {}
+	virtual VOID OnDropCommand(TDispCommand* pCmd)												override {}
 
 	virtual BOOL OnBeforeProcessIo(const TDispContext* pContext, PVOID pv, UINT events)			override {return TRUE;}
 	virtual VOID OnAfterProcessIo(const TDispContext* pContext, PVOID pv, UINT events, BOOL rs)	override {}
 	virtual BOOL OnReadyWrite(const TDispContext* pContext, PVOID pv, UINT events)				override {return TRUE;}
 	virtual BOOL OnHungUp(const TDispContext* pContext, PVOID pv, UINT events)					override {return TRUE;}
 	virtual BOOL OnError(const TDispContext* pContext, PVOID pv, UINT events)					override {return TRUE;}
+	virtual BOOL OnErrorQueue(const TDispContext* pContext, PVOID pv, UINT events)				override {return FALSE;}
 	virtual BOOL OnReadyPrivilege(const TDispContext* pContext, PVOID pv, UINT events)			override {return TRUE;}
+	virtual BOOL OnMigrate(const TDispContext* pContext, PVOID pv, int iTarget)					override {return FALSE;}
+
+	virtual EnHandleResult OnReceiveComplete(const TDispContext* pContext, PVOID pv, const BYTE* pData, int iResult)	override {return HR_OK;}
+	virtual BOOL OnSendComplete(const TDispContext* pContext, PVOID pv, int iResult)			override {return TRUE;}
 
 	virtual VOID OnDispatchThreadStart(THR_ID tid)												override {}
 	virtual VOID OnDispatchThreadEnd(THR_ID tid)												override {}
@@ -167,57 +550,43 @@ public:
 class CIODispatcher
 {
 public:
-	static const int DEF_WORKER_MAX_EVENTS	= 64;
+	static const int DEF_WORKER_MAX_EVENTS		= 64;
+	static const DWORD MIN_BUSY_POLL_SPIN		= 4;
+	static const DWORD DEF_REBALANCE_INTERVAL	= 1000;
 
 	using CCommandQueue	= TDispContext::CCommandQueue;
 	using CWorkerThread	= TDispContext::CWorkerThread;
 
 public:
-	BOOL Start(IIOHandler* pHandler, int iWorkerMaxEvents = DEF_WORKER_MAX_EVENTS, int iWorkers = 0);
+	/* dwRecvBufferSize 大于 0 时，io_uring 模式尽量以完成模式注册带 armed 参数的句柄（每个工作线程提供 CIOUring::DEF_RECV_BUFFERS 个该大小的接收缓冲区） */
+	BOOL Start(IIOHandler* pHandler, int iWorkerMaxEvents = DEF_WORKER_MAX_EVENTS, int iWorkers = 0, BOOL bUseIOUring = FALSE, const vector<int>& vtCpus = vector<int>(), DWORD dwBusyPollTime = 0, DWORD dwRecvBufferSize = 0);
 	BOOL Stop(BOOL bCheck = TRUE);
 
-	BOOL SendCommandByIndex(int idx, TDispCommand* pCmd);
 	BOOL SendCommandByIndex(int idx, USHORT t, UINT_PTR wp = 0, UINT_PTR lp = 0);
-	BOOL SendCommandByFD(FD fd, TDispCommand* pCmd);
 	BOOL SendCommandByFD(FD fd, USHORT t, UINT_PTR wp = 0, UINT_PTR lp = 0);
-	BOOL SendCommand(TDispContext& ctx, TDispCommand* pCmd);
-
-	template<class _List, typename = enable_if_t<is_same<remove_reference_t<typename _List::reference>, TDispCommand*>::value>>
-	BOOL SendCommandsByIndex(int idx, const _List& cmds)
-	{
-		TDispContext& ctx = GetContextByIndex(idx);
-		return SendCommands(ctx, cmds);
-	}
-
-	template<class _List, typename = enable_if_t<is_same<remove_reference_t<typename _List::reference>, TDispCommand*>::value>>
-	BOOL SendCommandsByFD(FD fd, const _List& cmds)
-	{
-		TDispContext& ctx = GetContextByFD(fd);
-		return SendCommands(ctx, cmds);
-	}
-
-	template<class _List, typename = enable_if_t<is_same<remove_reference_t<typename _List::reference>, TDispCommand*>::value>>
-	BOOL SendCommands(TDispContext& ctx, const _List& cmds)
-	{
-		size_t size = cmds.size();
-		if(size == 0) return FALSE;
-
-		for(auto it = cmds.begin(), end = cmds.end(); it != end; ++it)
-			ctx.m_queue.PushBack(*it);
-
-		return VERIFY_IS_NO_ERROR(eventfd_write(ctx.m_evCmd, size));
-	}
+	BOOL SendCommand(TDispContext& ctx, const TDispCommand& cmd);
+	BOOL SendCommands(TDispContext& ctx, const TDispCommand cmds[], int iCount);
 
 	BOOL AddFD(int idx, FD fd, UINT mask, PVOID pv)	{return CtlFD(idx, fd, EPOLL_CTL_ADD, mask, pv);}
 	BOOL ModFD(int idx, FD fd, UINT mask, PVOID pv)	{return CtlFD(idx, fd, EPOLL_CTL_MOD, mask, pv);}
 	BOOL DelFD(int idx, FD fd)						{return CtlFD(idx, fd, EPOLL_CTL_DEL, 0, nullptr);}
-	BOOL CtlFD(int idx, FD fd, int op, UINT mask, PVOID pv);
+	BOOL CtlFD(int idx, FD fd, int op, UINT mask, PVOID pv)	{return DoCtlFD(idx, fd, op, mask, pv, FALSE);}
+
+	BOOL AddFD(int idx, FD fd, UINT mask, PVOID pv, UINT& armed);
+	BOOL ModFD(int idx, FD fd, UINT mask, PVOID pv, UINT& armed);
+	BOOL DetachFD(int idx, FD fd);
 
+	/* 完成模式：以 SQE 提交发送（在连接所属工作线程中调用；完成前不能再次提交，vecs 指向的数据块在 IIOHandler::OnSendComplete() 之前必须保持有效） */
+	BOOL SubmitSend(int idx, FD fd, const iovec vecs[], int iCount);
 
 	BOOL AddFD(FD fd, UINT mask, PVOID pv)			{return CtlFD(-1, fd, EPOLL_CTL_ADD, mask, pv);}
 	BOOL ModFD(FD fd, UINT mask, PVOID pv)			{return CtlFD(-1, fd, EPOLL_CTL_MOD, mask, pv);}
 	BOOL DelFD(FD fd)								{return CtlFD(-1, fd, EPOLL_CTL_DEL, 0, nullptr);}
 	BOOL CtlFD(FD fd, int op, UINT mask, PVOID pv)	{return CtlFD(-1, fd, op, mask, pv);}
+
+	BOOL AddFD(FD fd, UINT mask, PVOID pv, UINT& armed)	{return AddFD(-1, fd, mask, pv, armed);}
+	BOOL ModFD(FD fd, UINT mask, PVOID pv, UINT& armed)	{return ModFD(-1, fd, mask, pv, armed);}
+	BOOL DetachFD(FD fd)								{return DetachFD(-1, fd);}
 											
 	BOOL ProcessIo(const TDispContext* pContext, PVOID pv, UINT events);
 
@@ -227,11 +596,42 @@ public:
 	FD AddTimer		(LLONG llInterval, PVOID pv)	{return AddTimer(-1, llInterval, pv);}
 	BOOL DelTimer	(FD fdTimer)					{return DelTimer(-1, fdTimer);}
 
+	/* 在 idx 对应工作线程的时间轮上（重新）设置定时器；dwPeriod 为 0 时只触发一次。
+	   在该工作线程中调用 KillTimer() 或 SetTimer() 后，此前已到期但尚未执行的回调不再执行；在其它线程中调用时回调仍可能被执行最后一次，
+	   因此定时器对象在 KillTimer() 后须保持有效（不立即释放）到工作线程处理完当前批次的到期定时器 */
+	BOOL SetTimer	(int idx, TDispTimer* pTimer, DWORD dwDelay, DWORD dwPeriod = 0);
+	BOOL KillTimer	(TDispTimer* pTimer);
+
+	/* 获取工作线程运行统计快照（pStats 为空或 dwCount 小于工作线程数量时返回 FALSE，并通过 dwCount 返回工作线程数量） */
+	BOOL GetStats	(TWorkerStats pStats[], DWORD& dwCount);
+
+	/* 启动负载均衡：每 dwInterval 毫秒比较各工作线程的事件处理耗时，繁忙率差值达到 dwThreshold（百分比）时，
+	   最繁忙的工作线程把下一个产生事件的连接通过 IIOHandler::OnMigrate() 迁移到最空闲的工作线程 */
+	BOOL StartRebalance	(DWORD dwThreshold, DWORD dwInterval = DEF_REBALANCE_INTERVAL);
+	BOOL StopRebalance	();
+
 private:
 	int WorkerProc(TDispContext* pContext);
+	int BusyPoll(TDispContext* pContext, epoll_event* pEvents);
+#ifdef _IO_URING_SUPPORT
+	int WorkerProcIOUring(TDispContext* pContext);
+	BOOL BusyPollIOUring(TDispContext* pContext);
+	BOOL InitIOUring(TDispContext& ctx);
+#endif
+	VOID AdjustBusyPollSpin(TDispContext* pContext, BOOL bHit);
 	BOOL ProcessExit(const TDispContext* pContext, UINT events);
 	BOOL ProcessCommand(TDispContext* pContext, UINT events);
+	BOOL ProcessReceive(const TDispContext* pContext, PVOID pv, const BYTE* pData, int iResult);
+	BOOL ProcessSend(const TDispContext* pContext, PVOID pv, int iResult);
+	BOOL ProcessTimer(TDispContext* pContext, UINT events);
+	VOID ProcessMigrate(TDispContext* pContext, PVOID pv);
+	VOID Rebalance();
+
+	static VOID OnRebalanceTimer(PVOID pv) {((CIODispatcher*)pv)->Rebalance();}
+	VOID PushCommand(TDispContext& ctx, const TDispCommand& cmd);
+	BOOL NotifyCommand(TDispContext& ctx);
 	BOOL DoProcessIo(const TDispContext* pContext, PVOID pv, UINT events);
+	BOOL DoCtlFD(int idx, FD fd, int op, UINT mask, PVOID pv, BOOL bComplete);
 
 	VOID Reset();
 	VOID MakePrefix();
@@ -246,10 +646,13 @@ public:
 	const TDispContext& GetContextRef(int idx, FD fd)	{return GetContext(idx, fd);}
 
 	BOOL HasStarted()	{return m_pHandler && m_pContexts;}
+	BOOL IsIOUring()	{return m_bIOUring;}
+	BOOL IsCompletionIo()	{return m_bCompletionIo;}
 	int GetWorkers()	{return m_iWorkers;}
+	DWORD GetBusyPollTime()	{return m_dwBusyPollTime;}
 	const TDispContext* GetContexts() {return m_pContexts.get();}
 
-	CIODispatcher()		{MakePrefix(); Reset();}
+	CIODispatcher() : m_tmRebalance(OnRebalanceTimer, this) {MakePrefix(); Reset();}
 	~CIODispatcher()	{if(HasStarted()) Stop();}
 
 	DECLARE_NO_COPY_CLASS(CIODispatcher)
@@ -264,9 +667,20 @@ private:
 private:
 	int				m_iWorkers;
 	int				m_iMaxEvents;
+	BOOL			m_bIOUring;
+	BOOL			m_bCompletionIo;
+	DWORD			m_dwBusyPollTime;
+	DWORD			m_dwRecvBufferSize;
 
 	FD				m_evExit;
 
+	vector<int>				m_vtCpus;
+
+	TDispTimer				m_tmRebalance;
+	DWORD					m_dwRebalanceThreshold;
+	ULLONG					m_ullRebalanceTime;
+	vector<ULLONG>			m_vtBusyTime;
+
 	IIOHandler*				m_pHandler;
 	unique_ptr<TDispContext[]>	m_pContexts;
 };
@@ -1651,6 +1651,117 @@ private:
 	volatile DWORD m_dwCheckTime;
 };
 
+// ------------------------------------------------------------------------------------------------------------------------------------------------------- //
+
+/* 有界多生产者单消费者环形队列（元素内联存储，入队/出队均不分配内存） */
+template <class T> class CMPSCRingQueue
+{
+private:
+	struct Cell
+	{
+		atomic<SIZE_T>	seq;
+		T				value;
+	};
+
+public:
+
+	BOOL TryPushBack(const T& val)
+	{
+		Cell* pCell	= nullptr;
+		SIZE_T pos	= m_posPush.load(memory_order_relaxed);
+
+		while(true)
+		{
+			pCell		= &m_pCells[pos & m_dwMask];
+			SIZE_T seq	= pCell->seq.load(memory_order_acquire);
+			INT_PTR dif	= (INT_PTR)seq - (INT_PTR)pos;
+
+			if(dif == 0)
+			{
+				if(m_posPush.compare_exchange_weak(pos, pos + 1, memory_order_relaxed))
+					break;
+			}
+			else if(dif < 0)
+				return FALSE;
+			else
+				pos = m_posPush.load(memory_order_relaxed);
+		}
+
+		pCell->value = val;
+		pCell->seq.store(pos + 1, memory_order_release);
+
+		return TRUE;
+	}
+
+	BOOL UnsafePopFront(T& val)
+	{
+		SIZE_T pos	= m_posPop.load(memory_order_relaxed);
+		Cell* pCell	= &m_pCells[pos & m_dwMask];
+		SIZE_T seq	= pCell->seq.load(memory_order_acquire);
+
+		if((INT_PTR)seq - (INT_PTR)(pos + 1) < 0)
+			return FALSE;
+
+		val = pCell->value;
+		pCell->seq.store(pos + m_dwMask + 1, memory_order_release);
+
+		m_posPop.store(pos + 1, memory_order_relaxed);
+
+		return TRUE;
+	}
+
+public:
+
+	DWORD Capacity()	{return m_dwMask + 1;}
+	/* 可在任意线程调用：先读出队位置，再读入队位置，并发出入队时结果只是近似值 */
+	DWORD Size()
+	{
+		SIZE_T posPop	= m_posPop.load(memory_order_acquire);
+		SIZE_T posPush	= m_posPush.load(memory_order_acquire);
+
+		return (posPush > posPop) ? (DWORD)(posPush - posPop) : 0;
+	}
+
+	BOOL IsEmpty()		{return Size() == 0;}
+
+public:
+
+	CMPSCRingQueue(DWORD dwSize)
+	: m_dwMask	(AdjustSize(dwSize) - 1)
+	, m_posPush	(0)
+	, m_posPop	(0)
+	{
+		m_pCells = make_unique<Cell[]>(m_dwMask + 1);
+
+		for(DWORD i = 0; i <= m_dwMask; i++)
+			m_pCells[i].seq.store(i, memory_order_relaxed);
+	}
+
+	~CMPSCRingQueue() = default;
+
+	DECLARE_NO_COPY_CLASS(CMPSCRingQueue)
+
+private:
+	static DWORD AdjustSize(DWORD dwSize)
+	{
+		DWORD dwAdjust = 2;
+
+		while(dwAdjust < dwSize)
+			dwAdjust <<= 1;
+
+		return dwAdjust;
+	}
+
+private:
+	const DWORD				m_dwMask;
+	unique_ptr<Cell[]>		m_pCells;
+
+	char					pack1[PACK_SIZE_OF(unique_ptr<Cell[]>)];
+	atomic<SIZE_T>			m_posPush;
+	char					pack2[PACK_SIZE_OF(atomic<SIZE_T>)];
+	atomic<SIZE_T>			m_posPop;
+};
+
 template <class T> using CCASQueue			= CCASQueueX<T>;
 template <class T> using CCASSimpleQueue	= CCASSimpleQueueX<T>;
 